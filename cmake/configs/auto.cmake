@@ -217,6 +217,13 @@ config_lib(
     HEADER "memkind.h"
 )
 
+config_lib(
+    HAVE_LIBNUMA
+    "numa library exists."
+    LIB "numa"
+    HEADER "numa.h"
+)
+
 config_lib(
     HAVE_LIBPTHREAD
     "Pthread library exists."
@@ -246,6 +246,16 @@ config_bool(
     DEPENDS_ERROR ON "Failed to find memkind library"
 )
 
+config_bool(
+    ENABLE_NUMA
+    "Enable the numa library, needed for NUMA cache partitioning"
+    DEFAULT OFF
+    DEPENDS "HAVE_LIBNUMA"
+    # Specifically throw a fatal error if a user tries to enable NUMA support without actually
+    # having the library available (as opposed to silently defaulting to OFF).
+    DEPENDS_ERROR ON "Failed to find numa library"
+)
+
 config_bool(
     ENABLE_SNAPPY
     "Build the snappy compressor extension"
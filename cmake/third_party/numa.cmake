@@ -0,0 +1,27 @@
+if(NOT HAVE_LIBNUMA)
+    # We can't construct a numa library target.
+    return()
+endif()
+
+if (NOT ENABLE_NUMA)
+  # We don't want to construct a numa library target.
+  return()
+endif()
+
+if(TARGET wt::numa)
+    # Avoid redefining the imported library.
+    return()
+endif()
+
+# Define the imported numa library target that can be subsequently linked across the build system.
+# We use the double colons (::) as a convention to tell CMake that the target name is associated
+# with an IMPORTED target (which allows CMake to issue a diagnostic message if the library wasn't found).
+add_library(wt::numa SHARED IMPORTED GLOBAL)
+set_target_properties(wt::numa PROPERTIES
+    IMPORTED_LOCATION ${HAVE_LIBNUMA}
+)
+if (HAVE_LIBNUMA_INCLUDES)
+    set_target_properties(wt::numa PROPERTIES
+        INTERFACE_INCLUDE_DIRECTORIES ${HAVE_LIBNUMA_INCLUDES}
+    )
+endif()
@@ -194,6 +194,20 @@ file_runtime_config = common_runtime_config + [
         should specify \c sequential and other workloads should specify \c none. The option leads
         to an appropriate operating system advisory call where available''',
         choices=['none', 'random', 'sequential']),
+    Config('cache_quota', '', r'''
+        the object's share of the cache, as percentages of the cache size. Shares are enforced by
+        eviction when the cache is under pressure, see @ref tuning_cache_quota for more
+        information''',
+        type='category', subconfig=[
+        Config('max', '100', r'''
+            while the object uses more than this share of the cache, eviction only selects pages
+            from objects over their maximum share''',
+            min='1', max='100'),
+        Config('min', '0', r'''
+            while the object uses less than this share of the cache, eviction does not select the
+            object's pages. A minimum larger than the maximum share is limited to the maximum''',
+            min='0', max='100'),
+        ]),
     Config('cache_resident', 'false', r'''
         do not ever evict the object's pages from cache, see @ref tuning_cache_resident for more
         information''',
@@ -216,6 +230,13 @@ file_runtime_config = common_runtime_config + [
         dirty blocks belonging to this object in the system buffer cache after that many bytes
         from this object are written into the buffer cache''',
         min=0),
+    Config('ttl', '0', r'''
+        time-to-live for records, in timestamp units. If non-zero, a record committed with a
+        timestamp is treated as deleted by readers whose read timestamp is at least the commit
+        timestamp plus the configured value, and is discarded when a page is reconciled once
+        that point is older than the oldest timestamp. Records committed without a timestamp
+        never expire. Only supported for row-store objects''',
+        min=0),
 ]
 
 # Per-file configuration
@@ -235,6 +256,36 @@ file_config = format_meta + file_runtime_config + tiered_config + [
         compression engine name created with WT_CONNECTION::add_compressor. If WiredTiger
         has builtin support for \c "lz4", \c "snappy", \c "zlib" or \c "zstd" compression,
         these names are also available. See @ref compression for more information'''),
+    Config('block_compressor_adaptive', '', r'''
+        configure reconciliation to choose a compressor for each page written, rather than
+        compressing every page with the \c block_compressor. The compressor chosen for a page is
+        recorded in the page header, and the list of compressors cannot be changed after the
+        file is created''',
+        type='category', subconfig=[
+        Config('compressors', '', r'''
+            additional compressors to choose from, in addition to the \c block_compressor, which
+            must also be configured. Permitted values are custom compression engine names created
+            with WT_CONNECTION::add_compressor and, if WiredTiger has builtin support, \c "lz4",
+            \c "snappy", \c "zlib" or \c "zstd". At most 8 compressors may be listed''',
+            type='list'),
+        Config('policy', 'none', r'''
+            the compressor selection policy. The \c none setting compresses all pages with the
+            \c block_compressor. The \c ratio setting compresses a sample of each page with every
+            compressor and uses the one with the best compression ratio, or writes the page
+            uncompressed if no compressor reduces the sample's size. The \c temperature setting
+            minimizes CPU for hot pages and maximizes the compression ratio for cold pages: pages
+            written while they remain in cache, or evicted because they grew too large, are
+            compressed with the \c block_compressor, and pages evicted because they were not
+            recently used are compressed as for the \c ratio setting''',
+            choices=['none', 'ratio', 'temperature']),
+        ]),
+    Config('block_compressor_config', '', r'''
+        configuration passed to the \c block_compressor when the file is opened, for example the
+        trained dictionary used by the \c "zstd" compressor, configured as
+        \c "dictionary=<hex-encoded dictionary>". The configuration is stored in the file's
+        metadata and cannot be changed after the file is created. It is an error to configure
+        this setting for a compressor without a WT_COMPRESSOR::customize callback. See
+        @ref compression for more information'''),
     Config('checksum', 'on', r'''
         configure block checksums; the permitted values are \c on, \c off, \c uncompressed and
         \c unencrypted. The default is \c on, in which case all block writes include a checksum
@@ -430,6 +481,13 @@ connection_runtime_config = [
         Config('cache_on_checkpoint', 'true', r'''
             cache blocks written by a checkpoint''',
             type='boolean'),
+        Config('cache_on_evict', 'false', r'''
+            cache the compressed images of clean pages as they are evicted from the cache,
+            rather than caching blocks as they are read. Configured with \c cache_on_checkpoint
+            and \c cache_on_writes turned off, the block cache holds recently evicted pages
+            rather than a copy of pages that are also in the cache. Requires a \c DRAM block
+            cache''',
+            type='boolean'),
         Config('cache_on_writes', 'true', r'''
             cache blocks as they are written (other than checkpoint blocks)''',
             type='boolean'),
@@ -504,6 +562,11 @@ connection_runtime_config = [
     Config('checkpoint_cleanup', '', r'''
         periodically checkpoint cleanup the database.''',
         type='category', subconfig=[
+        Config('history_store_threads', '1', r'''
+            the number of threads checkpoint cleanup uses to walk the history store. Each thread
+            walks a share of the subtrees below the history store's root page, removing obsolete
+            pages in parallel''',
+            min='1', max='20'),
         Config('method', 'none', r'''
             control how aggressively obsolete content is removed by reading the internal pages.
             Default to none, which means no additional work is done to find obsolete content.
@@ -618,6 +681,51 @@ connection_runtime_config = [
                 Use legacy page visit strategy for eviction. Using this option is highly discouraged
                 as it will re-introduce the bug described in WT-9121.''',
                 type='boolean'),
+            Config('app_handoff', 'false', r'''
+                if true, application threads don't evict pages when the cache crosses an eviction
+                trigger. They wait, in the order they arrived, for the eviction threads to make
+                space, and all eviction worker threads are started while any are waiting''',
+                type='boolean'),
+            Config('app_handoff_wait_max_ms', '100', r'''
+                the longest an application thread waits for the eviction threads when \c
+                app_handoff is configured, in milliseconds. The thread continues its operation
+                once the wait ends''',
+                min='1', max='10000'),
+            Config('dirty_page_index', 'false', r'''
+                track the dirty leaf pages of each tree in an index, in the order they were first
+                modified. When eviction only needs to reduce the cache's dirty content, pages are
+                taken from the index instead of walking the tree to find them''',
+                type='boolean'),
+            Config('policy', 'lru', r'''
+                the policy used to rank pages for eviction. The \c lru setting ranks pages by how
+                recently they were read. The \c frequency setting also estimates how often pages
+                are read, and ranks pages read repeatedly behind pages read once, so a large scan
+                evicts its own pages before the application's working set''',
+                choices=['lru', 'frequency']),
+            Config('tuning', 'reactive', r'''
+                how eviction adapts to the workload. The \c reactive setting starts eviction when
+                the cache crosses an eviction target, and adds worker threads while that improves
+                eviction throughput. The \c predictive setting also tracks how quickly the cache's
+                content, dirty content and updates grow, and the interval between checkpoints. It
+                starts eviction, starts worker threads and walks more pages early enough to keep
+                the cache below its eviction triggers, before application threads are needed''',
+                choices=['reactive', 'predictive']),
+            Config('tuning_horizon_ms', '1000', r'''
+                how far ahead the \c predictive tuning setting forecasts the cache's growth, in
+                milliseconds. The forecast is extended while application threads are still needed
+                to evict pages, and returns to this value once they are not''',
+                min='100', max='60000'),
+            Config('trace', 'false', r'''
+                record a trace of page reads, page accesses and eviction decisions. The trace can
+                be replayed against other eviction policies and cache sizes without running the
+                application, see @ref tuning_cache_trace. Tracing adds overhead to every page
+                access and should not be left enabled''',
+                type='boolean'),
+            Config('trace_path', '"."', r'''
+                the name of a directory into which eviction trace files are written. The directory
+                must already exist. If the value is not an absolute path, the path is relative to
+                the database home (see @ref absolute_path for more information). The path is read
+                when tracing starts'''),
             ]),
     Config('eviction_checkpoint_target', '1', r'''
         perform eviction at the beginning of checkpoints to bring the dirty content in cache
@@ -717,13 +825,34 @@ connection_runtime_config = [
     Config('history_store', '', r'''
         history store configuration options''',
         type='category', subconfig=[
+        Config('delta_chain_max', '10', r'''
+            the maximum number of consecutive older versions of a key stored in the history
+            store as reverse deltas, each against the next newer version, before a full value is
+            stored. Larger settings reduce the history store size for large values with small
+            changes, at the cost of applying more deltas when reading old versions. A setting of
+            0 stores full values only''',
+            min='0', max='100'),
+        Config('drop_truncate', 'immediate', r'''
+            how dropping a table removes the table's content from the history store. With \c
+            "immediate", the drop truncates the content before returning, taking time in
+            proportion to the table's history. With \c "background", the drop records the
+            table's file ID in the metadata, and the checkpoint cleanup thread truncates the
+            content later''',
+            choices=['background', 'immediate']),
         Config('file_max', '0', r'''
             the maximum number of bytes that WiredTiger is allowed to use for its history store
             mechanism. If the history store file exceeds this size, a panic will be triggered. The
             default value means that the history store file is unbounded and may use as much
             space as the filesystem will accommodate. The minimum non-zero setting is 100MB.''',
             # !!! Must match WT_HS_FILE_MIN
-            min='0')
+            min='0'),
+        Config('key_filter_size', '0', r'''
+            the size in bytes of an in-memory filter kept for each table with history store
+            content, recording the keys that have versions in the history store. Searches for
+            keys the filter shows have no history skip the history store. A table's filter is
+            built by scanning its history store content the first time a reader searches the
+            history store after the table is opened. The default value disables the filter''',
+            min='0', max='1GB')
         ]),
     Config('io_capacity', '', r'''
         control how many bytes per second are written and read. Exceeding the capacity results
@@ -781,6 +910,12 @@ connection_runtime_config = [
         Config('name', 'none', r'''
             the name of a cache that is shared between databases or \c "none" when no shared
             cache is configured'''),
+        Config('priority', '50', r'''
+            the weight given to this database's demand for cache when the shared cache is
+            rebalanced. A database's measured pressure is scaled by its priority, so a database
+            with twice the priority of another is allocated cache as if its pressure were twice
+            as high. This setting is per database''',
+            min='1', max='100'),
         Config('quota', '0', r'''
             maximum size of cache this database can be allocated from the shared cache. Defaults
             to the entire shared cache size''',
@@ -907,6 +1042,11 @@ log_configuration_common = [
     Config('archive', 'true', r'''
         automatically remove unneeded log files (deprecated)''',
         type='boolean', undoc=True),
+    Config('group_commit_wait_max', '0', r'''
+        maximum time in microseconds a commit that syncs the log holds its log buffer open for
+        other commits to join, so they can share a single sync. The time actually waited adapts
+        to the recent log sync latency and commit arrival rate; a value of 0 disables waiting''',
+        min='0', max='100000'),
     Config('os_cache_dirty_pct', '0', r'''
         maximum dirty system buffer cache usage, as a percentage of the log's \c file_max.
         If non-zero, schedule writes for dirty blocks belonging to the log in the system buffer
@@ -944,6 +1084,13 @@ wiredtiger_open_log_configuration = [
             compression engine name created with WT_CONNECTION::add_compressor. If WiredTiger
             has builtin support for \c "lz4", \c "snappy", \c "zlib" or \c "zstd" compression,
             these names are also available. See @ref compression for more information'''),
+        Config('compressor_config', '', r'''
+            configuration passed to the log \c compressor, for example the trained dictionary
+            used by the \c "zstd" compressor, configured as \c "dictionary=<hex-encoded
+            dictionary>". Log records are compressed one at a time, a dictionary trained on
+            typical records improves the compression of small records. Log files written with
+            a compressor configuration can only be read with the same configuration. See
+            @ref compression for more information'''),
         Config('file_max', '100MB', r'''
             the maximum size of log files''',
             min='100KB',    # !!! Must match WT_LOG_FILE_MIN
@@ -1179,6 +1326,29 @@ wiredtiger_open_common =\
         enable caching of cursors for reuse. This is the default value for any sessions created,
         and can be overridden in configuring \c cache_cursors in WT_CONNECTION.open_session.''',
         type='boolean'),
+    Config('cache_huge_pages', '', r'''
+        allocate page images and other large in-memory structures from memory mapped with huge
+        pages, see @ref tune_huge_pages for more information. Linux only''',
+        type='category', subconfig=[
+        Config('enabled', 'false', r'''
+            map the memory with huge pages. If the system doesn't have enough huge pages of the
+            configured size reserved, transparent huge pages are requested instead''',
+            type='boolean'),
+        Config('page_size', '2MB', r'''
+            the size of the huge pages to map''',
+            choices=['2MB', '1GB']),
+        Config('size', '0', r'''
+            the amount of memory to map, rounded up to a multiple of the huge page size. Defaults
+            to the cache size, and must be configured with a shared cache. Allocations once the
+            mapped memory is used come from the heap''',
+            min='0', max='10TB'),
+        ]),
+    Config('cache_numa', 'false', r'''
+        partition the cache across the machine's NUMA nodes: track the cache usage of each node,
+        bind eviction threads to nodes, and evict pages from the nodes using more than their share
+        of the cache. Requires a build with NUMA support, see @ref tuning_cache_numa for more
+        information''',
+        type='boolean'),
     Config('checkpoint_sync', 'true', r'''
         flush files to stable storage when closing or writing checkpoints''',
         type='boolean'),
@@ -1186,6 +1356,18 @@ wiredtiger_open_common =\
         the number of configuration strings that can be precompiled. Some configuration strings
         are compiled internally when the connection is opened.''',
         min='500'),
+    Config('compression', '', r'''
+        block compression configuration''',
+        type='category', subconfig=[
+        Config('threads', '0', r'''
+            number of threads WiredTiger will start to compress blocks written by reconciliation.
+            When a page is written as multiple blocks, each completed block is compressed by a
+            worker thread while reconciliation builds the next block. Each compression thread
+            uses a session from the configured session_max. If zero, blocks are compressed by the
+            reconciling thread''',
+            min=0,
+            max=16),    # !!! Must match WT_REC_COMPRESS_THREADS_MAX
+        ]),
     Config('direct_io', '', r'''
         this option is no longer supported, retained for backward compatibility.''',
         type='list', undoc=True),
@@ -1576,6 +1758,13 @@ methods = {
             incremental backup cursor and an error will be returned if one is not provided.
             The identifiers can be any text string, but should be unique'''),
         ]),
+    Config('log_tail_wait', '0', r'''
+        for \c log: cursors, the maximum time in milliseconds WT_CURSOR::next waits for new log
+        records to be written once the cursor reaches the end of the log, before returning
+        ::WT_NOTFOUND. A cursor configured this way can follow the log as it grows, and log
+        files the cursor has not yet read are not removed while it is open. See @ref cursor_log
+        for details''',
+        min='0', max='3600000'),
     Config('next_random', 'false', r'''
         configure the cursor to return a pseudo-random record from the object when the
         WT_CURSOR::next method is called; valid only for row-store cursors. See @ref cursor_random
@@ -1782,8 +1971,11 @@ methods = {
         override whether to sync log records when the transaction commits. The default is inherited
         from ::wiredtiger_open \c transaction_sync. The \c off setting does not wait for records
         to be written or synchronized. The \c on setting forces log records to be written to
-        the storage device''',
-        choices=['off', 'on']),
+        the storage device. The \c background setting does not wait for records to be written
+        or synchronized, instead the session's WT_EVENT_HANDLER::handle_general method is called
+        with the ::WT_EVENT_COMMIT_DURABLE event once they have been written to the storage
+        device''',
+        choices=['background', 'off', 'on']),
 ]),
 
 'WT_SESSION.prepare_transaction' : Method([
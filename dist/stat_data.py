@@ -220,6 +220,7 @@ conn_stats = [
     ##########################################
     BlockCacheStat('block_cache_blocks', 'total blocks'),
     BlockCacheStat('block_cache_blocks_evicted', 'evicted blocks'),
+    BlockCacheStat('block_cache_blocks_insert_evict', 'total blocks inserted on eviction of clean pages'),
     BlockCacheStat('block_cache_blocks_insert_read', 'total blocks inserted on read path'),
     BlockCacheStat('block_cache_blocks_insert_write', 'total blocks inserted on write path'),
     BlockCacheStat('block_cache_blocks_removed', 'removed blocks'),
@@ -232,6 +233,7 @@ conn_stats = [
     BlockCacheStat('block_cache_bypass_put', 'number of bypasses on put because file is too small'),
     BlockCacheStat('block_cache_bypass_writealloc', 'number of bypasses because no-write-allocate setting was on'),
     BlockCacheStat('block_cache_bytes', 'total bytes'),
+    BlockCacheStat('block_cache_bytes_insert_evict', 'total bytes inserted on eviction of clean pages'),
     BlockCacheStat('block_cache_bytes_insert_read', 'total bytes inserted on read path'),
     BlockCacheStat('block_cache_bytes_insert_write', 'total bytes inserted on write path'),
     BlockCacheStat('block_cache_bytes_update', 'cached bytes updated'),
@@ -283,6 +285,9 @@ conn_stats = [
     CacheStat('cache_hazard_checks', 'hazard pointer check calls'),
     CacheStat('cache_hazard_max', 'hazard pointer maximum array length', 'max_aggregate,no_scale'),
     CacheStat('cache_hazard_walks', 'hazard pointer check entries walked'),
+    CacheStat('cache_huge_arena_alloc', 'huge page arena allocations'),
+    CacheStat('cache_huge_arena_bytes', 'huge page arena bytes allocated', 'no_clear,no_scale,size'),
+    CacheStat('cache_huge_arena_fallback', 'huge page arena allocations that fell back to the heap'),
     CacheStat('cache_hs_ondisk', 'history store table on-disk size', 'no_clear,no_scale,size'),
     CacheStat('cache_hs_ondisk_max', 'history store table max on-disk size', 'no_clear,no_scale,size'),
     CacheStat('cache_overhead', 'percentage overhead', 'no_clear,no_scale'),
@@ -306,9 +311,14 @@ conn_stats = [
     EvictStat('eviction_app_dirty_attempt', 'modified page evict attempts by application threads'),
     EvictStat('eviction_app_dirty_fail', 'modified page evict failures by application threads'),
     EvictStat('eviction_app_fail', 'page evict failures by application threads'),
+    EvictStat('eviction_app_handoff_admitted', 'application threads admitted by eviction threads'),
+    EvictStat('eviction_app_handoff_timed_out', 'application thread waits for eviction threads that reached the maximum wait'),
+    EvictStat('eviction_app_handoff_wait', 'application thread waits for eviction threads'),
     EvictStat('eviction_app_time', 'application thread time evicting (usecs)'),
     EvictStat('eviction_clear_ordinary', 'pages removed from the ordinary queue to be queued for urgent eviction'),
     EvictStat('eviction_consider_prefetch', 'pages considered for eviction that were brought in by pre-fetch', 'no_clear,no_scale'),
+    EvictStat('eviction_dirty_index_pages_queued', 'pages queued for eviction from the dirty page index'),
+    EvictStat('eviction_dirty_index_pages_seen', 'pages seen in the dirty page index'),
     EvictStat('eviction_empty_score', 'eviction empty score', 'no_clear,no_scale'),
     EvictStat('eviction_fail', 'pages selected for eviction unable to be evicted'),
     EvictStat('eviction_fail_active_children_on_an_internal_page', 'pages selected for eviction unable to be evicted because of active children on an internal page'),
@@ -324,6 +334,8 @@ conn_stats = [
     EvictStat('eviction_force_hs_success', 'forced eviction - history store pages successfully evicted while session has history store cursor open'),
     EvictStat('eviction_force_long_update_list', 'forced eviction - pages selected because of a large number of updates to a single item'),
     EvictStat('eviction_force_no_retry', 'forced eviction - do not retry count to evict pages selected to evict during reconciliation'),
+    EvictStat('eviction_frequency_age', 'eviction frequency policy page access counts aged'),
+    EvictStat('eviction_frequency_ranked', 'eviction frequency policy pages ranked behind pages read once'),
     EvictStat('eviction_get_ref_empty', 'eviction calls to get a page found queue empty'),
     EvictStat('eviction_get_ref_empty2', 'eviction calls to get a page found queue empty after locking'),
     EvictStat('eviction_internal_pages_already_queued', 'internal pages seen by eviction walk that are already queued'),
@@ -340,6 +352,11 @@ conn_stats = [
     EvictStat('eviction_pages_queued_post_lru', 'pages queued for eviction post lru sorting'),
     EvictStat('eviction_pages_queued_urgent', 'pages queued for urgent eviction'),
     EvictStat('eviction_pages_queued_urgent_hs_dirty', 'pages queued for urgent eviction from history store due to high dirty content'),
+    EvictStat('eviction_predict_checkpoint', 'eviction predictive tuning forecasts covering a checkpoint due within the horizon'),
+    EvictStat('eviction_predict_early_start', 'eviction passes started by the predictive tuning forecast before reaching a target'),
+    EvictStat('eviction_predict_horizon', 'eviction predictive tuning forecast horizon in milliseconds', 'no_clear,no_scale'),
+    EvictStat('eviction_predict_horizon_extended', 'eviction predictive tuning forecast horizon extended after application threads evicted'),
+    EvictStat('eviction_predict_worker_start', 'eviction worker threads started by the predictive tuning forecast'),
     EvictStat('eviction_queue_empty', 'eviction server candidate queue empty when topping up'),
     EvictStat('eviction_queue_not_empty', 'eviction server candidate queue not empty when topping up'),
     EvictStat('eviction_reentry_hs_eviction_milliseconds', 'total milliseconds spent inside reentrant history store evictions in a reconciliation', 'no_clear,no_scale,size'),
@@ -354,6 +371,10 @@ conn_stats = [
     EvictStat('eviction_server_skip_metatdata_with_history', 'eviction server skips metadata pages with history'),
     EvictStat('eviction_server_skip_pages_last_running', 'eviction server skips pages that are written with transactions greater than the last running'),
     EvictStat('eviction_server_skip_pages_retry', 'eviction server skips pages that previously failed eviction and likely will again'),
+    EvictStat('eviction_numa_walk_skip', 'pages skipped by eviction walks because their NUMA node is within its share of the cache'),
+    EvictStat('eviction_numa_worker_local', 'pages chosen by eviction workers from their own NUMA node ahead of queue order'),
+    EvictStat('eviction_server_skip_trees_below_cache_quota', 'eviction server skips trees below their minimum cache share'),
+    EvictStat('eviction_server_skip_trees_cache_quota_over', 'eviction server skips trees while other trees are over their maximum cache share'),
     EvictStat('eviction_server_skip_trees_eviction_disabled', 'eviction server skips trees that disable eviction'),
     EvictStat('eviction_server_skip_trees_not_useful_before', 'eviction server skips trees that were not useful before'),
     EvictStat('eviction_server_skip_trees_stick_in_cache', 'eviction server skips trees that are configured to stick in cache'),
@@ -367,6 +388,7 @@ conn_stats = [
     EvictStat('eviction_target_strategy_clean', 'eviction walk target strategy clean pages'),
     EvictStat('eviction_target_strategy_dirty', 'eviction walk target strategy dirty pages'),
     EvictStat('eviction_target_strategy_updates', 'eviction walk target strategy pages with updates'),
+    EvictStat('eviction_trace_records', 'eviction trace records written'),
     EvictStat('eviction_timed_out_ops', 'operations timed out waiting for space in cache'),
     EvictStat('eviction_walk', 'pages walked for eviction'),
     EvictStat('eviction_walk_from_root', 'eviction walks started from root of tree'),
@@ -410,6 +432,7 @@ conn_stats = [
     ##########################################
     # Checkpoint statistics
     ##########################################
+    CheckpointStat('checkpoint_cleanup_hs_parallel', 'checkpoint cleanup history store walks split between threads'),
     CheckpointStat('checkpoint_cleanup_success', 'checkpoint cleanup successful calls'),
     CheckpointStat('checkpoint_fsync_post', 'fsync calls after allocating the transaction ID'),
     CheckpointStat('checkpoint_fsync_post_duration', 'fsync duration after allocating the transaction ID (usecs)', 'no_clear,no_scale'),
@@ -597,6 +620,7 @@ conn_stats = [
     LogStat('log_compress_len', 'total size of compressed records', 'size'),
     LogStat('log_compress_mem', 'total in-memory size of compressed records', 'size'),
     LogStat('log_compress_small', 'log records too small to compress'),
+    LogStat('log_cursor_tail_wait', 'log cursor waits for new records'),
     LogStat('log_compress_write_fails', 'log records not compressed'),
     LogStat('log_compress_writes', 'log records compressed'),
     LogStat('log_flush', 'log flush operations'),
@@ -618,6 +642,8 @@ conn_stats = [
     LogStat('log_slot_closes', 'slot closures'),
     LogStat('log_slot_coalesced', 'written slots coalesced'),
     LogStat('log_slot_consolidated', 'logging bytes consolidated', 'size'),
+    LogStat('log_slot_group_commit_wait', 'slot group commit waits'),
+    LogStat('log_slot_group_commit_wait_duration', 'slot group commit wait time (usecs)', 'no_clear,no_scale'),
     LogStat('log_slot_immediate', 'slot join calls did not yield'),
     LogStat('log_slot_no_free_slots', 'slot transitions unable to find free slot'),
     LogStat('log_slot_races', 'slot join atomic update races'),
@@ -629,6 +655,7 @@ conn_stats = [
     LogStat('log_slot_yield_race', 'slot join calls atomic updates raced'),
     LogStat('log_slot_yield_sleep', 'slot join calls slept'),
     LogStat('log_sync', 'log sync operations'),
+    LogStat('log_sync_covered', 'log sync operations covered by a concurrent sync'),
     LogStat('log_sync_dir', 'log sync_dir operations'),
     LogStat('log_sync_dir_duration', 'log sync_dir time duration (usecs)', 'no_clear,no_scale'),
     LogStat('log_sync_duration', 'log sync time duration (usecs)', 'no_clear,no_scale'),
@@ -723,6 +750,11 @@ conn_stats = [
     ##########################################
     # Reconciliation statistics
     ##########################################
+    RecStat('rec_arena_alloc', 'arena allocations'),
+    RecStat('rec_arena_chunk', 'arena chunks allocated'),
+    RecStat('rec_compress_parallel', 'blocks compressed by a compression worker thread'),
+    RecStat('rec_compress_parallel_discarded', 'blocks compressed by a compression worker thread but not used'),
+    RecStat('rec_compress_parallel_sync', 'blocks queued for a compression worker thread but compressed by the reconciling thread'),
     RecStat('rec_maximum_hs_wrapup_milliseconds', 'maximum milliseconds spent in moving updates to the history store in a reconciliation', 'no_clear,no_scale,size'),
     RecStat('rec_maximum_image_build_milliseconds', 'maximum milliseconds spent in building a disk image in a reconciliation', 'no_clear,no_scale,size'),
     RecStat('rec_maximum_milliseconds', 'maximum milliseconds spent in a reconciliation call', 'no_clear,no_scale,size'),
@@ -937,6 +969,9 @@ dsrc_stats = [
     ##########################################
     # Compression statistics
     ##########################################
+    CompressStat('compress_adaptive_alternate', 'pages written with an adaptive compressor other than the block compressor'),
+    CompressStat('compress_adaptive_none', 'pages written uncompressed after adaptive sampling found no gain'),
+    CompressStat('compress_adaptive_sample', 'pages sampled to choose an adaptive compressor'),
     CompressStat('compress_precomp_intl_max_page_size', 'compressed page maximum internal page size prior to compression', 'no_clear,no_scale,size'),
     CompressStat('compress_precomp_leaf_max_page_size', 'compressed page maximum leaf page size prior to compression ', 'no_clear,no_scale,size'),
     CompressStat('compress_read', 'pages read from disk'),
@@ -1070,7 +1105,10 @@ conn_dsrc_stats = [
     CacheStat('cache_eviction_trigger_reached', 'number of times eviction trigger was reached'),
     CacheStat('cache_eviction_trigger_updates_reached', 'number of times updates trigger was reached'),
     CacheStat('cache_hs_btree_truncate', 'history store table truncation to remove all the keys of a btree'),
+    CacheStat('cache_hs_btree_truncate_dropped', 'history store table truncation to remove all the keys of a dropped btree'),
     CacheStat('cache_hs_btree_truncate_dryrun', 'history store table truncations that would have happened in non-dryrun mode'),
+    CacheStat('cache_hs_filter_build', 'history store key filters built'),
+    CacheStat('cache_hs_filter_skip', 'history store table searches skipped by the key filter'),
     CacheStat('cache_hs_insert', 'history store table insert calls'),
     CacheStat('cache_hs_insert_full_update', 'the number of times full update inserted to history store'),
     CacheStat('cache_hs_insert_restart', 'history store table insert calls that returned restart'),
@@ -1208,6 +1246,7 @@ conn_dsrc_stats = [
     RecStat('rec_time_window_start_txn', 'records written including a start transaction ID'),
     RecStat('rec_time_window_stop_ts', 'records written including a stop timestamp'),
     RecStat('rec_time_window_stop_txn', 'records written including a stop transaction ID'),
+    RecStat('rec_ttl_expired', 'records discarded because their time-to-live expired'),
     RecStat('rec_vlcs_emptied_pages', 'VLCS pages explicitly reconciled as empty'),
 
     ##########################################
@@ -74,6 +74,15 @@ typedef struct {
 
     ZSTD_CONTEXT_POOL *cctx_pool; /* Compression context pool. */
     ZSTD_CONTEXT_POOL *dctx_pool; /* Decompression context pool. */
+
+    /*
+     * A compressor customized for a table shares the context pools of the compressor it was created
+     * from, and owns a trained dictionary, digested for compression and decompression.
+     */
+    int custom;        /* Customized compressor */
+    ZSTD_CDict *cdict; /* Compression dictionary */
+    ZSTD_DDict *ddict; /* Decompression dictionary */
+    unsigned dict_id;  /* Dictionary ID */
 } ZSTD_COMPRESSOR;
 
 /*
@@ -187,6 +196,7 @@ static int
 zstd_compress(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src, size_t src_len,
   uint8_t *dst, size_t dst_len, size_t *result_lenp, int *compression_failed)
 {
+    ZSTD_CCtx *cctx = NULL;
     ZSTD_COMPRESSOR *zcompressor;
     ZSTD_CONTEXT *context = NULL;
     size_t zstd_ret;
@@ -196,8 +206,19 @@ zstd_compress(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src, size
 
     zstd_get_context(zcompressor, session, CONTEXT_TYPE_COMPRESS, &context);
 
-    /* Compress, starting past the prefix bytes. */
-    if (context != NULL) {
+    /*
+     * Compress, starting past the prefix bytes. A dictionary's ID is recorded in the frame header,
+     * decompression uses it to find the dictionary.
+     */
+    if (zcompressor->cdict != NULL) {
+        /* Dictionary compression requires a context, use a temporary one if none is pooled. */
+        if (context == NULL && (cctx = ZSTD_createCCtx()) == NULL)
+            return (ENOMEM);
+        zstd_ret =
+          ZSTD_compress_usingCDict(context != NULL ? (ZSTD_CCtx *)context->ctx : cctx,
+            dst + ZSTD_PREFIX, dst_len - ZSTD_PREFIX, src, src_len, zcompressor->cdict);
+        ZSTD_freeCCtx(cctx);
+    } else if (context != NULL) {
         zstd_ret = ZSTD_compressCCtx((ZSTD_CCtx *)context->ctx, dst + ZSTD_PREFIX,
           dst_len - ZSTD_PREFIX, src, src_len, zcompressor->compression_level);
     } else {
@@ -245,8 +266,10 @@ zstd_decompress(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src, si
     WT_EXTENSION_API *wt_api;
     ZSTD_COMPRESSOR *zcompressor;
     ZSTD_CONTEXT *context = NULL;
+    ZSTD_DCtx *dctx = NULL;
     size_t zstd_ret;
     uint64_t zstd_len;
+    unsigned dict_id;
 
     wt_api = ((ZSTD_COMPRESSOR *)compressor)->wt_api;
     zcompressor = (ZSTD_COMPRESSOR *)compressor;
@@ -264,13 +287,31 @@ zstd_decompress(WT_COMPRESSOR *compressor, WT_SESSION *session, uint8_t *src, si
         return (WT_ERROR);
     }
 
+    /*
+     * Frames compressed with a dictionary record the dictionary's ID: a frame can only be
+     * decompressed by a compressor customized with the same dictionary.
+     */
+    dict_id = ZSTD_getDictID_fromFrame(src + ZSTD_PREFIX, (size_t)zstd_len);
+    if (dict_id != 0 && dict_id != zcompressor->dict_id) {
+        (void)wt_api->err_printf(wt_api, session,
+          "WT_COMPRESSOR.decompress: block compressed with unknown zstd dictionary %u", dict_id);
+        return (WT_ERROR);
+    }
+
     /*
      * This type of context management is useful to avoid repeated context allocation overhead. This
      * is typically for block compression, for streaming compression, context could be reused over
      * and over again for performance gains.
      */
     zstd_get_context(zcompressor, session, CONTEXT_TYPE_DECOMPRESS, &context);
-    if (context != NULL) {
+    if (dict_id != 0) {
+        /* Dictionary decompression requires a context, use a temporary one if none is pooled. */
+        if (context == NULL && (dctx = ZSTD_createDCtx()) == NULL)
+            return (ENOMEM);
+        zstd_ret = ZSTD_decompress_usingDDict(context != NULL ? (ZSTD_DCtx *)context->ctx : dctx,
+          dst, dst_len, src + ZSTD_PREFIX, (size_t)zstd_len, zcompressor->ddict);
+        ZSTD_freeDCtx(dctx);
+    } else if (context != NULL) {
         zstd_ret = ZSTD_decompressDCtx(
           (ZSTD_DCtx *)context->ctx, dst, dst_len, src + ZSTD_PREFIX, (size_t)zstd_len);
     } else {
@@ -408,12 +449,133 @@ zstd_terminate(WT_COMPRESSOR *compressor, WT_SESSION *session)
 
     (void)session; /* Unused parameters. */
 
+    /* Customized compressors share the context pools of the compressor they were created from. */
+    if (zcompressor->custom) {
+        ZSTD_freeCDict(zcompressor->cdict);
+        ZSTD_freeDDict(zcompressor->ddict);
+        free(compressor);
+        return (0);
+    }
+
     zstd_terminate_context_pool(compressor, CONTEXT_TYPE_COMPRESS, &(zcompressor->cctx_pool));
     zstd_terminate_context_pool(compressor, CONTEXT_TYPE_DECOMPRESS, &(zcompressor->dctx_pool));
     free(compressor);
     return (0);
 }
 
+/*
+ * zstd_hex_value --
+ *     Return the value of a hexadecimal digit, or -1 if the character isn't one.
+ */
+static int
+zstd_hex_value(char c)
+{
+    if (c >= '0' && c <= '9')
+        return (c - '0');
+    if (c >= 'a' && c <= 'f')
+        return (c - 'a' + 10);
+    if (c >= 'A' && c <= 'F')
+        return (c - 'A' + 10);
+    return (-1);
+}
+
+/*
+ * zstd_hex_decode --
+ *     Decode a hexadecimal string into a newly allocated buffer.
+ */
+static int
+zstd_hex_decode(const char *hex, size_t hex_len, uint8_t **bufp, size_t *buf_lenp)
+{
+    size_t i;
+    uint8_t *buf;
+    int hi, lo;
+
+    *bufp = NULL;
+    *buf_lenp = 0;
+
+    if (hex_len == 0 || hex_len % 2 != 0)
+        return (EINVAL);
+    if ((buf = malloc(hex_len / 2)) == NULL)
+        return (errno);
+    for (i = 0; i < hex_len / 2; ++i) {
+        if ((hi = zstd_hex_value(hex[2 * i])) < 0 || (lo = zstd_hex_value(hex[2 * i + 1])) < 0) {
+            free(buf);
+            return (EINVAL);
+        }
+        buf[i] = (uint8_t)(hi << 4 | lo);
+    }
+    *bufp = buf;
+    *buf_lenp = hex_len / 2;
+    return (0);
+}
+
+/*
+ * zstd_customize --
+ *     WiredTiger Zstd compressor customization: load a table's trained dictionary.
+ */
+static int
+zstd_customize(WT_COMPRESSOR *compressor, WT_SESSION *session, WT_CONFIG_ARG *compress_config,
+  WT_COMPRESSOR **customp)
+{
+    WT_CONFIG_ITEM v;
+    WT_EXTENSION_API *wt_api;
+    ZSTD_COMPRESSOR *orig, *zcompressor;
+    size_t dict_len;
+    uint8_t *dict;
+    int ret;
+
+    orig = (ZSTD_COMPRESSOR *)compressor;
+    wt_api = orig->wt_api;
+
+    *customp = NULL;
+
+    if ((ret = wt_api->config_get(wt_api, session, compress_config, "dictionary", &v)) != 0) {
+        if (ret == WT_NOTFOUND)
+            return (0);
+        (void)wt_api->err_printf(
+          wt_api, session, "zstd_customize: %s", wt_api->strerror(wt_api, session, ret));
+        return (ret);
+    }
+    if ((ret = zstd_hex_decode(v.str, v.len, &dict, &dict_len)) != 0) {
+        (void)wt_api->err_printf(
+          wt_api, session, "zstd_customize: dictionary is not a hexadecimal string");
+        return (ret);
+    }
+
+    /*
+     * Only trained dictionaries have an ID, and the ID is how decompression matches a block to its
+     * dictionary: reject raw content dictionaries.
+     */
+    if (ZSTD_getDictID_fromDict(dict, dict_len) == 0) {
+        (void)wt_api->err_printf(
+          wt_api, session, "zstd_customize: dictionary is not a trained zstd dictionary");
+        free(dict);
+        return (EINVAL);
+    }
+
+    if ((zcompressor = calloc(1, sizeof(ZSTD_COMPRESSOR))) == NULL) {
+        ret = errno;
+        free(dict);
+        return (ret);
+    }
+    *zcompressor = *orig;
+    zcompressor->custom = 1;
+    zcompressor->dict_id = ZSTD_getDictID_fromDict(dict, dict_len);
+    zcompressor->cdict = ZSTD_createCDict(dict, dict_len, zcompressor->compression_level);
+    zcompressor->ddict = ZSTD_createDDict(dict, dict_len);
+    free(dict);
+    if (zcompressor->cdict == NULL || zcompressor->ddict == NULL) {
+        (void)wt_api->err_printf(wt_api, session, "zstd_customize: dictionary create failure");
+        ZSTD_freeCDict(zcompressor->cdict);
+        ZSTD_freeDDict(zcompressor->ddict);
+        free(zcompressor);
+        return (ENOMEM);
+    }
+
+    *customp = (WT_COMPRESSOR *)zcompressor;
+    return (0);
+}
+
 /*
  * zstd_init_config --
  *     Handle zstd configuration.
@@ -492,6 +654,7 @@ zstd_extension_init(WT_CONNECTION *connection, WT_CONFIG_ARG *config)
     zstd_compressor->compressor.decompress = zstd_decompress;
     zstd_compressor->compressor.pre_size = zstd_pre_size;
     zstd_compressor->compressor.terminate = zstd_terminate;
+    zstd_compressor->compressor.customize = zstd_customize;
 
     zstd_compressor->wt_api = connection->get_extension_api(connection);
 
@@ -395,13 +395,37 @@ __wti_blkcache_get(WT_SESSION_IMPL *session, const uint8_t *addr, size_t addr_si
     }
 }
 
+/*
+ * __wti_blkcache_cached --
+ *     Return if a block is in the cache, without referencing it.
+ */
+bool
+__wti_blkcache_cached(WT_SESSION_IMPL *session, const uint8_t *addr, size_t addr_size)
+{
+    WT_BLKCACHE *blkcache;
+    WT_BLKCACHE_ITEM *blkcache_item;
+    uint64_t bucket;
+
+    blkcache = &S2C(session)->blkcache;
+
+    bucket = __wt_hash_city64(addr, addr_size) % blkcache->hash_size;
+    __wt_spin_lock(session, &blkcache->hash_locks[bucket]);
+    TAILQ_FOREACH (blkcache_item, &blkcache->hash[bucket], hashq)
+        if (blkcache_item->addr_size == addr_size && blkcache_item->fid == S2BT(session)->id &&
+          memcmp(blkcache_item->addr, addr, addr_size) == 0)
+            break;
+    __wt_spin_unlock(session, &blkcache->hash_locks[bucket]);
+
+    return (blkcache_item != NULL);
+}
+
 /*
  * __wti_blkcache_put --
  *     Put a block into the cache.
  */
 int
 __wti_blkcache_put(WT_SESSION_IMPL *session, WT_ITEM *data, WT_ITEM *deltas, uint32_t num_deltas,
-  WT_PAGE_BLOCK_META *block_meta, const uint8_t *addr, size_t addr_size, bool write)
+  WT_PAGE_BLOCK_META *block_meta, const uint8_t *addr, size_t addr_size, u_int source)
 {
     WT_BLKCACHE *blkcache;
     WT_BLKCACHE_DELTA *blkcache_deltas;
@@ -411,8 +435,10 @@ __wti_blkcache_put(WT_SESSION_IMPL *session, WT_ITEM *data, WT_ITEM *deltas, uin
     uint64_t bucket, hash;
     uint32_t i, total_data_size;
     void *data_ptr;
+    bool write;
 
     blkcache = &S2C(session)->blkcache;
+    write = source == WT_BLKCACHE_INSERT_WRITE;
     blkcache_deltas = NULL;
     blkcache_store = NULL;
     block_meta_ptr = NULL;
@@ -526,12 +552,19 @@ __wti_blkcache_put(WT_SESSION_IMPL *session, WT_ITEM *data, WT_ITEM *deltas, uin
 
     WT_STAT_CONN_INCRV(session, block_cache_bytes, total_data_size);
     WT_STAT_CONN_INCR(session, block_cache_blocks);
-    if (write) {
-        WT_STAT_CONN_INCRV(session, block_cache_bytes_insert_write, total_data_size);
-        WT_STAT_CONN_INCR(session, block_cache_blocks_insert_write);
-    } else {
+    switch (source) {
+    case WT_BLKCACHE_INSERT_EVICT:
+        WT_STAT_CONN_INCRV(session, block_cache_bytes_insert_evict, total_data_size);
+        WT_STAT_CONN_INCR(session, block_cache_blocks_insert_evict);
+        break;
+    case WT_BLKCACHE_INSERT_READ:
         WT_STAT_CONN_INCRV(session, block_cache_bytes_insert_read, total_data_size);
         WT_STAT_CONN_INCR(session, block_cache_blocks_insert_read);
+        break;
+    case WT_BLKCACHE_INSERT_WRITE:
+        WT_STAT_CONN_INCRV(session, block_cache_bytes_insert_write, total_data_size);
+        WT_STAT_CONN_INCR(session, block_cache_blocks_insert_write);
+        break;
     }
 
     __blkcache_verbose(
@@ -615,7 +648,8 @@ __wti_blkcache_remove(WT_SESSION_IMPL *session, const uint8_t *addr, size_t addr
 static int
 __blkcache_init(WT_SESSION_IMPL *session, size_t cache_size, u_int hash_size, u_int type,
   char *nvram_device_path, size_t system_ram, u_int percent_file_in_os_cache, bool cache_on_writes,
-  u_int overhead_pct, u_int evict_aggressive, uint64_t full_target, bool cache_on_checkpoint)
+  u_int overhead_pct, u_int evict_aggressive, uint64_t full_target, bool cache_on_checkpoint,
+  bool cache_on_evict)
 {
     WT_BLKCACHE *blkcache;
     WT_DECL_RET;
@@ -623,6 +657,7 @@ __blkcache_init(WT_SESSION_IMPL *session, size_t cache_size, u_int hash_size, u_
 
     blkcache = &S2C(session)->blkcache;
     blkcache->cache_on_checkpoint = cache_on_checkpoint;
+    blkcache->cache_on_evict = cache_on_evict;
     blkcache->cache_on_writes = cache_on_writes;
     blkcache->hash_size = hash_size;
     blkcache->percent_file_in_os_cache = percent_file_in_os_cache;
@@ -759,7 +794,7 @@ static int
 __blkcache_reconfig(WT_SESSION_IMPL *session, bool reconfig, size_t cache_size, size_t hash_size,
   u_int type, char *nvram_device_path, size_t system_ram, u_int percent_file_in_os_cache,
   bool cache_on_writes, u_int overhead_pct, u_int evict_aggressive, uint64_t full_target,
-  bool cache_on_checkpoint)
+  bool cache_on_checkpoint, bool cache_on_evict)
 {
     WT_BLKCACHE *blkcache;
 
@@ -769,6 +804,7 @@ __blkcache_reconfig(WT_SESSION_IMPL *session, bool reconfig, size_t cache_size,
         return (0);
 
     if (blkcache->cache_on_checkpoint != cache_on_checkpoint ||
+      blkcache->cache_on_evict != cache_on_evict ||
       blkcache->cache_on_writes != cache_on_writes || blkcache->hash_size != hash_size ||
       blkcache->percent_file_in_os_cache != percent_file_in_os_cache ||
       blkcache->full_target != full_target || blkcache->max_bytes != cache_size ||
@@ -845,7 +881,7 @@ __wt_blkcache_setup(WT_SESSION_IMPL *session, const char *cfg[], bool reconfig)
     uint64_t cache_size, full_target, system_ram;
     u_int cache_type, evict_aggressive, hash_size, overhead_pct, percent_file_in_os_cache;
     char *nvram_device_path;
-    bool cache_on_checkpoint, cache_on_writes;
+    bool cache_on_checkpoint, cache_on_evict, cache_on_writes;
 
     blkcache = &S2C(session)->blkcache;
     cache_on_checkpoint = cache_on_writes = true;
@@ -902,6 +938,15 @@ __wt_blkcache_setup(WT_SESSION_IMPL *session, const char *cfg[], bool reconfig)
     if (cval.val == 0)
         cache_on_checkpoint = false;
 
+    /*
+     * Blocks cached on eviction are built from the page's decrypted disk image, and the read path
+     * only skips decryption for blocks found in a DRAM cache.
+     */
+    WT_RET(__wt_config_gets(session, cfg, "block_cache.cache_on_evict", &cval));
+    cache_on_evict = cval.val != 0;
+    if (cache_on_evict && cache_type != WT_BLKCACHE_DRAM)
+        WT_RET_MSG(session, EINVAL, "block_cache.cache_on_evict requires a DRAM block cache");
+
     WT_RET(__wt_config_gets(session, cfg, "block_cache.blkcache_eviction_aggression", &cval));
     evict_aggressive = (u_int)cval.val;
 
@@ -917,9 +962,9 @@ __wt_blkcache_setup(WT_SESSION_IMPL *session, const char *cfg[], bool reconfig)
 
     WT_RET(__blkcache_reconfig(session, reconfig, cache_size, hash_size, cache_type,
       nvram_device_path, system_ram, percent_file_in_os_cache, cache_on_writes, overhead_pct,
-      evict_aggressive, full_target, cache_on_checkpoint));
+      evict_aggressive, full_target, cache_on_checkpoint, cache_on_evict));
 
     return (__blkcache_init(session, cache_size, hash_size, cache_type, nvram_device_path,
       system_ram, percent_file_in_os_cache, cache_on_writes, overhead_pct, evict_aggressive,
-      full_target, cache_on_checkpoint));
+      full_target, cache_on_checkpoint, cache_on_evict));
 }
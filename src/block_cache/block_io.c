@@ -200,18 +200,21 @@ __wt_blkcache_read(WT_SESSION_IMPL *session, WT_ITEM *buf, WT_PAGE_BLOCK_META *b
 
     /*
      * Ignore the cache if we have deltas. We don't expect to have deltas in this type of read call
-     * anyways.
+     * anyways. If the cache is populated on eviction, the block is cached when the page built from
+     * it is evicted.
      */
-    if (results_count > 1)
+    if (results_count > 1 || blkcache->cache_on_evict)
         skip_cache_put = true;
 
     /* Store the decrypted, possibly compressed, block in the block_cache. */
     if (!skip_cache_put)
         /* Use a local variable for block metadata, because the passed-in pointer could be NULL. */
-        WT_ERR(__wti_blkcache_put(session, ip, NULL, 0, &block_meta_tmp, addr, addr_size, false));
+        WT_ERR(__wti_blkcache_put(
+          session, ip, NULL, 0, &block_meta_tmp, addr, addr_size, WT_BLKCACHE_INSERT_READ));
 
     dsk = ip->data;
     if (F_ISSET(dsk, WT_PAGE_COMPRESSED)) {
+        compressor = __wt_btree_compressor(btree, dsk->compressor);
         if (compressor == NULL || compressor->decompress == NULL) {
             ret = __blkcache_read_corrupt(session, WT_ERROR, addr, addr_size,
               "compressed block for which no compression configured");
@@ -231,7 +234,7 @@ __wt_blkcache_read(WT_SESSION_IMPL *session, WT_ITEM *buf, WT_PAGE_BLOCK_META *b
          * In other words, the "tmp" in the decompress call isn't a mistake.
          */
         memcpy(buf->mem, ip->data, WT_BLOCK_COMPRESS_SKIP);
-        ret = compressor->decompress(btree->compressor, &session->iface,
+        ret = compressor->decompress(compressor, &session->iface,
           (uint8_t *)ip->data + WT_BLOCK_COMPRESS_SKIP, tmp->size - WT_BLOCK_COMPRESS_SKIP,
           (uint8_t *)buf->mem + WT_BLOCK_COMPRESS_SKIP, dsk->mem_size - WT_BLOCK_COMPRESS_SKIP,
           &result_len);
@@ -305,6 +308,7 @@ __wt_blkcache_write(WT_SESSION_IMPL *session, WT_ITEM *buf, WT_PAGE_BLOCK_META *
     WT_BLKCACHE *blkcache;
     WT_BM *bm;
     WT_BTREE *btree;
+    WT_COMPRESSOR *compressor;
     WT_DECL_ITEM(ctmp);
     WT_DECL_ITEM(etmp);
     WT_DECL_RET;
@@ -330,11 +334,20 @@ __wt_blkcache_write(WT_SESSION_IMPL *session, WT_ITEM *buf, WT_PAGE_BLOCK_META *
     dsk = NULL;
     encrypted = false;
 
+    /*
+     * Pages of files configured for adaptive compression record the compressor reconciliation chose
+     * in the page header. Deltas are always compressed with the block compressor.
+     */
+    if (delta_count == 0)
+        compressor = __wt_btree_compressor(btree, ((WT_PAGE_HEADER *)buf->mem)->compressor);
+    else
+        compressor = btree->compressor;
+
     /*
      * Optionally stream-compress the data, but don't compress blocks that are already as small as
      * they're going to get.
      */
-    if (btree->compressor == NULL || btree->compressor->compress == NULL || compressed)
+    if (compressor == NULL || compressor->compress == NULL || compressed)
         ip = buf;
     else if (buf->size < 2 * WT_BLOCK_COMPRESS_SKIP) {
         /* FIXME-WT-14609: the heuristic in the condition above was added for deltas and is likely
@@ -353,11 +366,10 @@ __wt_blkcache_write(WT_SESSION_IMPL *session, WT_ITEM *buf, WT_PAGE_BLOCK_META *
          * memory because they don't stop just because there's no more memory into which to
          * compress.
          */
-        if (btree->compressor->pre_size == NULL)
+        if (compressor->pre_size == NULL)
             len = src_len;
         else
-            WT_ERR(
-              btree->compressor->pre_size(btree->compressor, &session->iface, src, src_len, &len));
+            WT_ERR(compressor->pre_size(compressor, &session->iface, src, src_len, &len));
 
         size = len + WT_BLOCK_COMPRESS_SKIP;
         WT_ERR(bm->write_size(bm, session, &size));
@@ -368,8 +380,8 @@ __wt_blkcache_write(WT_SESSION_IMPL *session, WT_ITEM *buf, WT_PAGE_BLOCK_META *
         dst_len = len;
 
         compression_failed = 0;
-        WT_ERR(btree->compressor->compress(btree->compressor, &session->iface, src, src_len, dst,
-          dst_len, &result_len, &compression_failed));
+        WT_ERR(compressor->compress(compressor, &session->iface, src, src_len, dst, dst_len,
+          &result_len, &compression_failed));
         result_len += WT_BLOCK_COMPRESS_SKIP;
 
         /*
@@ -547,11 +559,101 @@ __wt_blkcache_write(WT_SESSION_IMPL *session, WT_ITEM *buf, WT_PAGE_BLOCK_META *
         WT_STAT_CONN_INCR(session, block_cache_bypass_writealloc);
     else if (!checkpoint)
         /* If we are here, it means that we don't have deltas, so let's just ignore them. */
-        WT_ERR(__wti_blkcache_put(
-          session, compressed ? ctmp : buf, NULL, 0, block_meta, addr, *addr_sizep, true));
+        WT_ERR(__wti_blkcache_put(session, compressed && ctmp != NULL ? ctmp : buf, NULL, 0,
+          block_meta, addr, *addr_sizep, WT_BLKCACHE_INSERT_WRITE));
 
 err:
     __wt_scr_free(session, &ctmp);
     __wt_scr_free(session, &etmp);
     return (ret);
 }
+
+/*
+ * __wt_blkcache_evict_put --
+ *     Store the compressed image of a clean page being evicted from the cache in the block cache,
+ *     so the page can be rebuilt without a read if it is needed again. The page's disk image is
+ *     decompressed, compress it again: the block cache is much denser than the cache. The block
+ *     cache is optional, failures are ignored rather than failing eviction.
+ */
+void
+__wt_blkcache_evict_put(
+  WT_SESSION_IMPL *session, WT_PAGE *page, const uint8_t *addr, size_t addr_size)
+{
+    WT_BLKCACHE *blkcache;
+    WT_BTREE *btree;
+    WT_COMPRESSOR *compressor;
+    WT_DECL_ITEM(ctmp);
+    WT_DECL_RET;
+    WT_ITEM item;
+    WT_PAGE_HEADER *dsk;
+    size_t len, result_len, src_len;
+    int compression_failed; /* Extension API, so not a bool. */
+
+    blkcache = &S2C(session)->blkcache;
+    btree = S2BT(session);
+    compressor = btree->compressor;
+
+    if (blkcache->type != WT_BLKCACHE_DRAM || !blkcache->cache_on_evict)
+        return;
+
+    /*
+     * Only cache images of pages exactly as they were read, a page built from a base image and
+     * deltas by disaggregated storage has no single block to cache. Mapped images don't need the
+     * cache.
+     */
+    if (page->dsk == NULL || F_ISSET_ATOMIC_16(page, WT_PAGE_DISK_MAPPED) ||
+      btree->bm->read_multiple != NULL || F_ISSET(btree, WT_BTREE_SALVAGE | WT_BTREE_VERIFY))
+        return;
+
+    /* Check the space and if the block is already cached before paying for compression. */
+    if (blkcache->bytes_used > blkcache->max_bytes ||
+      __wti_blkcache_cached(session, addr, addr_size))
+        return;
+
+    WT_CLEAR(item);
+    item.data = page->dsk;
+    item.size = page->dsk->mem_size;
+    if (compressor != NULL && compressor->compress != NULL && item.size > WT_BLOCK_COMPRESS_SKIP) {
+        src_len = item.size - WT_BLOCK_COMPRESS_SKIP;
+        if (compressor->pre_size == NULL)
+            len = src_len;
+        else
+            WT_ERR(compressor->pre_size(compressor, &session->iface,
+              (uint8_t *)page->dsk + WT_BLOCK_COMPRESS_SKIP, src_len, &len));
+        WT_ERR(__wt_scr_alloc(session, len + WT_BLOCK_COMPRESS_SKIP, &ctmp));
+        WT_ERR(compressor->compress(compressor, &session->iface,
+          (uint8_t *)page->dsk + WT_BLOCK_COMPRESS_SKIP, src_len,
+          (uint8_t *)ctmp->mem + WT_BLOCK_COMPRESS_SKIP, len, &result_len, &compression_failed));
+        if (compression_failed == 0 && result_len < src_len) {
+            memcpy(ctmp->mem, page->dsk, WT_BLOCK_COMPRESS_SKIP);
+            ctmp->size = result_len + WT_BLOCK_COMPRESS_SKIP;
+            dsk = ctmp->mem;
+            F_SET(dsk, WT_PAGE_COMPRESSED);
+            dsk->compressor = WT_PAGE_COMPRESSOR_DEFAULT;
+            item.data = ctmp->data;
+            item.size = ctmp->size;
+        }
+    }
+
+    /*
+     * If the image isn't compressed, the header flag must say so: the page may have been read from
+     * a compressed block.
+     */
+    if (item.data == page->dsk && F_ISSET(page->dsk, WT_PAGE_COMPRESSED)) {
+        if (ctmp == NULL)
+            WT_ERR(__wt_scr_alloc(session, item.size, &ctmp));
+        WT_ERR(__wt_buf_set(session, ctmp, page->dsk, item.size));
+        dsk = ctmp->mem;
+        F_CLR(dsk, WT_PAGE_COMPRESSED);
+        item.data = ctmp->data;
+    }
+
+    WT_ERR(__wti_blkcache_put(
+      session, &item, NULL, 0, NULL, addr, addr_size, WT_BLKCACHE_INSERT_EVICT));
+
+err:
+    __wt_scr_free(session, &ctmp);
+    if (ret != 0)
+        __wt_verbose_debug1(session, WT_VERB_BLKCACHE, "evicted page not cached: %s",
+          __wt_strerror(session, ret, NULL, 0));
+}
@@ -76,6 +76,10 @@ __wt_page_out(WT_SESSION_IMPL *session, WT_PAGE **pagep)
     WT_ASSERT_ALWAYS(session, !F_ISSET_ATOMIC_16(page, WT_PAGE_EVICT_LRU),
       "Attempting to discard page queued for eviction");
 
+    /* Remove the page from its tree's dirty page index. */
+    if (F_ISSET_ATOMIC_16(page, WT_PAGE_EVICT_DIRTY_INDEX))
+        __wt_evict_dirty_index_remove(session, page);
+
     /*
      * If a root page split, there may be one or more pages linked from the page; walk the list,
      * discarding pages.
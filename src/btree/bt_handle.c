@@ -39,6 +39,7 @@ __btree_clear(WT_SESSION_IMPL *session)
     /* Destroy locks. */
     __wt_rwlock_destroy(session, &btree->ovfl_lock);
     __wt_spin_destroy(session, &btree->flush_lock);
+    __wt_spin_destroy(session, &btree->evict_dirty_lock);
 
     /* Free allocated memory. */
     __wt_free(session, btree->key_format);
@@ -224,6 +225,9 @@ __wt_btree_close(WT_SESSION_IMPL *session)
     /* Clear the saved checkpoint information. */
     __wt_ckptlist_saved_free(session);
 
+    /* Discard the history store key filter, it's rebuilt if the btree is re-opened. */
+    __wt_hs_filter_free(session, btree);
+
     /*
      * If we turned eviction off and never turned it back on, do that now, otherwise the counter
      * will be off.
@@ -309,7 +313,8 @@ static int
 __btree_conf(WT_SESSION_IMPL *session, WT_CKPT *ckpt, bool is_ckpt)
 {
     WT_BTREE *btree;
-    WT_CONFIG_ITEM cval, metadata;
+    WT_CONFIG conf;
+    WT_CONFIG_ITEM cval, k, metadata, v;
     WT_CONNECTION_IMPL *conn;
     WT_DECL_RET;
     int64_t maj_version, min_version;
@@ -379,6 +384,16 @@ __btree_conf(WT_SESSION_IMPL *session, WT_CKPT *ckpt, bool is_ckpt)
     else
         F_CLR(btree, WT_BTREE_IN_MEMORY);
 
+    /*
+     * Cache shares are enforced by eviction, see __evict_walk. A minimum share larger than the
+     * maximum is limited to the maximum rather than failing the open, the configuration can be set
+     * by alter.
+     */
+    WT_RET(__wt_config_gets(session, cfg, "cache_quota.max", &cval));
+    btree->cache_quota_max = (u_int)cval.val;
+    WT_RET(__wt_config_gets(session, cfg, "cache_quota.min", &cval));
+    btree->cache_quota_min = WT_MIN((u_int)cval.val, btree->cache_quota_max);
+
     WT_RET(__wt_config_gets(session, cfg, "ignore_in_memory_cache_size", &cval));
     if (cval.val) {
         if (!F_ISSET_ATOMIC_32(conn, WT_CONN_IN_MEMORY))
@@ -486,8 +501,45 @@ __btree_conf(WT_SESSION_IMPL *session, WT_CKPT *ckpt, bool is_ckpt)
         break;
     }
 
+    /* Record time-to-live, expired records are discarded by row-store reconciliation. */
+    WT_RET(__wt_config_gets(session, cfg, "ttl", &cval));
+    btree->ttl = (wt_timestamp_t)cval.val;
+    if (btree->ttl != 0 && btree->type != BTREE_ROW)
+        WT_RET_MSG(session, EINVAL, "the ttl configuration is only supported for row-store");
+
+    /*
+     * The block compressor may be customized for the file, for example, loaded with a trained
+     * dictionary stored in the file's metadata.
+     */
     WT_RET(__wt_config_gets_none(session, cfg, "block_compressor", &cval));
-    WT_RET(__wt_compressor_config(session, &cval, &btree->compressor));
+    WT_RET(__wt_config_gets(session, cfg, "block_compressor_config", &v));
+    WT_RET(
+      __wt_compressor_config_custom(session, "block_compressor", &cval, &v, &btree->compressor));
+
+    /* Adaptive compression chooses among the block compressor and a list of other compressors. */
+    WT_RET(__wt_config_gets(session, cfg, "block_compressor_adaptive.policy", &cval));
+    if (WT_CONFIG_LIT_MATCH("ratio", cval))
+        btree->compress_policy = WT_COMPRESS_POLICY_RATIO;
+    else if (WT_CONFIG_LIT_MATCH("temperature", cval))
+        btree->compress_policy = WT_COMPRESS_POLICY_TEMPERATURE;
+    else
+        btree->compress_policy = WT_COMPRESS_POLICY_NONE;
+    btree->compressor_adaptive_count = 0;
+    WT_RET(__wt_config_gets(session, cfg, "block_compressor_adaptive.compressors", &cval));
+    __wt_config_subinit(session, &conf, &cval);
+    while ((ret = __wt_config_next(&conf, &k, &v)) == 0) {
+        if (btree->compressor_adaptive_count == WT_BTREE_COMPRESSOR_ADAPTIVE_MAX)
+            WT_RET_MSG(session, EINVAL, "too many adaptive compressors, the maximum is %d",
+              WT_BTREE_COMPRESSOR_ADAPTIVE_MAX);
+        WT_RET(__wt_compressor_config(
+          session, &k, &btree->compressor_adaptive[btree->compressor_adaptive_count]));
+        if (btree->compressor_adaptive[btree->compressor_adaptive_count] == NULL)
+            WT_RET_MSG(session, EINVAL, "adaptive compressors must not be none");
+        ++btree->compressor_adaptive_count;
+    }
+    WT_RET_NOTFOUND_OK(ret);
+    if (btree->compress_policy != WT_COMPRESS_POLICY_NONE && btree->compressor == NULL)
+        WT_RET_MSG(session, EINVAL, "adaptive compression requires a block_compressor");
 
     /*
      * Configure compression adjustment.
@@ -535,6 +587,11 @@ __btree_conf(WT_SESSION_IMPL *session, WT_CKPT *ckpt, bool is_ckpt)
     /* Initialize locks. */
     WT_RET(__wt_rwlock_init(session, &btree->ovfl_lock));
     WT_RET(__wt_spin_init(session, &btree->flush_lock, "btree flush"));
+    WT_RET(__wt_spin_init(session, &btree->evict_dirty_lock, "btree dirty page index"));
+
+    /* Initialize the dirty page index. */
+    TAILQ_INIT(&btree->evict_dirtyqh);
+    btree->evict_dirty_count = 0;
 
     btree->modified = false; /* Clean */
 
@@ -60,6 +60,7 @@ __wt_page_alloc(
     WT_RET(__wt_calloc(session, 1, size, &page));
 
     page->type = type;
+    page->numa_node = (uint8_t)__wt_numa_node_current(&S2C(session)->cache->numa);
     __wt_evict_page_init(page);
 
     switch (type) {
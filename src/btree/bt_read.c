@@ -93,9 +93,10 @@ __wt_page_release_evict(WT_SESSION_IMPL *session, WT_REF *ref, uint32_t flags)
 {
     WT_BTREE *btree;
     WT_DECL_RET;
+    WT_EVICT_TRACE_RECORD trace;
     WT_REF_STATE previous_state;
     uint32_t evict_flags;
-    bool locked;
+    bool locked, trace_evict;
 
     btree = S2BT(session);
 
@@ -126,9 +127,19 @@ __wt_page_release_evict(WT_SESSION_IMPL *session, WT_REF *ref, uint32_t flags)
         WT_ASSERT(session, !WT_READING_CHECKPOINT(session));
         WT_RET(__wt_curhs_cache(session));
     }
+    if ((trace_evict = __wt_evict_trace_enabled(session)))
+        __wt_evict_trace_page(btree, ref, WT_EVICT_TRACE_EVICT,
+          WT_EVICT_TRACE_FORCED |
+            (F_ISSET(session, WT_SESSION_INTERNAL) ? 0 : WT_EVICT_TRACE_APP),
+          &trace);
     (void)__wt_atomic_addv32(&btree->evict_busy, 1);
     ret = __wt_evict(session, ref, previous_state, evict_flags);
     (void)__wt_atomic_subv32(&btree->evict_busy, 1);
+    if (trace_evict) {
+        if (ret != 0)
+            trace.type = WT_EVICT_TRACE_EVICT_FAIL;
+        __wt_evict_trace_add(session, &trace);
+    }
 
     return (ret);
 }
@@ -313,6 +324,7 @@ __wt_page_in_func(WT_SESSION_IMPL *session, WT_REF *ref, uint32_t flags
 {
     WT_BTREE *btree;
     WT_DECL_RET;
+    WT_EVICT_TRACE_RECORD trace;
     WT_PAGE *page;
     WT_REF_STATE current_state;
     WT_TXN *txn;
@@ -452,9 +464,14 @@ read:
                 goto skip_evict;
 
             /*
-             * Forcibly evict pages that are too big.
+             * Forcibly evict pages that are too big. If the session hands eviction off to the
+             * eviction threads, queue the page for urgent eviction instead.
              */
             if (force_attempts < 10 && __evict_force_check(session, ref)) {
+                if (__wt_evict_app_handoff(session)) {
+                    WT_IGNORE_RET(__wt_evict_page_urgent(session, ref));
+                    goto skip_evict;
+                }
                 ++force_attempts;
                 ret = __wt_page_release_evict(session, ref, 0);
                 /*
@@ -510,7 +527,15 @@ skip_evict:
                     session->pf.prefetch_disk_read_count = 0;
             }
 
-            __wt_evict_touch_page(session, page, LF_ISSET(WT_READ_INTERNAL_OP), wont_need);
+            __wt_evict_touch_page(session, ref, LF_ISSET(WT_READ_INTERNAL_OP), wont_need);
+
+            /* Don't trace lookups of pages known to be in the cache, eviction walks use them. */
+            if (!LF_ISSET(WT_READ_CACHE) && __wt_evict_trace_enabled(session)) {
+                __wt_evict_trace_page(btree, ref,
+                  read_from_disk ? WT_EVICT_TRACE_READ : WT_EVICT_TRACE_ACCESS,
+                  LF_ISSET(WT_READ_PREFETCH) ? WT_EVICT_TRACE_PREFETCH : 0, &trace);
+                __wt_evict_trace_add(session, &trace);
+            }
 
             /*
              * Check if we need an autocommit transaction. Starting a transaction can trigger
@@ -1999,6 +1999,10 @@ __split_insert(WT_SESSION_IMPL *session, WT_REF *ref)
      * Split into the parent.
      */
     if ((ret = __split_parent(session, ref, split_ref, 2, parent_incr, false, true)) == 0) {
+        /* The page moved to a new reference, update its dirty page index entry. */
+        if (F_ISSET_ATOMIC_16(page, WT_PAGE_EVICT_DIRTY_INDEX))
+            __wt_evict_dirty_index_move(session, page, split_ref[0]);
+
         WT_STAT_CONN_DSRC_INCR(session, cache_inmem_split);
         return (0);
     }
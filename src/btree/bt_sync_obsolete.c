@@ -12,6 +12,20 @@
 #define WT_CHECKPOINT_CLEANUP_FILE_INTERVAL 1            /* 1 second */
 #define WT_URI_FILE_PREFIX "file:"
 
+/*
+ * WT_CC_WALK --
+ *     A checkpoint cleanup walk of a share of a tree: the subtrees below the root page's children
+ *     whose slot, modulo the number of walks, is the walk's ID.
+ */
+typedef struct {
+    WT_SESSION_IMPL *session;
+    const char *uri;
+    u_int id, count;
+
+    wt_thread_t tid;
+    int ret;
+} WT_CC_WALK;
+
 /*
  * __sync_obsolete_limit_reached --
  *     This function checks whether checkpoint cleanup can continue operating on the obsolete time
@@ -390,12 +404,20 @@ __checkpoint_cleanup_page_skip(
   WT_SESSION_IMPL *session, WT_REF *ref, void *context, bool visible_all, bool *skipp)
 {
     WT_ADDR_COPY addr;
+    WT_CC_WALK *walk;
 
-    WT_UNUSED(context);
     WT_UNUSED(visible_all);
 
+    walk = context;
     *skipp = false; /* Default to reading */
 
+    /* Skip subtrees belonging to the other walks of a tree walked in parallel. */
+    if (walk != NULL && walk->count > 1 && ref->home == S2BT(session)->root.page &&
+      ref->pindex_hint % walk->count != walk->id) {
+        *skipp = true;
+        return (0);
+    }
+
     /*
      * Skip deleted pages as they are no longer required for the checkpoint. The checkpoint never
      * needs to review the content of those pages - if they should be included in the checkpoint the
@@ -478,10 +500,10 @@ __checkpoint_cleanup_page_skip(
 
 /*
  * __checkpoint_cleanup_walk_btree --
- *     Check and perform checkpoint cleanup on the uri.
+ *     Check and perform checkpoint cleanup on the uri, or on a share of it if a walk is specified.
  */
 static int
-__checkpoint_cleanup_walk_btree(WT_SESSION_IMPL *session, WT_ITEM *uri)
+__checkpoint_cleanup_walk_btree(WT_SESSION_IMPL *session, const char *uri, WT_CC_WALK *walk)
 {
     WT_BTREE *btree;
     WT_DECL_RET;
@@ -497,15 +519,14 @@ __checkpoint_cleanup_walk_btree(WT_SESSION_IMPL *session, WT_ITEM *uri)
      */
     WT_WITHOUT_DHANDLE(session,
       WT_WITH_HANDLE_LIST_READ_LOCK(
-        session, (ret = __wt_conn_dhandle_find(session, uri->data, NULL))));
+        session, (ret = __wt_conn_dhandle_find(session, uri, NULL))));
     if (ret == WT_NOTFOUND)
         return (0);
 
     /* Open a handle for processing. */
-    ret = __wt_session_get_dhandle(session, uri->data, NULL, NULL, 0);
+    ret = __wt_session_get_dhandle(session, uri, NULL, NULL, 0);
     if (ret != 0) {
-        __wt_verbose_debug1(session, WT_VERB_CHECKPOINT_CLEANUP, "%s: unable to open handle%s",
-          (char *)uri->data,
+        __wt_verbose_debug1(session, WT_VERB_CHECKPOINT_CLEANUP, "%s: unable to open handle%s", uri,
           ret == EBUSY ? ", error indicates handle is unavailable due to concurrent use" : "");
         return (ret);
     }
@@ -524,9 +545,13 @@ __checkpoint_cleanup_walk_btree(WT_SESSION_IMPL *session, WT_ITEM *uri)
 
     /* Walk the tree. */
     while ((ret = __wt_tree_walk_custom_skip(
-              session, &ref, __checkpoint_cleanup_page_skip, NULL, flags)) == 0 &&
+              session, &ref, __checkpoint_cleanup_page_skip, walk, flags)) == 0 &&
       ref != NULL) {
         if (F_ISSET(ref, WT_REF_FLAG_INTERNAL)) {
+            /* Every walk of a tree split between threads returns the root, the first cleans it. */
+            if (walk != NULL && walk->id != 0 && __wt_ref_is_root(ref))
+                continue;
+
             WT_WITH_PAGE_INDEX(session, ret = __checkpoint_cleanup_obsolete_cleanup(session, ref));
         } else {
             WT_ENTER_GENERATION(session, WT_GEN_SPLIT);
@@ -547,6 +572,59 @@ err:
     return (ret);
 }
 
+/*
+ * __checkpoint_cleanup_walk_thread --
+ *     Thread to perform checkpoint cleanup on a share of a tree.
+ */
+static WT_THREAD_RET
+__checkpoint_cleanup_walk_thread(void *arg)
+{
+    WT_CC_WALK *walk;
+
+    walk = arg;
+    walk->ret = __checkpoint_cleanup_walk_btree(walk->session, walk->uri, walk);
+    return (WT_THREAD_RET_VALUE);
+}
+
+/*
+ * __checkpoint_cleanup_walk_parallel --
+ *     Perform checkpoint cleanup on the uri, splitting the tree between the history store walk
+ *     threads. The cleanup thread walks the first share itself.
+ */
+static int
+__checkpoint_cleanup_walk_parallel(WT_SESSION_IMPL *session, const char *uri)
+{
+    WT_CC_WALK walks[WT_CHECKPOINT_CLEANUP_HS_THREADS_MAX];
+    WT_CHECKPOINT_CLEANUP *cc;
+    WT_DECL_RET;
+    u_int i, started;
+
+    cc = &S2C(session)->cc_cleanup;
+
+    for (i = 0; i < cc->hs_threads; ++i) {
+        WT_CLEAR(walks[i]);
+        walks[i].session = i == 0 ? session : cc->hs_sessions[i - 1];
+        walks[i].uri = uri;
+        walks[i].id = i;
+        walks[i].count = cc->hs_threads;
+    }
+
+    for (started = 1; started < cc->hs_threads; ++started)
+        WT_ERR(__wt_thread_create(
+          session, &walks[started].tid, __checkpoint_cleanup_walk_thread, &walks[started]));
+    WT_STAT_CONN_INCR(session, checkpoint_cleanup_hs_parallel);
+
+    ret = __checkpoint_cleanup_walk_btree(session, uri, &walks[0]);
+
+err:
+    /* Return the first failure, a busy or missing tree is reported by every walk. */
+    for (i = 1; i < started; ++i) {
+        WT_TRET(__wt_thread_join(session, &walks[i].tid));
+        WT_TRET(walks[i].ret);
+    }
+    return (ret);
+}
+
 /*
  * __checkpoint_cleanup_eligibility --
  *     Function to check whether the specified URI is eligible for checkpoint cleanup.
@@ -709,11 +787,17 @@ __checkpoint_cleanup_int(WT_SESSION_IMPL *session)
     WT_DECL_ITEM(uri);
     WT_DECL_RET;
 
+    /* Truncate the history store content of files dropped since the last pass. */
+    WT_RET(__wt_hs_btree_truncate_dropped(session, __checkpoint_cleanup_run_chk));
+
     WT_RET(__wt_scr_alloc(session, 1024, &uri));
     WT_ERR(__wt_buf_set(session, uri, WT_URI_FILE_PREFIX, strlen(WT_URI_FILE_PREFIX) + 1));
 
     while ((ret = __checkpoint_cleanup_get_uri(session, uri)) == 0) {
-        ret = __checkpoint_cleanup_walk_btree(session, uri);
+        if (S2C(session)->cc_cleanup.hs_threads > 1 && strcmp(uri->data, WT_HS_URI) == 0)
+            ret = __checkpoint_cleanup_walk_parallel(session, uri->data);
+        else
+            ret = __checkpoint_cleanup_walk_btree(session, uri->data, NULL);
         if (ret == ENOENT || ret == EBUSY) {
             __wt_verbose_debug1(session, WT_VERB_CHECKPOINT_CLEANUP,
               "%s: skipped performing checkpoint cleanup because the file %s", (char *)uri->data,
@@ -800,6 +884,7 @@ __wt_checkpoint_cleanup_create(WT_SESSION_IMPL *session, const char *cfg[])
     WT_CONFIG_ITEM cval;
     WT_CONNECTION_IMPL *conn;
     uint32_t session_flags;
+    u_int i;
 
     conn = S2C(session);
 
@@ -816,6 +901,9 @@ __wt_checkpoint_cleanup_create(WT_SESSION_IMPL *session, const char *cfg[])
     WT_RET(__wt_config_gets(session, cfg, "checkpoint_cleanup.wait", &cval));
     conn->cc_cleanup.interval = (uint64_t)cval.val;
 
+    WT_RET(__wt_config_gets(session, cfg, "checkpoint_cleanup.history_store_threads", &cval));
+    conn->cc_cleanup.hs_threads = (u_int)cval.val;
+
     /*
      * Checkpoint cleanup does enough I/O it may be called upon to perform slow operations for the
      * block manager.
@@ -825,6 +913,15 @@ __wt_checkpoint_cleanup_create(WT_SESSION_IMPL *session, const char *cfg[])
       conn, "checkpoint-cleanup", true, session_flags, 0, &conn->cc_cleanup.session));
     session = conn->cc_cleanup.session;
 
+    /* The cleanup thread walks one share of the history store, the others get their own session. */
+    if (conn->cc_cleanup.hs_threads > 1) {
+        WT_RET(
+          __wt_calloc_def(session, conn->cc_cleanup.hs_threads - 1, &conn->cc_cleanup.hs_sessions));
+        for (i = 0; i < conn->cc_cleanup.hs_threads - 1; ++i)
+            WT_RET(__wt_open_internal_session(conn, "checkpoint-cleanup-hs", true, session_flags,
+              0, &conn->cc_cleanup.hs_sessions[i]));
+    }
+
     WT_RET(__wt_cond_alloc(session, "checkpoint cleanup", &conn->cc_cleanup.cond));
 
     WT_RET(__wt_thread_create(session, &conn->cc_cleanup.tid, __checkpoint_cleanup, session));
@@ -842,6 +939,7 @@ __wt_checkpoint_cleanup_destroy(WT_SESSION_IMPL *session)
 {
     WT_CONNECTION_IMPL *conn;
     WT_DECL_RET;
+    u_int i;
 
     conn = S2C(session);
 
@@ -853,7 +951,13 @@ __wt_checkpoint_cleanup_destroy(WT_SESSION_IMPL *session)
     }
     __wt_cond_destroy(session, &conn->cc_cleanup.cond);
 
-    /* Close the server thread's session. */
+    /* Close the server thread's sessions. */
+    if (conn->cc_cleanup.hs_sessions != NULL) {
+        for (i = 0; i < conn->cc_cleanup.hs_threads - 1; ++i)
+            if (conn->cc_cleanup.hs_sessions[i] != NULL)
+                WT_TRET(__wt_session_close_internal(conn->cc_cleanup.hs_sessions[i]));
+        __wt_free(session, conn->cc_cleanup.hs_sessions);
+    }
     if (conn->cc_cleanup.session != NULL) {
         WT_TRET(__wt_session_close_internal(conn->cc_cleanup.session));
         conn->cc_cleanup.session = NULL;
@@ -68,6 +68,7 @@ int
 __wt_verify_dsk_image(WT_SESSION_IMPL *session, const char *tag, const WT_PAGE_HEADER *dsk,
   size_t size, WT_ADDR *addr, uint32_t verify_flags)
 {
+    WT_BTREE *btree;
     uint8_t flags;
     const uint8_t *end, *p;
 
@@ -139,9 +140,13 @@ __wt_verify_dsk_image(WT_SESSION_IMPL *session, const char *tag, const WT_PAGE_H
     if (flags != 0)
         WT_RET_VRFY(session, "page at %s has invalid flags set: 0x%" PRIx8, tag, flags);
 
-    /* Check the unused byte. */
-    if (dsk->unused != 0)
-        WT_RET_VRFY(session, "page at %s has non-zero unused page header bytes", tag);
+    /* Check the compressor byte against the tree's adaptive compressors. */
+    btree = S2BT_SAFE(session);
+    if (dsk->compressor != WT_PAGE_COMPRESSOR_DEFAULT &&
+      dsk->compressor != WT_PAGE_COMPRESSOR_NONE &&
+      (btree == NULL || dsk->compressor > btree->compressor_adaptive_count))
+        WT_RET_VRFY(
+          session, "page at %s has an invalid compressor of %" PRIu8, tag, dsk->compressor);
 
     /* Check the page version. */
     switch (dsk->version) {
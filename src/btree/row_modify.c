@@ -278,6 +278,10 @@ __wt_row_modify(WT_CURSOR_BTREE *cbt, const WT_ITEM *key, const WT_ITEM *value,
 
     inserted_to_update_chain = true;
 
+    /* Pages being built aren't in the tree yet, don't index them. */
+    if (!exclusive)
+        __wt_evict_page_dirty_index(session, cbt->ref);
+
     /*
      * If the update was successful, add it to the in-memory log.
      *
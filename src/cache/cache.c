@@ -62,12 +62,32 @@ __wt_cache_config(WT_SESSION_IMPL *session, const char *cfg[], bool reconfig)
 int
 __wt_cache_create(WT_SESSION_IMPL *session, const char *cfg[])
 {
+    WT_CACHE *cache;
+    WT_CONFIG_ITEM cval;
+
     WT_ASSERT(session, S2C(session)->cache == NULL);
     WT_RET(__wt_calloc_one(session, &S2C(session)->cache));
+    cache = S2C(session)->cache;
 
     /* Use a common routine for run-time configuration options. */
     WT_RET(__wt_cache_config(session, cfg, false));
 
+    /* NUMA partitioning is only configured when the cache is created. */
+    cache->numa.nodes = 1;
+    WT_RET(__wt_config_gets(session, cfg, "cache_numa", &cval));
+    if (cval.val != 0) {
+#ifdef ENABLE_NUMA
+        WT_RET(__wt_numa_init(session, &cache->numa));
+        __wt_verbose_info(
+          session, WT_VERB_EVICTION, "cache partitioned across %u NUMA nodes", cache->numa.nodes);
+#else
+        WT_RET_MSG(session, EINVAL, "cache_numa requires a build with NUMA support");
+#endif
+    }
+
+    /* The huge page arena is sized from the cache, configure it once the cache size is known. */
+    WT_RET(__wt_huge_arena_acquire(session, cfg));
+
     /*
      * We get/set some values in the cache statistics (rather than have two copies), configure them.
      */
@@ -121,6 +141,9 @@ __wt_cache_stats_update(WT_SESSION_IMPL *session)
     WT_STATP_CONN_SET(session, stats, cache_bytes_leaf, leaf);
     WT_STATP_CONN_SET(session, stats, cache_bytes_other, __wt_cache_bytes_other(cache));
     WT_STATP_CONN_SET(session, stats, cache_bytes_updates, __wt_cache_bytes_updates(cache));
+    if (conn->huge_arena != NULL)
+        WT_STATP_CONN_SET(session, stats, cache_huge_arena_bytes,
+          __wt_atomic_load64(&conn->huge_arena->bytes_inuse));
 
     WT_STATP_CONN_SET(
       session, stats, cache_pages_dirty, cache->pages_dirty_intl + cache->pages_dirty_leaf);
@@ -170,6 +193,7 @@ __wt_cache_destroy(WT_SESSION_IMPL *session)
             __wt_atomic_load64(&cache->bytes_dirty_leaf),
           cache->pages_dirty_intl + cache->pages_dirty_leaf);
 
+    __wt_numa_destroy(session, &cache->numa);
     __wt_free(session, conn->cache);
     return (0);
 }
@@ -26,13 +26,32 @@
 /* Balancing passes after a reduction before a connection is a candidate. */
 #define WT_CACHE_POOL_REDUCE_SKIPS 10
 
+/* How long the manager waits between passes, and while application threads are evicting. */
+#define WT_CACHE_POOL_BURST_WAIT (100 * WT_THOUSAND)
+#define WT_CACHE_POOL_WAIT WT_MILLION
+
 /*
  * Constants that control how much influence different metrics have on the pressure calculation.
+ * Time application threads spend evicting is counted in milliseconds.
  */
 #define WT_CACHE_POOL_APP_EVICT_MULTIPLIER 3
+#define WT_CACHE_POOL_APP_TIME_MULTIPLIER 3
 #define WT_CACHE_POOL_APP_WAIT_MULTIPLIER 6
 #define WT_CACHE_POOL_READ_MULTIPLIER 1
 
+/*
+ * Marginal utility: after a connection's cache grows, the fall in its read rate is compared with
+ * the growth, as a percentage (100 when reads fall by the same proportion the cache grew). The
+ * smoothed gain scales the connection's pressure, between a minimum, so growth that takes a while
+ * to pay off doesn't starve a connection, and a maximum.
+ */
+#define WT_CACHE_POOL_GAIN_DEFAULT 100
+#define WT_CACHE_POOL_GAIN_MAX 200
+#define WT_CACHE_POOL_GAIN_MIN 25
+
+/* A connection with the default priority has its pressure unscaled. */
+#define WT_CACHE_POOL_PRIORITY_DEFAULT 50
+
 static void __cache_pool_adjust(WT_SESSION_IMPL *, uint64_t, uint64_t, bool, bool *);
 static void __cache_pool_assess(WT_SESSION_IMPL *, uint64_t *);
 static void __cache_pool_balance(WT_SESSION_IMPL *, bool);
@@ -51,6 +70,7 @@ __cache_pool_config(WT_SESSION_IMPL *session, const char **cfg)
     WT_CONNECTION_IMPL *conn, *entry;
     WT_DECL_RET;
     uint64_t chunk, quota, reserve, size, used_cache;
+    uint32_t priority;
     char *pool_name;
     bool cp_locked, created, updating;
 
@@ -171,6 +191,14 @@ __cache_pool_config(WT_SESSION_IMPL *session, const char **cfg)
     else
         reserve = chunk;
 
+    /* The priority follows the reserve size: keep the previous value if reconfiguring. */
+    if (__wt_config_gets(session, &cfg[1], "shared_cache.priority", &cval) == 0 && cval.val != 0)
+        priority = (uint32_t)cval.val;
+    else if (updating)
+        priority = conn->cache->cp_priority;
+    else
+        priority = WT_CACHE_POOL_PRIORITY_DEFAULT;
+
     /*
      * Validate that size and reserve values don't cause the cache pool to be over subscribed.
      */
@@ -195,6 +223,9 @@ __cache_pool_config(WT_SESSION_IMPL *session, const char **cfg)
 
     conn->cache->cp_reserved = reserve;
     conn->cache->cp_quota = quota;
+    conn->cache->cp_priority = priority;
+    if (!updating)
+        conn->cache->cp_gain = WT_CACHE_POOL_GAIN_DEFAULT;
     __wt_spin_unlock(session, &cp->cache_pool_lock);
     cp_locked = false;
 
@@ -246,7 +277,8 @@ __cache_pool_server(void *arg)
     while (F_ISSET(cp, WT_CACHE_POOL_ACTIVE) &&
       FLD_ISSET_ATOMIC_16(cache->pool_flags_atomic, WT_CACHE_POOL_RUN)) {
         if (cp->currently_used <= cp->size)
-            __wt_cond_wait(session, cp->cache_pool_cond, WT_MILLION, NULL);
+            __wt_cond_wait(session, cp->cache_pool_cond,
+              cp->burst ? WT_CACHE_POOL_BURST_WAIT : WT_CACHE_POOL_WAIT, NULL);
 
         /*
          * Re-check pool run flag - since we want to avoid getting the lock on shutdown.
@@ -353,6 +385,22 @@ __wt_cache_pool_create(WT_SESSION_IMPL *session, const char *cfg[])
     return (0);
 }
 
+/*
+ * __wt_cache_pool_wake --
+ *     Wake the shared cache manager when application threads start evicting pages, rather than
+ *     waiting for its next pass.
+ */
+void
+__wt_cache_pool_wake(WT_SESSION_IMPL *session)
+{
+    WT_CACHE_POOL *cp;
+
+    /* The manager saw the burst on its last pass, and is already checking more often. */
+    if (S2C(session)->cache->cp_burst || (cp = __wt_process.cache_pool) == NULL)
+        return;
+    __wt_cond_signal(session, cp->cache_pool_cond);
+}
+
 /*
  * __wt_cache_pool_destroy --
  *     Remove our resources from the shared cache pool. Remove the cache pool if we were the last
@@ -534,12 +582,13 @@ __cache_pool_assess(WT_SESSION_IMPL *session, uint64_t *phighest)
     WT_CACHE_POOL *cp;
     WT_CONNECTION_IMPL *entry;
     WT_EVICT *evict;
-    uint64_t app_evicts, app_waits, reads;
+    uint64_t app_evicts, app_time_us, app_waits, dirty_pct, reads;
     uint64_t balanced_size, entries, highest, tmp;
 
     cp = __wt_process.cache_pool;
     balanced_size = entries = 0;
     highest = 1; /* Avoid divide by zero */
+    cp->burst = false;
 
     TAILQ_FOREACH (entry, &cp->cache_pool_qh, cpq) {
         if (entry->cache_size == 0 || entry->cache == NULL)
@@ -586,23 +635,61 @@ __cache_pool_assess(WT_SESSION_IMPL *session, uint64_t *phighest)
             app_waits = (UINT64_MAX - cache->cp_saved_app_waits) + tmp;
         cache->cp_saved_app_waits = tmp;
 
+        /* Update the time application threads spent evicting */
+        tmp = evict->app_time_us;
+        if (tmp >= cache->cp_saved_app_time_us)
+            app_time_us = tmp - cache->cp_saved_app_time_us;
+        else
+            app_time_us = (UINT64_MAX - cache->cp_saved_app_time_us) + tmp;
+        cache->cp_saved_app_time_us = tmp;
+
+        cache->cp_read_rate = (3 * cache->cp_read_rate + reads) / 4;
+
         /* Calculate the weighted pressure for this member. */
         tmp = (app_evicts * WT_CACHE_POOL_APP_EVICT_MULTIPLIER) +
-          (app_waits * WT_CACHE_POOL_APP_WAIT_MULTIPLIER) + (reads * WT_CACHE_POOL_READ_MULTIPLIER);
+          (app_waits * WT_CACHE_POOL_APP_WAIT_MULTIPLIER) +
+          (reads * WT_CACHE_POOL_READ_MULTIPLIER) +
+          (app_time_us / WT_THOUSAND * WT_CACHE_POOL_APP_TIME_MULTIPLIER);
+
+        /*
+         * Dirty content approaching the dirty trigger stalls application threads even if few pages
+         * are read: up to double the pressure of a connection whose dirty content reached the
+         * trigger.
+         */
+        dirty_pct = (100 * __wt_cache_dirty_leaf_inuse(cache)) /
+          (uint64_t)((entry->cache_size * evict->eviction_dirty_trigger) / 100 + 1);
+        tmp += tmp * WT_MIN(dirty_pct, 100) / 100;
+
+        /* Scale by how much growing this cache has reduced its reads, and by its priority. */
+        tmp = tmp * cache->cp_gain / 100;
+        tmp = tmp * cache->cp_priority / WT_CACHE_POOL_PRIORITY_DEFAULT;
 
         /* Weight smaller caches higher. */
         tmp = (uint64_t)(tmp * ((double)balanced_size / entry->cache_size));
 
-        /* Smooth over history. */
-        cache->cp_pass_pressure = (9 * cache->cp_pass_pressure + tmp) / 10;
+        /*
+         * Smooth over history, but let the pressure rise quickly so a burst of demand is answered
+         * within a few passes, while it falls slowly.
+         */
+        if (tmp > cache->cp_pass_pressure)
+            cache->cp_pass_pressure = (cache->cp_pass_pressure + tmp) / 2;
+        else
+            cache->cp_pass_pressure = (9 * cache->cp_pass_pressure + tmp) / 10;
 
         if (cache->cp_pass_pressure > highest)
             highest = cache->cp_pass_pressure;
 
+        /* Application threads evicting pages is a burst: the manager checks again sooner. */
+        cache->cp_burst = app_evicts > 0 || app_waits > 0;
+        if (cache->cp_burst)
+            cp->burst = true;
+
         __wt_verbose_debug2(session, WT_VERB_SHARED_CACHE,
           "Assess entry. reads: %" PRIu64 ", app evicts: %" PRIu64 ", app waits: %" PRIu64
-          ", pressure: %" PRIu64,
-          reads, app_evicts, app_waits, cache->cp_pass_pressure);
+          ", app eviction time (us): %" PRIu64 ", dirty: %" PRIu64 "%%, gain: %" PRIu32
+          ", priority: %" PRIu32 ", pressure: %" PRIu64,
+          reads, app_evicts, app_waits, app_time_us, WT_MIN(dirty_pct, 100), cache->cp_gain,
+          cache->cp_priority, cache->cp_pass_pressure);
     }
     __wt_verbose(session, WT_VERB_SHARED_CACHE,
       "Highest eviction count: %" PRIu64 ", entries: %" PRIu64, highest, entries);
@@ -610,6 +697,35 @@ __cache_pool_assess(WT_SESSION_IMPL *session, uint64_t *phighest)
     *phighest = highest;
 }
 
+/*
+ * __cache_pool_gain --
+ *     Once a grown cache has settled, compare the fall in its read rate with its growth, and update
+ *     its smoothed gain.
+ */
+static void
+__cache_pool_gain(WT_CONNECTION_IMPL *entry)
+{
+    WT_CACHE *cache;
+    uint64_t growth, reduction, sample;
+
+    cache = entry->cache;
+    if (cache->cp_grow_read_rate == 0)
+        return;
+
+    /* Measured in hundredths of a percent, the growth is typically a small part of the cache. */
+    if (entry->cache_size > cache->cp_grow_size && cache->cp_grow_size != 0) {
+        growth =
+          ((entry->cache_size - cache->cp_grow_size) * 10 * WT_THOUSAND) / cache->cp_grow_size;
+        reduction = cache->cp_read_rate < cache->cp_grow_read_rate ?
+          ((cache->cp_grow_read_rate - cache->cp_read_rate) * 10 * WT_THOUSAND) /
+            cache->cp_grow_read_rate :
+          0;
+        sample = WT_MIN((reduction * 100) / WT_MAX(growth, 1), WT_CACHE_POOL_GAIN_MAX);
+        cache->cp_gain = (uint32_t)WT_MAX((cache->cp_gain + sample) / 2, WT_CACHE_POOL_GAIN_MIN);
+    }
+    cache->cp_grow_read_rate = cache->cp_grow_size = 0;
+}
+
 /*
  * __cache_pool_adjust --
  *     Adjust the allocation of cache to each connection. If full is set ignore cache load
@@ -644,7 +760,7 @@ __cache_pool_adjust(WT_SESSION_IMPL *session, uint64_t highest, uint64_t bump_th
         __wt_verbose(session, WT_VERB_SHARED_CACHE, "%s", "Cache pool distribution: ");
         __wt_verbose(session, WT_VERB_SHARED_CACHE, "%s",
           "\t"
-          "cache (MB), pressure, skips, busy, %% full:");
+          "cache (MB), pressure, skips, busy, burst, %% full:");
     }
 
     for (entry = forward ? TAILQ_FIRST(&cp->cache_pool_qh) :
@@ -665,12 +781,17 @@ __cache_pool_adjust(WT_SESSION_IMPL *session, uint64_t highest, uint64_t bump_th
         busy = __wt_evict_needed(entry->default_session, false, true, &pct_full);
 
         __wt_verbose_debug2(session, WT_VERB_SHARED_CACHE,
-          "\t%5" PRIu64 ", %3" PRIu64 ", %2" PRIu32 ", %d, %2.3f", entry->cache_size >> 20,
-          pressure, cache->cp_skip_count, busy, pct_full);
+          "\t%5" PRIu64 ", %3" PRIu64 ", %2" PRIu32 ", %d, %d, %2.3f", entry->cache_size >> 20,
+          pressure, cache->cp_skip_count, busy, cache->cp_burst, pct_full);
 
-        /* Allow to stabilize after changes. */
-        if (cache->cp_skip_count > 0 && --cache->cp_skip_count > 0)
+        /*
+         * Allow to stabilize after changes, unless application threads are evicting and there is
+         * space in the pool to grow into.
+         */
+        if (cache->cp_skip_count > 0 && --cache->cp_skip_count > 0 &&
+          (!cache->cp_burst || pool_full))
             continue;
+        __cache_pool_gain(entry);
 
         /*
          * The bump threshold decreases as we try longer to balance the pool. Adjust how
@@ -721,20 +842,29 @@ __cache_pool_adjust(WT_SESSION_IMPL *session, uint64_t highest, uint64_t bump_th
             smallest = (uint64_t)((100 * __wt_cache_bytes_inuse(cache)) / evict->eviction_trigger);
             if (entry->cache_size > smallest)
                 adjustment = WT_MIN(cp->chunk, (entry->cache_size - smallest) / 2);
+            /*
+             * An idle participant's cache stays full of pages no one reads, and would never shrink:
+             * give back a chunk regardless of how much of the cache is in use.
+             */
+            else if (pressure == 0 && highest > 1 && !busy)
+                adjustment = cp->chunk;
             adjustment = WT_MIN(adjustment, entry->cache_size - reserved);
             /*
              * Conditions for increasing the amount of resources for an
              * entry:
              *  - there is space available in the pool
              *  - the connection isn't over quota
-             *  - the connection is using enough cache to require eviction
+             *  - the connection is using enough cache to require eviction, or its application
+             *    threads are evicting pages (dirty content or updates can require eviction before
+             *    the cache is full)
              *  - there was some activity across the pool
              *  - this entry is using less than the entire cache pool
              *  - additional cache would benefit the connection OR
              *  - the pool is less than half distributed
              */
         } else if (!pool_full && (cache->cp_quota == 0 || entry->cache_size < cache->cp_quota) &&
-          __wt_cache_bytes_inuse(cache) >= (entry->cache_size * evict->eviction_target) / 100 &&
+          (cache->cp_burst ||
+            __wt_cache_bytes_inuse(cache) >= (entry->cache_size * evict->eviction_target) / 100) &&
           (pressure > bump_threshold || cp->currently_used < cp->size * 0.5)) {
             grow = true;
             adjustment = WT_MIN(WT_MIN(cp->chunk, cp->size - cp->currently_used),
@@ -751,6 +881,11 @@ __cache_pool_adjust(WT_SESSION_IMPL *session, uint64_t highest, uint64_t bump_th
         if (adjustment > 0) {
             *adjustedp = true;
             if (grow) {
+                /* Measure the growth's effect on reads once the cache settles. */
+                if (cache->cp_grow_read_rate == 0 && entry->cache_size >= reserved) {
+                    cache->cp_grow_read_rate = WT_MAX(cache->cp_read_rate, 1);
+                    cache->cp_grow_size = entry->cache_size;
+                }
                 cache->cp_skip_count = WT_CACHE_POOL_BUMP_SKIPS;
                 entry->cache_size += adjustment;
                 cp->currently_used += adjustment;
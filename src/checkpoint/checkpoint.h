@@ -157,6 +157,10 @@ struct __wt_checkpoint_cleanup {
     int tid_set;              /* checkpoint cleanup thread set */
     WT_CONDVAR *cond;         /* checkpoint cleanup wait mutex */
     uint64_t interval;        /* Checkpoint cleanup interval */
+
+#define WT_CHECKPOINT_CLEANUP_HS_THREADS_MAX 20
+    WT_SESSION_IMPL **hs_sessions; /* History store walk sessions */
+    u_int hs_threads;              /* History store walk threads */
 };
 
 /* DO NOT EDIT: automatically built by prototypes.py: BEGIN */
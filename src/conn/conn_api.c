@@ -183,12 +183,13 @@ __wti_conn_remove_collator(WT_SESSION_IMPL *session)
  *     Validate the compressor.
  */
 static int
-__compressor_confchk(WT_SESSION_IMPL *session, WT_CONFIG_ITEM *cval, WT_COMPRESSOR **compressorp)
+__compressor_confchk(
+  WT_SESSION_IMPL *session, WT_CONFIG_ITEM *cval, WT_NAMED_COMPRESSOR **ncompressorp)
 {
     WT_CONNECTION_IMPL *conn;
     WT_NAMED_COMPRESSOR *ncomp;
 
-    *compressorp = NULL;
+    *ncompressorp = NULL;
 
     if (cval->len == 0 || WT_CONFIG_LIT_MATCH("none", *cval))
         return (0);
@@ -196,7 +197,7 @@ __compressor_confchk(WT_SESSION_IMPL *session, WT_CONFIG_ITEM *cval, WT_COMPRESS
     conn = S2C(session);
     TAILQ_FOREACH (ncomp, &conn->compqh, q)
         if (WT_CONFIG_MATCH(ncomp->name, *cval)) {
-            *compressorp = ncomp->compressor;
+            *ncompressorp = ncomp;
             return (0);
         }
     WT_RET_MSG(session, EINVAL, "unknown compressor '%.*s'", (int)cval->len, cval->str);
@@ -209,7 +210,83 @@ __compressor_confchk(WT_SESSION_IMPL *session, WT_CONFIG_ITEM *cval, WT_COMPRESS
 int
 __wt_compressor_config(WT_SESSION_IMPL *session, WT_CONFIG_ITEM *cval, WT_COMPRESSOR **compressorp)
 {
-    return (__compressor_confchk(session, cval, compressorp));
+    WT_NAMED_COMPRESSOR *ncomp;
+
+    *compressorp = NULL;
+
+    WT_RET(__compressor_confchk(session, cval, &ncomp));
+    if (ncomp != NULL)
+        *compressorp = ncomp->compressor;
+    return (0);
+}
+
+/*
+ * __wt_compressor_config_custom --
+ *     Given a compressor name and the compressor's configuration, return a compressor customized
+ *     for that configuration. Compressors customized with the same configuration are shared. The
+ *     key naming the compressor is used in error messages.
+ */
+int
+__wt_compressor_config_custom(WT_SESSION_IMPL *session, const char *key, WT_CONFIG_ITEM *cval,
+  WT_CONFIG_ITEM *ccfg, WT_COMPRESSOR **compressorp)
+{
+    WT_COMPRESSOR *compressor, *custom;
+    WT_CONNECTION_IMPL *conn;
+    WT_CUSTOM_COMPRESSOR *ccomp;
+    WT_DECL_RET;
+    WT_NAMED_COMPRESSOR *ncomp;
+    const char *comp_cfg[] = {NULL, NULL};
+
+    *compressorp = NULL;
+
+    ccomp = NULL;
+    conn = S2C(session);
+
+    WT_RET(__compressor_confchk(session, cval, &ncomp));
+    if (ncomp == NULL) {
+        if (ccfg->len != 0)
+            WT_RET_MSG(session, EINVAL, "%s_config requires %s to be set", key, key);
+        return (0);
+    }
+    compressor = ncomp->compressor;
+    if (ccfg->len == 0) {
+        *compressorp = compressor;
+        return (0);
+    }
+    if (compressor->customize == NULL)
+        WT_RET_MSG(
+          session, EINVAL, "compressor '%s' does not support %s_config", ncomp->name, key);
+
+    __wt_spin_lock(session, &conn->compressor_lock);
+
+    TAILQ_FOREACH (ccomp, &ncomp->customqh, q)
+        if (WT_CONFIG_MATCH(ccomp->config, *ccfg))
+            goto out;
+
+    WT_ERR(__wt_calloc_one(session, &ccomp));
+    WT_ERR(__wt_strndup(session, ccfg->str, ccfg->len, &ccomp->config));
+    comp_cfg[0] = ccomp->config;
+    custom = NULL;
+    WT_ERR(compressor->customize(compressor, &session->iface, (WT_CONFIG_ARG *)comp_cfg, &custom));
+    if (custom != NULL) {
+        ccomp->owned = 1;
+        compressor = custom;
+    }
+    ccomp->compressor = compressor;
+    TAILQ_INSERT_HEAD(&ncomp->customqh, ccomp, q);
+
+out:
+    __wt_spin_unlock(session, &conn->compressor_lock);
+    *compressorp = ccomp->compressor;
+    return (0);
+
+err:
+    if (ccomp != NULL) {
+        __wt_free(session, ccomp->config);
+        __wt_free(session, ccomp);
+    }
+    __wt_spin_unlock(session, &conn->compressor_lock);
+    return (ret);
 }
 
 /*
@@ -234,9 +311,17 @@ __conn_add_compressor(
     if (strcmp(name, "none") == 0)
         WT_ERR_MSG(session, EINVAL, "invalid name for a compressor: %s", name);
 
+    /*
+     * Verify that terminate is set if customize is set, customized compressors are terminated when
+     * the connection closes.
+     */
+    if (compressor->customize != NULL && compressor->terminate == NULL)
+        WT_ERR_MSG(session, EINVAL, "compressor: %s: has customize but no terminate", name);
+
     WT_ERR(__wt_calloc_one(session, &ncomp));
     WT_ERR(__wt_strdup(session, name, &ncomp->name));
     ncomp->compressor = compressor;
+    TAILQ_INIT(&ncomp->customqh);
 
     __wt_spin_lock(session, &conn->api_lock);
     TAILQ_INSERT_TAIL(&conn->compqh, ncomp, q);
@@ -260,6 +345,7 @@ int
 __wti_conn_remove_compressor(WT_SESSION_IMPL *session)
 {
     WT_CONNECTION_IMPL *conn;
+    WT_CUSTOM_COMPRESSOR *ccomp;
     WT_DECL_RET;
     WT_NAMED_COMPRESSOR *ncomp;
 
@@ -268,6 +354,17 @@ __wti_conn_remove_compressor(WT_SESSION_IMPL *session)
     while ((ncomp = TAILQ_FIRST(&conn->compqh)) != NULL) {
         /* Remove from the connection's list, free memory. */
         TAILQ_REMOVE(&conn->compqh, ncomp, q);
+        while ((ccomp = TAILQ_FIRST(&ncomp->customqh)) != NULL) {
+            /* Remove from the compressor's list, free memory. */
+            TAILQ_REMOVE(&ncomp->customqh, ccomp, q);
+            /* Call any termination method. */
+            if (ccomp->owned && ccomp->compressor->terminate != NULL)
+                WT_TRET(ccomp->compressor->terminate(ccomp->compressor, (WT_SESSION *)session));
+
+            __wt_free(session, ccomp->config);
+            __wt_free(session, ccomp);
+        }
+
         /* Call any termination method. */
         if (ncomp->compressor->terminate != NULL)
             WT_TRET(ncomp->compressor->terminate(ncomp->compressor, (WT_SESSION *)session));
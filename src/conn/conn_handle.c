@@ -31,6 +31,7 @@ __wti_connection_init(WT_CONNECTION_IMPL *conn)
     TAILQ_INIT(&conn->storagesrcqh);          /* Storage source list */
     TAILQ_INIT(&conn->tieredqh);              /* Tiered work unit list */
     TAILQ_INIT(&conn->pfqh);                  /* Pre-fetch reference list */
+    TAILQ_INIT(&conn->rec_compress_qh);       /* Reconciliation compression list */
 
     /* Random numbers. */
     __wt_session_rng_init_once(session);
@@ -46,6 +47,7 @@ __wti_connection_init(WT_CONNECTION_IMPL *conn)
     WT_SPIN_INIT_TRACKED(session, &conn->checkpoint_lock, checkpoint);
     WT_RET(__wt_spin_init(session, &conn->background_compact.lock, "background compact"));
     WT_RET(__wt_spin_init(session, &conn->chunkcache_metadata_lock, "chunk cache metadata"));
+    WT_RET(__wt_spin_init(session, &conn->compressor_lock, "compressor"));
     WT_RET(__wt_spin_init(session, &conn->encryptor_lock, "encryptor"));
     WT_RET(__wt_spin_init(session, &conn->fh_lock, "file list"));
     WT_RET(__wt_spin_init(session, &conn->flush_tier_lock, "flush tier"));
@@ -56,6 +58,7 @@ __wti_connection_init(WT_CONNECTION_IMPL *conn)
     WT_RET(__wt_spin_init(session, &conn->tiered_lock, "tiered work unit list"));
     WT_RET(__wt_spin_init(session, &conn->turtle_lock, "turtle file"));
     WT_RET(__wt_spin_init(session, &conn->prefetch_lock, "prefetch"));
+    WT_RET(__wt_spin_init(session, &conn->rec_compress_lock, "reconcile compression"));
 
     /* Read-write locks */
     WT_RET(__wt_rwlock_init(session, &conn->debug_log_retention_lock));
@@ -109,6 +112,7 @@ __wti_connection_destroy(WT_CONNECTION_IMPL *conn)
     __wt_spin_destroy(session, &conn->block_lock);
     __wt_spin_destroy(session, &conn->checkpoint_lock);
     __wt_spin_destroy(session, &conn->chunkcache_metadata_lock);
+    __wt_spin_destroy(session, &conn->compressor_lock);
     __wt_rwlock_destroy(session, &conn->debug_log_retention_lock);
     __wt_rwlock_destroy(session, &conn->dhandle_lock);
     __wt_spin_destroy(session, &conn->encryptor_lock);
@@ -123,6 +127,7 @@ __wti_connection_destroy(WT_CONNECTION_IMPL *conn)
     __wt_spin_destroy(session, &conn->tiered_lock);
     __wt_spin_destroy(session, &conn->turtle_lock);
     __wt_spin_destroy(session, &conn->prefetch_lock);
+    __wt_spin_destroy(session, &conn->rec_compress_lock);
 
     /* Free allocated hash buckets. */
     __wt_free(session, conn->blockhash);
@@ -141,5 +146,8 @@ __wti_connection_destroy(WT_CONNECTION_IMPL *conn)
     __wt_free(session, WT_CONN_SESSIONS_GET(conn));
     __wt_stat_connection_discard(session, conn);
 
+    /* Memory is freed throughout connection close, the huge page arena is released last. */
+    WT_IGNORE_RET(__wt_huge_arena_release(session));
+
     __wt_free(NULL, conn);
 }
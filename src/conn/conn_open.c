@@ -102,6 +102,8 @@ __wti_connection_close(WT_CONNECTION_IMPL *conn)
 
     /* The eviction server is shut down last. */
     WT_TRET(__wt_evict_threads_destroy(session));
+    /* Compression threads serve reconciliation, shut them down once eviction is done. */
+    WT_TRET(__wt_rec_compress_destroy(session));
     /* The capacity server can only be shut down after all I/O is complete. */
     WT_TRET(__wti_capacity_server_destroy(session));
 
@@ -284,6 +286,9 @@ __wti_connection_workers(WT_SESSION_IMPL *session, const char *cfg[])
     /* Start pre-fetch utilities. */
     WT_RET(__wti_prefetch_create(session, cfg));
 
+    /* Start the optional reconciliation compression threads. */
+    WT_RET(__wt_rec_compress_create(session, cfg));
+
     /* Start the checkpoint cleanup thread. */
     WT_RET(__wt_checkpoint_cleanup_create(session, cfg));
 
@@ -10,12 +10,63 @@
 
 #include "evict_private.h"
 
+/*
+ * Eviction decision trace file format. A trace file holds a header followed by fixed-size records,
+ * test/simulator/eviction decodes it. Change the version if the format changes.
+ */
+#define WT_EVICT_TRACE_MAGIC 0x57544554 /* "WTET" */
+#define WT_EVICT_TRACE_MAXRECS 4096
+#define WT_EVICT_TRACE_VERSION 1
+
+/*
+ * WT_EVICT_TRACE_HEADER --
+ *     The header of an eviction trace file.
+ */
+struct __wt_evict_trace_header {
+    uint32_t magic;          /* WT_EVICT_TRACE_MAGIC */
+    uint32_t version;        /* WT_EVICT_TRACE_VERSION */
+    uint32_t record_size;    /* Size of a record */
+    uint32_t tsc_nsec_ratio; /* Clock ticks per nanosecond, times one thousand */
+    uint64_t seconds_epoch;  /* Time the trace started */
+    uint64_t cache_size;     /* Cache size when the trace started */
+};
+
+/*
+ * WT_EVICT_TRACE_RECORD --
+ *     A page access or eviction decision. Pages are identified by their tree's ID and the address
+ *     of their WT_REF, which doesn't change while the page is read and evicted. The record is
+ *     padded explicitly so the decoder can rely on its size.
+ */
+struct __wt_evict_trace_record {
+    uint64_t timestamp; /* Clock ticks */
+    uint64_t ref;       /* WT_REF address */
+    uint64_t read_gen;  /* Page read generation */
+    uint32_t btree_id;  /* Tree ID */
+    uint32_t size;      /* Page memory footprint */
+
+#define WT_EVICT_TRACE_ACCESS 1     /* Page found in the cache */
+#define WT_EVICT_TRACE_READ 2       /* Page read into the cache */
+#define WT_EVICT_TRACE_QUEUE 3      /* Page queued for eviction */
+#define WT_EVICT_TRACE_EVICT 4      /* Page evicted */
+#define WT_EVICT_TRACE_EVICT_FAIL 5 /* Page eviction failed */
+    uint8_t type;
+
+#define WT_EVICT_TRACE_APP 0x01u      /* Evicted by an application thread */
+#define WT_EVICT_TRACE_DIRTY 0x02u    /* Page was modified */
+#define WT_EVICT_TRACE_FORCED 0x04u   /* Forced eviction of a large page */
+#define WT_EVICT_TRACE_INTERNAL 0x08u /* Internal page */
+#define WT_EVICT_TRACE_PREFETCH 0x10u /* Read by pre-fetch */
+    uint8_t flags;
+    uint8_t padding[6];
+};
+
 struct __wt_evict {
     wt_shared volatile uint64_t eviction_progress; /* Eviction progress count */
     uint64_t last_eviction_progress;               /* Tracked eviction progress */
 
-    uint64_t app_waits;  /* User threads waited for eviction */
-    uint64_t app_evicts; /* Pages evicted by user threads */
+    uint64_t app_waits;   /* User threads waited for eviction */
+    uint64_t app_evicts;  /* Pages evicted by user threads */
+    uint64_t app_time_us; /* Time user threads spent evicting, in a shared cache */
 
     wt_shared uint64_t evict_max_page_size; /* Largest page seen at eviction */
     wt_shared uint64_t evict_max_ms;        /* Longest milliseconds spent at a single eviction */
@@ -51,6 +102,18 @@ struct __wt_evict {
     double eviction_checkpoint_target; /* Percent to reduce dirty to during checkpoint scrubs */
     wt_shared double eviction_scrub_target; /* Current scrub target */
 
+    /*
+     * Application handoff information: application threads needing space in the cache wait for the
+     * eviction threads instead of evicting pages. Waiting threads take tickets in the order they
+     * arrive, and each page evicted by an eviction thread admits the oldest outstanding ticket.
+     */
+    wt_shared bool app_handoff;              /* Application threads hand off eviction */
+    uint64_t app_handoff_wait_max_us;        /* Longest an application thread waits */
+    WT_CONDVAR *app_handoff_cond;            /* Waiting application threads condition */
+    wt_shared uint64_t app_handoff_admitted; /* Tickets admitted */
+    wt_shared uint64_t app_handoff_tickets;  /* Tickets taken */
+    wt_shared uint32_t app_handoff_waiters;  /* Application threads waiting */
+
     uint64_t cache_max_wait_us;      /* Maximum time an operation waits for space in cache */
     uint64_t cache_stuck_timeout_ms; /* Maximum time the cache can be stuck for in diagnostic mode
                                         before timing out */
@@ -67,6 +130,44 @@ struct __wt_evict {
     bool evict_tune_stable;                      /* Are we stable? */
     uint32_t evict_tune_workers_best;            /* Best performing value */
 
+    /*
+     * Predictive tuning information: the eviction server samples the growth rates of the cache's
+     * content, dirty content and updates, and forecasts their growth over a horizon. The horizon is
+     * extended while application threads are still evicting pages.
+     */
+    wt_shared bool predict;                       /* Predictive tuning configured */
+    wt_shared uint64_t predict_horizon_config_ms; /* Configured forecast horizon */
+    uint64_t predict_horizon_ms;                  /* Current forecast horizon */
+    struct timespec predict_last_time;            /* Time of last sample */
+    uint64_t predict_last_inuse;                  /* Bytes in use at last sample */
+    uint64_t predict_last_dirty;                  /* Dirty bytes at last sample */
+    uint64_t predict_last_updates;                /* Update bytes at last sample */
+    uint64_t predict_last_app;                    /* Application evictions at last sample */
+    double predict_rate_inuse;                    /* Bytes in use per second growth */
+    double predict_rate_dirty;                    /* Dirty bytes per second growth */
+    double predict_rate_updates;                  /* Update bytes per second growth */
+    uint32_t predict_quiet;                       /* Samples without application evictions */
+    uint64_t predict_ckpt_gen;                    /* Checkpoint generation at last sample */
+    bool predict_ckpt_running;                    /* Checkpoint running at last sample */
+    struct timespec predict_ckpt_start;           /* Time the last checkpoint started */
+    uint64_t predict_ckpt_interval_ms;            /* Time between checkpoint starts */
+    uint64_t predict_ckpt_duration_ms;            /* Time the last checkpoint ran */
+    uint64_t predict_inuse_growth;                /* Bytes in use forecast growth */
+    uint64_t predict_dirty_growth;                /* Dirty bytes forecast growth */
+    uint64_t predict_updates_growth;              /* Update bytes forecast growth */
+    uint32_t predict_pressure;                    /* Forecast percent of target to trigger */
+    bool predict_ckpt_soon;                       /* Checkpoint forecast within the horizon */
+
+    /*
+     * Eviction decision trace. Sessions buffer records and append them to the trace file, records
+     * buffered for an earlier trace file are discarded.
+     */
+    wt_shared bool trace;         /* Trace eviction decisions */
+    WT_SPINLOCK trace_lock;       /* Trace file lock */
+    WT_FH *trace_fh;              /* Trace file */
+    wt_off_t trace_offset;        /* Trace file size */
+    wt_shared uint64_t trace_gen; /* Trace file generation */
+
     /*
      * Pass interrupt counter.
      */
@@ -78,6 +179,9 @@ struct __wt_evict {
     WT_SPINLOCK evict_pass_lock;   /* Eviction pass lock */
     WT_SESSION_IMPL *walk_session; /* Eviction pass session */
     WT_DATA_HANDLE *walk_tree;     /* LRU walk current tree */
+    u_int walk_quota_over;         /* Trees over their maximum cache share */
+    uint64_t numa_nodes_over;      /* NUMA nodes over their cache share, a bitmap */
+    u_int walk_quota_over_next;    /* Trees over their maximum share this pass */
 
     WT_SPINLOCK evict_queue_lock; /* Eviction current queue lock */
     WTI_EVICT_QUEUE evict_queues[WTI_EVICT_QUEUE_MAX];
@@ -110,6 +214,23 @@ struct __wt_evict {
      */
     uint32_t evict_empty_score;
 
+    /*
+     * Frequency policy information: a count-min sketch of page reads keyed by WT_REF, with
+     * WT_EVICT_FREQ_ROWS rows of counters. The counters are halved once the sketch has recorded
+     * WT_EVICT_FREQ_AGE reads per counter in a row, so pages that are no longer read lose their
+     * rank.
+     */
+#define WT_EVICT_FREQ_AGE 10
+#define WT_EVICT_FREQ_MAX 15
+#define WT_EVICT_FREQ_PAGE_SIZE (16 * WT_KILOBYTE) /* Cache bytes per counter in a row */
+#define WT_EVICT_FREQ_ROWS 4
+#define WT_EVICT_FREQ_WIDTH_MAX WT_MEGABYTE
+#define WT_EVICT_FREQ_WIDTH_MIN WT_KILOBYTE
+    wt_shared bool freq_policy;          /* Rank pages by read frequency */
+    wt_shared uint8_t *freq_sketch;      /* Sketch counters */
+    uint64_t freq_sketch_width;          /* Counters per row, a power of two */
+    wt_shared uint64_t freq_sketch_adds; /* Reads recorded since the counters were halved */
+
 /*
  * Flags.
  */
@@ -163,13 +284,20 @@ extern int __wt_evict_threads_destroy(WT_SESSION_IMPL *session)
 extern int __wt_verbose_dump_cache(WT_SESSION_IMPL *session)
   WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
 extern void __wt_evict_cache_stat_walk(WT_SESSION_IMPL *session);
+extern void __wt_evict_dirty_index_add(WT_SESSION_IMPL *session, WT_REF *ref);
+extern void __wt_evict_dirty_index_move(WT_SESSION_IMPL *session, WT_PAGE *page, WT_REF *ref);
+extern void __wt_evict_dirty_index_remove(WT_SESSION_IMPL *session, WT_PAGE *page);
 extern void __wt_evict_file_exclusive_off(WT_SESSION_IMPL *session);
 extern void __wt_evict_priority_clear(WT_SESSION_IMPL *session);
 extern void __wt_evict_priority_set(WT_SESSION_IMPL *session, uint64_t v);
 extern void __wt_evict_server_wake(WT_SESSION_IMPL *session);
 extern void __wt_evict_stats_update(WT_SESSION_IMPL *session);
+extern void __wt_evict_trace_add(WT_SESSION_IMPL *session, WT_EVICT_TRACE_RECORD *trace);
+extern void __wt_evict_trace_flush(WT_SESSION_IMPL *session);
 static WT_INLINE bool __wt_evict_aggressive(WT_SESSION_IMPL *session)
   WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
+static WT_INLINE bool __wt_evict_app_handoff(WT_SESSION_IMPL *session)
+  WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
 static WT_INLINE bool __wt_evict_cache_stuck(WT_SESSION_IMPL *session)
   WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
 static WT_INLINE bool __wt_evict_clean_needed(WT_SESSION_IMPL *session, double *pct_fullp)
@@ -184,6 +312,8 @@ static WT_INLINE bool __wt_evict_page_is_soon(WT_PAGE *page)
   WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
 static WT_INLINE bool __wt_evict_page_is_soon_or_wont_need(WT_PAGE *page)
   WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
+static WT_INLINE bool __wt_evict_trace_enabled(WT_SESSION_IMPL *session)
+  WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
 static WT_INLINE int __wt_evict_app_assist_worker_check(
   WT_SESSION_IMPL *session, bool busy, bool readonly, bool interruptible, bool *didworkp)
   WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
@@ -191,11 +321,14 @@ static WT_INLINE void __wt_evict_clear_npos(WT_BTREE *btree);
 static WT_INLINE void __wt_evict_favor_clearing_dirty_cache(WT_SESSION_IMPL *session);
 static WT_INLINE void __wt_evict_inherit_page_state(WT_PAGE *orig_page, WT_PAGE *new_page);
 static WT_INLINE void __wt_evict_page_cache_bytes_decr(WT_SESSION_IMPL *session, WT_PAGE *page);
+static WT_INLINE void __wt_evict_page_dirty_index(WT_SESSION_IMPL *session, WT_REF *ref);
 static WT_INLINE void __wt_evict_page_first_dirty(WT_SESSION_IMPL *session, WT_PAGE *page);
 static WT_INLINE void __wt_evict_page_init(WT_PAGE *page);
 static WT_INLINE void __wt_evict_page_soon(WT_SESSION_IMPL *session, WT_REF *ref);
 static WT_INLINE void __wt_evict_touch_page(
-  WT_SESSION_IMPL *session, WT_PAGE *page, bool internal_only, bool wont_need);
+  WT_SESSION_IMPL *session, WT_REF *ref, bool internal_only, bool wont_need);
+static WT_INLINE void __wt_evict_trace_page(
+  WT_BTREE *btree, WT_REF *ref, uint8_t type, uint8_t flags, WT_EVICT_TRACE_RECORD *trace);
 
 #ifdef HAVE_UNITTEST
 
@@ -173,6 +173,35 @@ __evict_validate_config(WT_SESSION_IMPL *session, const char *cfg[])
     return (0);
 }
 
+/*
+ * __evict_freq_sketch_alloc --
+ *     Allocate the frequency policy's sketch, sized for the cache. The sketch isn't freed until
+ *     the connection closes: readers can still be using it after the policy is reconfigured.
+ */
+static int
+__evict_freq_sketch_alloc(WT_SESSION_IMPL *session)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_EVICT *evict;
+    uint64_t width;
+    uint8_t *sketch;
+
+    conn = S2C(session);
+    evict = conn->evict;
+
+    if (evict->freq_sketch != NULL)
+        return (0);
+
+    for (width = WT_EVICT_FREQ_WIDTH_MIN;
+         width < WT_EVICT_FREQ_WIDTH_MAX && width * WT_EVICT_FREQ_PAGE_SIZE < conn->cache_size;
+         width <<= 1)
+        ;
+    WT_RET(__wt_calloc_def(session, width * WT_EVICT_FREQ_ROWS, &sketch));
+    evict->freq_sketch_width = width;
+    WT_RELEASE_WRITE(evict->freq_sketch, sketch);
+    return (0);
+}
+
 /* !!!
  * __wt_evict_config --
  *     Parses eviction-related configuration strings during `wiredtiger_open` or
@@ -225,6 +254,30 @@ __wt_evict_config(WT_SESSION_IMPL *session, const char *cfg[], bool reconfig)
     WT_RET(__wt_config_gets(session, cfg, "eviction.legacy_page_visit_strategy", &cval));
     conn->evict_legacy_page_visit_strategy = cval.val != 0;
 
+    WT_RET(__wt_config_gets(session, cfg, "eviction.app_handoff", &cval));
+    __wt_atomic_storebool(&evict->app_handoff, cval.val != 0);
+
+    WT_RET(__wt_config_gets(session, cfg, "eviction.app_handoff_wait_max_ms", &cval));
+    evict->app_handoff_wait_max_us = (uint64_t)cval.val * WT_THOUSAND;
+
+    WT_RET(__wt_config_gets(session, cfg, "eviction.dirty_page_index", &cval));
+    __wt_atomic_storebool(&conn->evict_dirty_page_index, cval.val != 0);
+
+    WT_RET(__wt_config_gets(session, cfg, "eviction.policy", &cval));
+    if (WT_CONFIG_LIT_MATCH("frequency", cval)) {
+        WT_RET(__evict_freq_sketch_alloc(session));
+        __wt_atomic_storebool(&evict->freq_policy, true);
+    } else
+        __wt_atomic_storebool(&evict->freq_policy, false);
+
+    WT_RET(__wt_config_gets(session, cfg, "eviction.tuning_horizon_ms", &cval));
+    __wt_atomic_store64(&evict->predict_horizon_config_ms, (uint64_t)cval.val);
+
+    WT_RET(__wt_config_gets(session, cfg, "eviction.tuning", &cval));
+    __wt_atomic_storebool(&evict->predict, WT_CONFIG_LIT_MATCH("predictive", cval));
+
+    WT_RET(__wti_evict_trace_config(session, cfg));
+
     /* Retrieve the wait time and convert from milliseconds */
     WT_RET(__wt_config_gets(session, cfg, "cache_max_wait_ms", &cval));
     if (cval.val > 1)
@@ -278,6 +331,8 @@ __wt_evict_create(WT_SESSION_IMPL *session, const char *cfg[])
 
     evict = conn->evict;
 
+    WT_RET(__wt_spin_init(session, &evict->trace_lock, "evict trace"));
+
     /* Use a common routine for run-time configuration options. */
     WT_RET(__wt_evict_config(session, cfg, false));
 
@@ -290,6 +345,7 @@ __wt_evict_create(WT_SESSION_IMPL *session, const char *cfg[])
 
     WT_RET(__wt_cond_auto_alloc(
       session, "evict server", 10 * WT_THOUSAND, WT_MILLION, &evict->evict_cond));
+    WT_RET(__wt_cond_alloc(session, "evict app handoff", &evict->app_handoff_cond));
     WT_RET(__wt_spin_init(session, &evict->evict_pass_lock, "evict pass"));
     WT_RET(__wt_spin_init(session, &evict->evict_queue_lock, "evict queues"));
     WT_RET(__wt_spin_init(session, &evict->evict_walk_lock, "evict walk"));
@@ -339,16 +395,19 @@ __wt_evict_destroy(WT_SESSION_IMPL *session)
         return (0);
 
     __wt_cond_destroy(session, &evict->evict_cond);
+    __wt_cond_destroy(session, &evict->app_handoff_cond);
     __wt_spin_destroy(session, &evict->evict_pass_lock);
     __wt_spin_destroy(session, &evict->evict_queue_lock);
     __wt_spin_destroy(session, &evict->evict_walk_lock);
     if (evict->walk_session != NULL)
         WT_TRET(__wt_session_close_internal(evict->walk_session));
+    WT_TRET(__wti_evict_trace_destroy(session));
 
     for (i = 0; i < WTI_EVICT_QUEUE_MAX; ++i) {
         __wt_spin_destroy(session, &evict->evict_queues[i].evict_lock);
         __wt_free(session, evict->evict_queues[i].evict_queue);
     }
+    __wt_free(session, evict->freq_sketch);
     __wt_free(session, conn->evict);
     return (ret);
 }
@@ -389,6 +448,7 @@ __wt_evict_stats_update(WT_SESSION_IMPL *session)
       __wt_atomic_load32(&conn->evict_threads.current_threads));
     WT_STATP_CONN_SET(
       session, stats, eviction_stable_state_workers, evict->evict_tune_workers_best);
+    WT_STATP_CONN_SET(session, stats, eviction_predict_horizon, evict->predict_horizon_ms);
 
     /*
      * The number of files with active walks ~= number of hazard pointers in the walk session. Note:
@@ -0,0 +1,128 @@
+/*-
+ * Copyright (c) 2014-present MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * The dirty page index is a per-tree list of dirty leaf pages, in the order they were first
+ * modified. When eviction only needs to reduce the cache's dirty content, it takes candidates from
+ * the front of the index rather than walking the tree past clean pages to find them.
+ *
+ * Entries are linked through the page's modify structure and hold the page's reference. A page
+ * leaves the index when eviction finds it clean, or when the page is discarded. A page moved to a
+ * new reference by an in-memory split has its entry updated. Pages are only added by updates made
+ * through a cursor, pages dirtied in other ways are found by the tree walk.
+ */
+
+/*
+ * __wt_evict_dirty_index_add --
+ *     Add a reference's page to its tree's dirty page index.
+ */
+void
+__wt_evict_dirty_index_add(WT_SESSION_IMPL *session, WT_REF *ref)
+{
+    WT_BTREE *btree;
+    WT_PAGE *page;
+    WT_PAGE_MODIFY *mod;
+
+    btree = S2BT(session);
+    page = ref->page;
+    mod = page->modify;
+
+    __wt_spin_lock(session, &btree->evict_dirty_lock);
+    if (!F_ISSET_ATOMIC_16(page, WT_PAGE_EVICT_DIRTY_INDEX)) {
+        mod->dirty_page = page;
+        mod->dirty_ref = ref;
+        TAILQ_INSERT_TAIL(&btree->evict_dirtyqh, mod, dirtyq);
+        ++btree->evict_dirty_count;
+        F_SET_ATOMIC_16(page, WT_PAGE_EVICT_DIRTY_INDEX);
+    }
+    __wt_spin_unlock(session, &btree->evict_dirty_lock);
+}
+
+/*
+ * __wt_evict_dirty_index_remove --
+ *     Remove a page being discarded from its tree's dirty page index.
+ */
+void
+__wt_evict_dirty_index_remove(WT_SESSION_IMPL *session, WT_PAGE *page)
+{
+    WT_BTREE *btree;
+
+    btree = S2BT(session);
+
+    __wt_spin_lock(session, &btree->evict_dirty_lock);
+    if (F_ISSET_ATOMIC_16(page, WT_PAGE_EVICT_DIRTY_INDEX)) {
+        TAILQ_REMOVE(&btree->evict_dirtyqh, page->modify, dirtyq);
+        --btree->evict_dirty_count;
+        F_CLR_ATOMIC_16(page, WT_PAGE_EVICT_DIRTY_INDEX);
+    }
+    __wt_spin_unlock(session, &btree->evict_dirty_lock);
+}
+
+/*
+ * __wt_evict_dirty_index_move --
+ *     Update a page's dirty page index entry after an in-memory split moved it to a new reference.
+ */
+void
+__wt_evict_dirty_index_move(WT_SESSION_IMPL *session, WT_PAGE *page, WT_REF *ref)
+{
+    WT_BTREE *btree;
+
+    btree = S2BT(session);
+
+    __wt_spin_lock(session, &btree->evict_dirty_lock);
+    if (F_ISSET_ATOMIC_16(page, WT_PAGE_EVICT_DIRTY_INDEX))
+        page->modify->dirty_ref = ref;
+    __wt_spin_unlock(session, &btree->evict_dirty_lock);
+}
+
+/*
+ * __wti_evict_dirty_index_next --
+ *     Return the reference at the front of the tree's dirty page index with a hazard pointer set,
+ *     moving its entry to the back of the index. Clean pages leave the index, and NULL is returned
+ *     if the front page is clean or can't be pinned. The caller must be in a split generation.
+ */
+int
+__wti_evict_dirty_index_next(WT_SESSION_IMPL *session, WT_REF **refp)
+{
+    WT_BTREE *btree;
+    WT_DECL_RET;
+    WT_PAGE *page;
+    WT_PAGE_MODIFY *mod;
+    WT_REF *ref;
+    bool busy;
+
+    *refp = NULL;
+    btree = S2BT(session);
+
+    __wt_spin_lock(session, &btree->evict_dirty_lock);
+    if ((mod = TAILQ_FIRST(&btree->evict_dirtyqh)) == NULL)
+        goto err;
+    TAILQ_REMOVE(&btree->evict_dirtyqh, mod, dirtyq);
+    page = mod->dirty_page;
+    ref = mod->dirty_ref;
+
+    /*
+     * The page can't be discarded while we hold the lock, pin it before letting go. Pages cleaned
+     * by reconciliation leave the index, they're added again when next modified.
+     */
+    if (!__wt_page_is_modified(page)) {
+        --btree->evict_dirty_count;
+        F_CLR_ATOMIC_16(page, WT_PAGE_EVICT_DIRTY_INDEX);
+        goto err;
+    }
+    TAILQ_INSERT_TAIL(&btree->evict_dirtyqh, mod, dirtyq);
+    WT_ERR(__wt_hazard_set(session, ref, &busy));
+    if (!busy)
+        *refp = ref;
+
+err:
+    __wt_spin_unlock(session, &btree->evict_dirty_lock);
+    return (ret);
+}
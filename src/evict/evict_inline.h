@@ -47,6 +47,23 @@ __wt_evict_cache_stuck(WT_SESSION_IMPL *session)
       tmp_evict_aggressive_score == WT_EVICT_SCORE_MAX && F_ISSET(evict, WT_EVICT_CACHE_HARD));
 }
 
+/* !!!
+ * __wt_evict_app_handoff --
+ *     Check whether the session hands eviction off to the eviction threads.
+ *
+ *     With the `eviction=(app_handoff=true)` configuration, application threads don't evict pages:
+ *     when the cache needs space they wait for the eviction threads, and pages they would have
+ *     forcibly evicted are queued for urgent eviction instead.
+ *
+ *     Return `true` if the session is an application session and handoff is configured.
+ */
+static WT_INLINE bool
+__wt_evict_app_handoff(WT_SESSION_IMPL *session)
+{
+    return (!F_ISSET(session, WT_SESSION_INTERNAL) &&
+      __wt_atomic_loadbool(&S2C(session)->evict->app_handoff));
+}
+
 /*
  * __evict_read_gen --
  *     Get the current read generation number.
@@ -93,6 +110,79 @@ __wti_evict_read_gen_new(WT_SESSION_IMPL *session, WT_PAGE *page)
       &page->read_gen, (__evict_read_gen(session) + S2C(session)->evict->read_gen_oldest) / 2);
 }
 
+/*
+ * __evict_freq_hash --
+ *     Return the pair of hashes used to find a reference's frequency sketch counters.
+ */
+static WT_INLINE void
+__evict_freq_hash(WT_REF *ref, uint64_t *h1p, uint64_t *h2p)
+{
+    uint64_t h;
+
+    /* References are aligned, discard the low bits before mixing the address. */
+    h = ((uint64_t)(uintptr_t)ref >> 3) * 0x9e3779b97f4a7c15ULL;
+    *h1p = h;
+    *h2p = (h >> 32 | h << 32) | 1;
+}
+
+/*
+ * __wti_evict_freq_record --
+ *     Record a read of a reference's page in the frequency sketch. Counters are updated without
+ *     atomic operations, a lost increment only makes the estimate less precise.
+ */
+static WT_INLINE void
+__wti_evict_freq_record(WT_SESSION_IMPL *session, WT_REF *ref)
+{
+    WT_EVICT *evict;
+    uint64_t h1, h2, width;
+    uint8_t count, *counter, *sketch;
+    u_int i;
+
+    evict = S2C(session)->evict;
+    if (!__wt_atomic_loadbool(&evict->freq_policy))
+        return;
+    WT_ACQUIRE_READ(sketch, evict->freq_sketch);
+    if (sketch == NULL)
+        return;
+
+    width = evict->freq_sketch_width;
+    __evict_freq_hash(ref, &h1, &h2);
+    for (i = 0; i < WT_EVICT_FREQ_ROWS; ++i, h1 += h2) {
+        counter = &sketch[i * width + (h1 & (width - 1))];
+        count = __wt_atomic_load8(counter);
+        if (count < WT_EVICT_FREQ_MAX)
+            __wt_atomic_store8(counter, (uint8_t)(count + 1));
+    }
+    __wt_atomic_store64(&evict->freq_sketch_adds, __wt_atomic_load64(&evict->freq_sketch_adds) + 1);
+}
+
+/*
+ * __wti_evict_freq_estimate --
+ *     Return the estimated number of reads of a reference's page since the sketch was last aged.
+ */
+static WT_INLINE uint8_t
+__wti_evict_freq_estimate(WT_SESSION_IMPL *session, WT_REF *ref)
+{
+    WT_EVICT *evict;
+    uint64_t h1, h2, width;
+    uint8_t count, estimate, *sketch;
+    u_int i;
+
+    evict = S2C(session)->evict;
+    WT_ACQUIRE_READ(sketch, evict->freq_sketch);
+    if (sketch == NULL)
+        return (0);
+
+    width = evict->freq_sketch_width;
+    estimate = WT_EVICT_FREQ_MAX;
+    __evict_freq_hash(ref, &h1, &h2);
+    for (i = 0; i < WT_EVICT_FREQ_ROWS; ++i, h1 += h2) {
+        count = __wt_atomic_load8(&sketch[i * width + (h1 & (width - 1))]);
+        estimate = WT_MIN(estimate, count);
+    }
+    return (estimate);
+}
+
 /*
  * __wti_evict_readgen_is_soon_or_wont_need --
  *     Return whether a read generation value makes a page eligible for forced eviction. Read
@@ -197,18 +287,92 @@ __wt_evict_page_first_dirty(WT_SESSION_IMPL *session, WT_PAGE *page)
         __wti_evict_read_gen_new(session, page);
 }
 
+/* !!!
+ * __wt_evict_page_dirty_index --
+ *     Add a modified leaf page to its tree's dirty page index, if the index is configured.
+ *
+ *     The index lets eviction find dirty pages without walking the tree when it only needs to
+ *     reduce the cache's dirty content. Pages are added once, in the order they were first
+ *     modified, and leave the index when they're cleaned or discarded.
+ *
+ *     It is called after an update is added to a page through a cursor.
+ *
+ *     Input parameter:
+ *       `ref`: The reference to the modified page.
+ */
+static WT_INLINE void
+__wt_evict_page_dirty_index(WT_SESSION_IMPL *session, WT_REF *ref)
+{
+    WT_PAGE *page;
+
+    if (!__wt_atomic_loadbool(&S2C(session)->evict_dirty_page_index) ||
+      !F_ISSET(ref, WT_REF_FLAG_LEAF) || F_ISSET(S2BT(session), WT_BTREE_IN_MEMORY))
+        return;
+
+    page = ref->page;
+    if (!F_ISSET_ATOMIC_16(page, WT_PAGE_EVICT_DIRTY_INDEX) && __wt_page_is_modified(page))
+        __wt_evict_dirty_index_add(session, ref);
+}
+
+/* !!!
+ * __wt_evict_trace_enabled --
+ *     Return if the session records eviction decisions in the eviction trace.
+ *
+ *     The default session is excluded, it can be used by several threads at once.
+ */
+static WT_INLINE bool
+__wt_evict_trace_enabled(WT_SESSION_IMPL *session)
+{
+    return (__wt_atomic_loadbool(&S2C(session)->evict->trace) && session->id != 0);
+}
+
+/* !!!
+ * __wt_evict_trace_page --
+ *     Describe an in-memory page in an eviction trace record.
+ *
+ *     The record is filled in before it's added to the trace, so the page can be described before
+ *     an eviction and the record added once the eviction's outcome is known.
+ *
+ *     Input parameters:
+ *       `btree`: The page's tree.
+ *       `ref`: The reference to the page.
+ *       `type`: The record type.
+ *       `flags`: Flags to record along with the page's.
+ *       `trace`: The record.
+ */
+static WT_INLINE void
+__wt_evict_trace_page(
+  WT_BTREE *btree, WT_REF *ref, uint8_t type, uint8_t flags, WT_EVICT_TRACE_RECORD *trace)
+{
+    WT_PAGE *page;
+
+    page = ref->page;
+    trace->ref = (uint64_t)(uintptr_t)ref;
+    trace->read_gen = __wt_atomic_load64(&page->read_gen);
+    trace->btree_id = btree->id;
+    trace->size = (uint32_t)WT_MIN(__wt_atomic_loadsize(&page->memory_footprint), UINT32_MAX);
+    trace->type = type;
+    trace->flags = flags;
+    memset(trace->padding, 0, sizeof(trace->padding));
+    if (__wt_page_is_modified(page))
+        trace->flags |= WT_EVICT_TRACE_DIRTY;
+    if (F_ISSET(ref, WT_REF_FLAG_INTERNAL))
+        trace->flags |= WT_EVICT_TRACE_INTERNAL;
+}
+
 /* !!!
  * __wt_evict_touch_page --
  *     Update a page's eviction state (read generation) when it is accessed.
  *
  *     A page that is recently read will have a higher read generation, indicating that it is less
  *     likely to be evicted. This mechanism helps eviction to prioritize the order in which pages
- *     are evicted.
+ *     are evicted. With the frequency eviction policy, reads that move the read generation are
+ *     also counted for the page's reference.
  *
  *     This function is called every time a page is touched in the cache.
  *
  *     Input parameters:
- *       (1) `page`: The page whose eviction state is being updated.
+ *       (1) `ref`: The reference to the page whose eviction state is being updated.
  *       (2) `internal_only`: A flag indicating whether the operation is internal. If true, the read
  *            generation is not updated, as internal operations (such as compaction or eviction)
  *            should not affect the page's eviction priority.
@@ -216,16 +380,26 @@ __wt_evict_page_first_dirty(WT_SESSION_IMPL *session, WT_PAGE *page)
  *            the page is marked for forced eviction.
  */
 static WT_INLINE void
-__wt_evict_touch_page(WT_SESSION_IMPL *session, WT_PAGE *page, bool internal_only, bool wont_need)
+__wt_evict_touch_page(WT_SESSION_IMPL *session, WT_REF *ref, bool internal_only, bool wont_need)
 {
+    WT_PAGE *page;
+
+    page = ref->page;
+
     /* Is this the first use of the page? */
     if (__wt_atomic_load64(&page->read_gen) == WT_READGEN_NOTSET) {
         if (wont_need)
             __wt_atomic_store64(&page->read_gen, WT_READGEN_WONT_NEED);
-        else
+        else {
             __wti_evict_read_gen_new(session, page);
-    } else if (!internal_only)
+            __wti_evict_freq_record(session, ref);
+        }
+    } else if (!internal_only) {
+        /* Only count reads that move the read generation, at most one per read generation step. */
+        if (__wt_atomic_load64(&page->read_gen) <= __evict_read_gen(session))
+            __wti_evict_freq_record(session, ref);
         __wti_evict_read_gen_bump(session, page);
+    }
 }
 
 /* !!!
@@ -296,6 +470,9 @@ __wt_evict_page_cache_bytes_decr(WT_SESSION_IMPL *session, WT_PAGE *page)
       __wt_atomic_loadsize(&page->memory_footprint), "WT_BTREE.bytes_inmem");
     __wt_cache_decr_check_uint64(session, &cache->bytes_inmem,
       __wt_atomic_loadsize(&page->memory_footprint), "WT_CACHE.bytes_inmem");
+    if (cache->numa.nodes > 1)
+        __wt_cache_decr_check_uint64(session, &cache->bytes_inmem_numa[page->numa_node],
+          __wt_atomic_loadsize(&page->memory_footprint), "WT_CACHE.bytes_inmem_numa");
 
     /* Update the bytes_internal value to reflect the eviction */
     if (WT_PAGE_IS_INTERNAL(page)) {
@@ -65,6 +65,7 @@ __evict_entry_priority(WT_SESSION_IMPL *session, WT_REF *ref)
     WT_BTREE *btree;
     WT_PAGE *page;
     uint64_t read_gen;
+    uint8_t freq;
 
     btree = S2BT(session);
     page = ref->page;
@@ -95,6 +96,17 @@ __evict_entry_priority(WT_SESSION_IMPL *session, WT_REF *ref)
     else
         read_gen = __wt_atomic_load64(&page->read_gen);
 
+    /*
+     * With the frequency policy, each additional read of a page skews it well behind pages read
+     * once, so the pages of a large scan are evicted before the pages read repeatedly.
+     */
+#define WT_EVICT_FREQ_SKEW (100 * WT_READGEN_STEP)
+    if (__wt_atomic_loadbool(&S2C(session)->evict->freq_policy) &&
+      (freq = __wti_evict_freq_estimate(session, ref)) > 1) {
+        read_gen += (uint64_t)(freq - 1) * WT_EVICT_FREQ_SKEW;
+        WT_STAT_CONN_INCR(session, eviction_frequency_ranked);
+    }
+
     read_gen += btree->evict_priority;
 
 #define WT_EVICT_INTL_SKEW WT_THOUSAND
@@ -104,6 +116,34 @@ __evict_entry_priority(WT_SESSION_IMPL *session, WT_REF *ref)
     return (read_gen);
 }
 
+/*
+ * __evict_freq_age --
+ *     Halve the frequency sketch's counters once enough reads are recorded, so pages that are no
+ *     longer read lose their rank.
+ */
+static void
+__evict_freq_age(WT_SESSION_IMPL *session)
+{
+    WT_EVICT *evict;
+    uint64_t i;
+    uint8_t *sketch;
+
+    evict = S2C(session)->evict;
+
+    if (!__wt_atomic_loadbool(&evict->freq_policy))
+        return;
+    WT_ACQUIRE_READ(sketch, evict->freq_sketch);
+    if (sketch == NULL ||
+      __wt_atomic_load64(&evict->freq_sketch_adds) < evict->freq_sketch_width * WT_EVICT_FREQ_AGE)
+        return;
+
+    /* Racing increments can be lost, the counts are estimates. */
+    for (i = 0; i < evict->freq_sketch_width * WT_EVICT_FREQ_ROWS; ++i)
+        sketch[i] >>= 1;
+    __wt_atomic_store64(&evict->freq_sketch_adds, 0);
+    WT_STAT_CONN_INCR(session, eviction_frequency_age);
+}
+
 /*
  * __evict_lru_cmp_debug --
  *     Qsort function: sort the eviction array. Version for eviction debug mode.
@@ -312,6 +352,16 @@ __evict_thread_run(WT_SESSION_IMPL *session, WT_THREAD *thread)
     /* Mark the session as an eviction thread session. */
     F_SET(session, WT_SESSION_EVICTION);
 
+    /*
+     * With a NUMA partitioned cache, bind each eviction thread to a node the first time it runs,
+     * spreading the threads across the nodes. A thread that can't be bound still evicts pages.
+     */
+    if (conn->cache->numa.nodes > 1 && !thread->numa_bound) {
+        thread->numa_bound = true;
+        WT_IGNORE_RET(__wt_numa_bind_thread(
+          session, &conn->cache->numa, thread->id % conn->cache->numa.nodes));
+    }
+
     /*
      * Cache a history store cursor to avoid deadlock: if an eviction thread marks a file busy and
      * then opens a different file (in this case, the HS file), it can deadlock with a thread
@@ -665,12 +715,16 @@ __evict_update_work(WT_SESSION_IMPL *session)
     WT_CONNECTION_IMPL *conn;
     WT_EVICT *evict;
     double dirty_target, dirty_trigger, target, trigger, updates_target, updates_trigger;
-    uint64_t bytes_dirty, bytes_inuse, bytes_max, bytes_updates;
+    uint64_t bytes_dirty, bytes_inuse, bytes_max, bytes_node, bytes_updates;
     uint32_t flags;
+    u_int i;
+    bool early, predict;
 
     conn = S2C(session);
     cache = conn->cache;
     evict = conn->evict;
+    early = false;
+    predict = __wt_atomic_loadbool(&evict->predict);
 
     dirty_target = __wti_evict_dirty_target(evict);
     dirty_trigger = evict->eviction_dirty_trigger;
@@ -716,6 +770,24 @@ __evict_update_work(WT_SESSION_IMPL *session)
         WT_STAT_CONN_INCR(session, cache_eviction_trigger_reached);
     } else if (bytes_inuse > (target * bytes_max) / 100) {
         LF_SET(WT_EVICT_CACHE_CLEAN);
+    } else if (predict && bytes_inuse + evict->predict_inuse_growth > (target * bytes_max) / 100) {
+        LF_SET(WT_EVICT_CACHE_CLEAN);
+        early = true;
+    }
+
+    /*
+     * With a NUMA partitioned cache, each node's share of the cache is an equal part of the cache
+     * size. Look for clean pages on the nodes over their share of the eviction target, even if the
+     * cache as a whole isn't.
+     */
+    evict->numa_nodes_over = 0;
+    for (i = 0; cache->numa.nodes > 1 && i < cache->numa.nodes; ++i) {
+        bytes_node = __wt_cache_bytes_plus_overhead(
+          cache, __wt_atomic_load64(&cache->bytes_inmem_numa[i]));
+        if (bytes_node > (uint64_t)(target * bytes_max / cache->numa.nodes) / 100) {
+            evict->numa_nodes_over |= (uint64_t)1 << i;
+            LF_SET(WT_EVICT_CACHE_CLEAN);
+        }
     }
 
     bytes_dirty = __wt_cache_dirty_leaf_inuse(cache);
@@ -724,6 +796,10 @@ __evict_update_work(WT_SESSION_IMPL *session)
         WT_STAT_CONN_INCR(session, cache_eviction_trigger_dirty_reached);
     } else if (bytes_dirty > (uint64_t)(dirty_target * bytes_max) / 100) {
         LF_SET(WT_EVICT_CACHE_DIRTY);
+    } else if (predict &&
+      bytes_dirty + evict->predict_dirty_growth > (uint64_t)(dirty_target * bytes_max) / 100) {
+        LF_SET(WT_EVICT_CACHE_DIRTY);
+        early = true;
     }
 
     bytes_updates = __wt_cache_bytes_updates(cache);
@@ -732,7 +808,14 @@ __evict_update_work(WT_SESSION_IMPL *session)
         WT_STAT_CONN_INCR(session, cache_eviction_trigger_updates_reached);
     } else if (bytes_updates > (uint64_t)(updates_target * bytes_max) / 100) {
         LF_SET(WT_EVICT_CACHE_UPDATES);
+    } else if (predict &&
+      bytes_updates + evict->predict_updates_growth >
+        (uint64_t)(updates_target * bytes_max) / 100) {
+        LF_SET(WT_EVICT_CACHE_UPDATES);
+        early = true;
     }
+    if (early)
+        WT_STAT_CONN_INCR(session, eviction_predict_early_start);
 
     /*
      * If application threads are blocked by data in cache, track the fill ratio.
@@ -822,6 +905,7 @@ __evict_pass(WT_SESSION_IMPL *session)
         if (loop == 0)
             time_prev = time_now;
 
+        __wti_evict_predict_update(session);
         __evict_tune_workers(session);
         /*
          * Increment the shared read generation. Do this occasionally even if eviction is not
@@ -830,6 +914,7 @@ __evict_pass(WT_SESSION_IMPL *session)
          */
         __wt_atomic_add64(&evict->read_gen, 1);
         __wt_atomic_add64(&evict->evict_pass_gen, 1);
+        __evict_freq_age(session);
 
         /*
          * Update the oldest ID: we use it to decide whether pages are candidates for eviction.
@@ -1201,7 +1286,7 @@ __evict_tune_workers(WT_SESSION_IMPL *session)
     WT_EVICT *evict;
     uint64_t delta_msec, delta_pages;
     uint64_t eviction_progress, eviction_progress_rate, time_diff;
-    uint32_t current_threads;
+    uint32_t current_threads, predict_threads;
     int32_t cur_threads, i, target_threads, thread_surplus;
 
     conn = S2C(session);
@@ -1214,6 +1299,42 @@ __evict_tune_workers(WT_SESSION_IMPL *session)
     if (conn->evict_threads_max == conn->evict_threads_min)
         return;
 
+    /*
+     * Application threads waiting for the eviction threads can't help evict pages, start all of the
+     * workers rather than ramping up. Tuning continues once nothing is waiting.
+     */
+    if (__wt_atomic_load32(&evict->app_handoff_waiters) > 0) {
+        for (current_threads = __wt_atomic_load32(&conn->evict_threads.current_threads);
+             current_threads < conn->evict_threads_max; ++current_threads)
+            __wt_thread_group_start_one(session, &conn->evict_threads, false);
+        return;
+    }
+
+    /*
+     * With predictive tuning, start workers in proportion to how close the forecast is to an
+     * eviction trigger, rather than waiting for throughput samples. Tuning continues from there.
+     */
+    if (__wt_atomic_loadbool(&evict->predict) && evict->predict_pressure > 0) {
+        predict_threads =
+          (conn->evict_threads_max - conn->evict_threads_min) * evict->predict_pressure;
+        predict_threads = conn->evict_threads_min + (predict_threads + 99) / 100;
+
+        /*
+         * Hold the thread group's lock: closing the connection stops eviction while holding it, and
+         * then stops the threads.
+         */
+        if (__wt_atomic_load32(&conn->evict_threads.current_threads) < predict_threads) {
+            __wt_writelock(session, &conn->evict_threads.lock);
+            for (current_threads = __wt_atomic_load32(&conn->evict_threads.current_threads);
+                 F_ISSET_ATOMIC_32(conn, WT_CONN_EVICTION_RUN) && current_threads < predict_threads;
+                 ++current_threads) {
+                __wt_thread_group_start_one(session, &conn->evict_threads, true);
+                WT_STAT_CONN_INCR(session, eviction_predict_worker_start);
+            }
+            __wt_writeunlock(session, &conn->evict_threads.lock);
+        }
+    }
+
     __wt_epoch(session, &current_time);
     time_diff = WT_TIMEDIFF_MS(current_time, evict->evict_tune_last_time);
 
@@ -1630,6 +1751,30 @@ __evict_btree_dominating_cache(WT_SESSION_IMPL *session, WT_BTREE *btree)
     return (false);
 }
 
+/*
+ * __evict_btree_cache_quota --
+ *     Return if a btree is using less than its minimum share of the cache, or more than its maximum
+ *     share.
+ */
+static WT_INLINE void
+__evict_btree_cache_quota(
+  WT_SESSION_IMPL *session, WT_BTREE *btree, bool *below_minp, bool *over_maxp)
+{
+    WT_CONNECTION_IMPL *conn;
+    uint64_t bytes_inmem;
+
+    conn = S2C(session);
+
+    *below_minp = *over_maxp = false;
+    if (btree->cache_quota_min == 0 && btree->cache_quota_max == 100)
+        return;
+
+    bytes_inmem =
+      __wt_cache_bytes_plus_overhead(conn->cache, __wt_atomic_load64(&btree->bytes_inmem));
+    *below_minp = bytes_inmem < (conn->cache_size * btree->cache_quota_min) / 100;
+    *over_maxp = bytes_inmem > (conn->cache_size * btree->cache_quota_max) / 100;
+}
+
 /*
  * __evict_walk --
  *     Fill in the array by walking the next set of pages.
@@ -1647,7 +1792,7 @@ __evict_walk(WT_SESSION_IMPL *session, WTI_EVICT_QUEUE *queue)
     uint32_t evict_walk_period;
     u_int loop_count, max_entries, retries, slot, start_slot;
     u_int total_candidates;
-    bool dhandle_list_locked;
+    bool below_min, dhandle_list_locked, over_max;
 
     WT_TRACK_OP_INIT(session);
 
@@ -1716,6 +1861,12 @@ retry:
         if (dhandle == NULL)
             break;
 
+        /* Starting a new pass through the handle list, publish the trees over their cache share. */
+        if (dhandle == TAILQ_FIRST(&conn->dhqh)) {
+            evict->walk_quota_over = evict->walk_quota_over_next;
+            evict->walk_quota_over_next = 0;
+        }
+
         /* Ignore non-btree handles, or handles that aren't open. */
         if (!WT_DHANDLE_BTREE(dhandle) || !F_ISSET(dhandle, WT_DHANDLE_OPEN))
             continue;
@@ -1727,6 +1878,27 @@ retry:
             continue;
         }
 
+        /*
+         * Enforce the trees' cache shares until eviction becomes aggressive: skip trees below their
+         * minimum share and, while any tree is over its maximum share, skip the trees that aren't.
+         * Trees over their maximum are counted on each pass through the handle list, the count from
+         * the previous pass is used. The history store and metadata are never skipped for others.
+         */
+        __evict_btree_cache_quota(session, btree, &below_min, &over_max);
+        if (over_max)
+            ++evict->walk_quota_over_next;
+        if (!__wt_evict_aggressive(session)) {
+            if (below_min) {
+                WT_STAT_CONN_INCR(session, eviction_server_skip_trees_below_cache_quota);
+                continue;
+            }
+            if (!over_max && evict->walk_quota_over != 0 && !WT_IS_HS(dhandle) &&
+              !WT_IS_METADATA(dhandle)) {
+                WT_STAT_CONN_INCR(session, eviction_server_skip_trees_cache_quota_over);
+                continue;
+            }
+        }
+
         /*
          * Skip files that are checkpointing if we are only looking for dirty pages.
          */
@@ -1739,10 +1911,10 @@ retry:
         /*
          * Skip files that are configured to stick in cache until we become aggressive.
          *
-         * If the file is contributing heavily to our cache usage then ignore the "stickiness" of
-         * its pages.
+         * If the file is contributing heavily to our cache usage or is over its maximum cache share
+         * then ignore the "stickiness" of its pages.
          */
-        if (btree->evict_priority != 0 && !__wt_evict_aggressive(session) &&
+        if (btree->evict_priority != 0 && !over_max && !__wt_evict_aggressive(session) &&
           !__evict_btree_dominating_cache(session, btree)) {
             WT_STAT_CONN_INCR(session, eviction_server_skip_trees_stick_in_cache);
             continue;
@@ -1764,10 +1936,11 @@ retry:
         }
 
         /*
-         * If we are filling the queue, skip files that haven't been useful in the past.
+         * If we are filling the queue, skip files that haven't been useful in the past, unless they
+         * are over their maximum cache share.
          */
         evict_walk_period = __wt_atomic_load32(&btree->evict_walk_period);
-        if (evict_walk_period != 0 && btree->evict_walk_skips++ < evict_walk_period) {
+        if (!over_max && evict_walk_period != 0 && btree->evict_walk_skips++ < evict_walk_period) {
             WT_STAT_CONN_INCR(session, eviction_server_skip_trees_not_useful_before);
             continue;
         }
@@ -1844,6 +2017,7 @@ static bool
 __evict_push_candidate(
   WT_SESSION_IMPL *session, WTI_EVICT_QUEUE *queue, WTI_EVICT_ENTRY *evict_entry, WT_REF *ref)
 {
+    WT_EVICT_TRACE_RECORD trace;
     uint16_t new_flags, orig_flags;
     u_int slot;
 
@@ -1876,6 +2050,11 @@ __evict_push_candidate(
         evict_entry->score +=
           WT_MEGABYTE - WT_MIN(WT_MEGABYTE, __wt_atomic_loadsize(&ref->page->memory_footprint));
 
+    if (__wt_evict_trace_enabled(session)) {
+        __wt_evict_trace_page(S2BT(session), ref, WT_EVICT_TRACE_QUEUE, 0, &trace);
+        __wt_evict_trace_add(session, &trace);
+    }
+
     return (true);
 }
 
@@ -1955,6 +2134,10 @@ __evict_walk_target(WT_SESSION_IMPL *session)
     if (target_pages < MIN_PAGES_PER_TREE)
         target_pages = MIN_PAGES_PER_TREE;
 
+    /* With predictive tuning, take up to twice the pages as the forecast nears a trigger. */
+    if (__wt_atomic_loadbool(&evict->predict))
+        target_pages += target_pages * evict->predict_pressure / 100;
+
     /* If the tree is dead, take a lot of pages. */
     if (F_ISSET(session->dhandle, WT_DHANDLE_DEAD))
         target_pages *= 10;
@@ -2352,6 +2535,16 @@ __evict_try_queue_page(WT_SESSION_IMPL *session, WTI_EVICT_QUEUE *queue, WT_REF
         return;
     }
 
+    /*
+     * With a NUMA partitioned cache, clean pages are taken from the nodes over their share of the
+     * cache until eviction becomes aggressive.
+     */
+    if (evict->numa_nodes_over != 0 && !modified &&
+      ((evict->numa_nodes_over >> page->numa_node) & 1) == 0 && !__wt_evict_aggressive(session)) {
+        WT_STAT_CONN_INCR(session, eviction_numa_walk_skip);
+        return;
+    }
+
     /*
      * Do not evict a clean metadata page that contains historical data needed to satisfy a reader.
      * Since there is no history store for metadata, we won't be able to serve an older reader if we
@@ -2402,6 +2595,79 @@ fast:
     return;
 }
 
+/*
+ * __evict_dirty_index_wanted --
+ *     Return if eviction candidates should be taken from the tree's dirty page index.
+ */
+static WT_INLINE bool
+__evict_dirty_index_wanted(WT_SESSION_IMPL *session)
+{
+    WT_BTREE *btree;
+    WT_EVICT *evict;
+
+    btree = S2BT(session);
+    evict = S2C(session)->evict;
+
+    /*
+     * The index only has dirty pages, use it when eviction doesn't want clean pages. Dirty pages
+     * also hold most of the cache's updates, so eviction of updates doesn't prevent it.
+     */
+    return (__wt_atomic_loadbool(&S2C(session)->evict_dirty_page_index) &&
+      F_ISSET(evict, WT_EVICT_CACHE_DIRTY) && !F_ISSET(evict, WT_EVICT_CACHE_CLEAN) &&
+      !F_ISSET(btree, WT_BTREE_IN_MEMORY) && !WT_BTREE_SYNCING(btree) &&
+      __wt_atomic_load64(&btree->evict_dirty_count) > 0);
+}
+
+/*
+ * __evict_walk_dirty_index --
+ *     Get eviction candidates from the tree's dirty page index.
+ */
+static int
+__evict_walk_dirty_index(WT_SESSION_IMPL *session, WTI_EVICT_QUEUE *queue,
+  WTI_EVICT_ENTRY *start, WTI_EVICT_ENTRY *end, bool *urgent_queuedp, uint64_t *pages_queuedp)
+{
+    WT_BTREE *btree;
+    WT_DECL_RET;
+    WTI_EVICT_ENTRY *evict_entry;
+    WT_REF *ref;
+    uint64_t entries, pages_seen;
+    bool queued;
+
+    btree = S2BT(session);
+    pages_seen = 0;
+
+    /*
+     * Entries move to the back of the index as they're seen, visit each at most once. The index
+     * holds references that can be replaced by splits, stay in a split generation until they're
+     * queued.
+     */
+    __wt_session_gen_enter(session, WT_GEN_SPLIT);
+    for (evict_entry = start, entries = __wt_atomic_load64(&btree->evict_dirty_count);
+         entries > 0 && evict_entry < end; --entries) {
+        WT_ERR(__wti_evict_dirty_index_next(session, &ref));
+        if (ref == NULL)
+            continue;
+
+        ++pages_seen;
+        if (!F_ISSET_ATOMIC_16(ref->page, WT_PAGE_EVICT_LRU)) {
+            __evict_try_queue_page(session, queue, ref, NULL, evict_entry, urgent_queuedp, &queued);
+            if (queued) {
+                ++evict_entry;
+                ++btree->evict_walk_progress;
+            }
+        }
+        WT_ERR(__wt_hazard_clear(session, ref));
+    }
+
+err:
+    __wt_session_gen_leave(session, WT_GEN_SPLIT);
+
+    *pages_queuedp = (uint64_t)(evict_entry - start);
+    WT_STAT_CONN_INCRV(session, eviction_dirty_index_pages_seen, pages_seen);
+    WT_STAT_CONN_INCRV(session, eviction_dirty_index_pages_queued, *pages_queuedp);
+    return (ret);
+}
+
 /*
  * __evict_walk_tree --
  *     Get a few page eviction candidates from a single underlying file.
@@ -2421,7 +2687,7 @@ __evict_walk_tree(WT_SESSION_IMPL *session, WTI_EVICT_QUEUE *queue, u_int max_en
     uint64_t min_pages, pages_already_queued, pages_queued, pages_seen, refs_walked;
     uint32_t evict_walk_period, target_pages, walk_flags;
     int restarts;
-    bool give_up, queued, urgent_queued;
+    bool dirty_index_queued, give_up, queued, urgent_queued;
 
     conn = S2C(session);
     btree = S2BT(session);
@@ -2464,6 +2730,15 @@ __evict_walk_tree(WT_SESSION_IMPL *session, WTI_EVICT_QUEUE *queue, u_int max_en
     if (F_ISSET(evict, WT_EVICT_CACHE_DIRTY_HARD | WT_EVICT_CACHE_UPDATES_HARD))
         __wt_txn_bump_snapshot(session);
 
+    /*
+     * When eviction only wants dirty pages, take candidates from the tree's dirty page index. The
+     * tree is only walked if the index doesn't provide any.
+     */
+    pages_queued = 0;
+    if (__evict_dirty_index_wanted(session))
+        ret = __evict_walk_dirty_index(session, queue, start, end, &urgent_queued, &pages_queued);
+    dirty_index_queued = pages_queued != 0;
+
     /*
      * !!! Take care terminating this loop.
      *
@@ -2475,8 +2750,8 @@ __evict_walk_tree(WT_SESSION_IMPL *session, WTI_EVICT_QUEUE *queue, u_int max_en
      * case we are appending and only the last page in the file is live.
      */
     internal_pages_already_queued = internal_pages_queued = internal_pages_seen = 0;
-    for (evict_entry = start, pages_already_queued = pages_queued = pages_seen = refs_walked = 0;
-         evict_entry < end && (ret == 0 || ret == WT_NOTFOUND);
+    for (evict_entry = start + pages_queued, pages_already_queued = pages_seen = refs_walked = 0;
+         !dirty_index_queued && evict_entry < end && (ret == 0 || ret == WT_NOTFOUND);
          last_parent = ref == NULL ? NULL : ref->home,
         ret = __wt_tree_walk_count(session, &ref, &refs_walked, walk_flags)) {
 
@@ -2608,6 +2883,34 @@ __evict_walk_tree(WT_SESSION_IMPL *session, WTI_EVICT_QUEUE *queue, u_int max_en
     return (0);
 }
 
+/*
+ * __evict_numa_local_first --
+ *     Move the first of the next few queued pages on the calling thread's NUMA node to the front of
+ *     the queue. The pages it moves ahead of are still evicted in turn.
+ */
+static void
+__evict_numa_local_first(WT_SESSION_IMPL *session, WTI_EVICT_QUEUE *queue, uint32_t candidates)
+{
+    WTI_EVICT_ENTRY *end, *evict_entry, tmp;
+    u_int node;
+
+    if ((evict_entry = queue->evict_current) == NULL)
+        return;
+
+    node = __wt_numa_node_current(&S2C(session)->cache->numa);
+    end = WT_MIN(queue->evict_queue + candidates, evict_entry + WTI_EVICT_NUMA_LOOKAHEAD);
+    for (; evict_entry < end; ++evict_entry)
+        if (evict_entry->ref != NULL && evict_entry->ref->page->numa_node == node)
+            break;
+    if (evict_entry >= end || evict_entry == queue->evict_current)
+        return;
+
+    tmp = *queue->evict_current;
+    *queue->evict_current = *evict_entry;
+    *evict_entry = tmp;
+    WT_STAT_CONN_INCR(session, eviction_numa_worker_local);
+}
+
 /*
  * __evict_get_ref --
  *     Get a page for eviction.
@@ -2710,6 +3013,11 @@ __evict_get_ref(WT_SESSION_IMPL *session, bool is_server, WT_BTREE **btreep, WT_
     if (is_server && queue != urgent_queue && candidates > 1)
         candidates /= 2;
 
+    /* Eviction workers bound to a NUMA node prefer the pages on their node. */
+    if (!is_server && queue != urgent_queue && F_ISSET(session, WT_SESSION_EVICTION) &&
+      S2C(session)->cache->numa.nodes > 1)
+        __evict_numa_local_first(session, queue, candidates);
+
     /* Get the next page queued for eviction. */
     for (evict_entry = queue->evict_current;
          evict_entry >= queue->evict_queue && evict_entry < queue->evict_queue + candidates;
@@ -2771,6 +3079,49 @@ __evict_get_ref(WT_SESSION_IMPL *session, bool is_server, WT_BTREE **btreep, WT_
     return (*refp == NULL ? WT_NOTFOUND : 0);
 }
 
+/*
+ * __evict_app_handoff_admit --
+ *     Admit the oldest application thread waiting for the eviction threads, after a page was
+ *     evicted.
+ */
+static void
+__evict_app_handoff_admit(WT_SESSION_IMPL *session)
+{
+    WT_EVICT *evict;
+    uint64_t admitted;
+
+    evict = S2C(session)->evict;
+    if (__wt_atomic_load32(&evict->app_handoff_waiters) == 0)
+        return;
+
+    /*
+     * Only admit tickets that have been taken, a later arrival shouldn't skip the wait. Losing a
+     * race with another eviction thread is fine, the page it evicted admitted the ticket.
+     */
+    admitted = __wt_atomic_load64(&evict->app_handoff_admitted);
+    if (admitted < __wt_atomic_load64(&evict->app_handoff_tickets) &&
+      __wt_atomic_cas64(&evict->app_handoff_admitted, admitted, admitted + 1))
+        __wt_cond_signal(session, evict->app_handoff_cond);
+}
+
+/*
+ * __evict_app_handoff_leave --
+ *     An application thread stopped waiting for the eviction threads without being admitted, admit
+ *     its ticket so later arrivals don't wait for it.
+ */
+static void
+__evict_app_handoff_leave(WT_SESSION_IMPL *session, uint64_t ticket)
+{
+    WT_EVICT *evict;
+    uint64_t admitted;
+
+    evict = S2C(session)->evict;
+    for (admitted = __wt_atomic_load64(&evict->app_handoff_admitted); admitted <= ticket;
+         admitted = __wt_atomic_load64(&evict->app_handoff_admitted))
+        if (__wt_atomic_cas64(&evict->app_handoff_admitted, admitted, ticket + 1))
+            break;
+}
+
 /*
  * __evict_page --
  *     Called by both eviction and application threads to evict a page.
@@ -2780,12 +3131,13 @@ __evict_page(WT_SESSION_IMPL *session, bool is_server)
 {
     WT_BTREE *btree;
     WT_DECL_RET;
+    WT_EVICT_TRACE_RECORD trace;
     WT_REF *ref;
     WT_REF_STATE previous_state;
     WT_TRACK_OP_DECL;
     uint64_t time_start, time_stop;
     uint32_t flags;
-    bool page_is_modified;
+    bool page_is_modified, trace_evict;
 
     WT_TRACK_OP_INIT(session);
 
@@ -2811,7 +3163,12 @@ __evict_page(WT_SESSION_IMPL *session, bool is_server)
         }
         WT_STAT_CONN_INCR(session, eviction_app_attempt);
         S2C(session)->evict->app_evicts++;
-        time_start = WT_STAT_ENABLED(session) ? __wt_clock(session) : 0;
+        /* A shared cache weighs the time application threads spend evicting. */
+        if (F_ISSET_ATOMIC_32(S2C(session), WT_CONN_CACHE_POOL)) {
+            __wt_cache_pool_wake(session);
+            time_start = __wt_clock(session);
+        } else if (WT_STAT_ENABLED(session))
+            time_start = __wt_clock(session);
     }
 
     /*
@@ -2823,12 +3180,26 @@ __evict_page(WT_SESSION_IMPL *session, bool is_server)
      */
     __wti_evict_read_gen_bump(session, ref->page);
 
+    if ((trace_evict = __wt_evict_trace_enabled(session)))
+        __wt_evict_trace_page(btree, ref, WT_EVICT_TRACE_EVICT,
+          F_ISSET(session, WT_SESSION_INTERNAL) ? 0 : WT_EVICT_TRACE_APP, &trace);
+
     WT_WITH_BTREE(session, btree, ret = __wt_evict(session, ref, previous_state, flags));
 
+    if (trace_evict) {
+        if (ret != 0)
+            trace.type = WT_EVICT_TRACE_EVICT_FAIL;
+        __wt_evict_trace_add(session, &trace);
+    }
+
     (void)__wt_atomic_subv32(&btree->evict_busy, 1);
 
+    if (ret == 0 && F_ISSET(session, WT_SESSION_INTERNAL))
+        __evict_app_handoff_admit(session);
+
     if (time_start != 0) {
         time_stop = __wt_clock(session);
+        S2C(session)->evict->app_time_us += WT_CLOCKDIFF_US(time_stop, time_start);
         WT_STAT_CONN_INCRV(session, eviction_app_time, WT_CLOCKDIFF_US(time_stop, time_start));
     }
 
@@ -2869,6 +3240,8 @@ __wti_evict_app_assist_worker(
     uint64_t time_start = 0;
     WT_TXN_GLOBAL *txn_global = &conn->txn_global;
     WT_TXN_SHARED *txn_shared = WT_SESSION_TXN_SHARED(session);
+    uint64_t ticket = 0;
+    bool handoff = false, handoff_admitted = false;
 
     uint64_t cache_max_wait_us =
       session->cache_max_wait_us != 0 ? session->cache_max_wait_us : evict->cache_max_wait_us;
@@ -2889,6 +3262,17 @@ __wti_evict_app_assist_worker(
     if (!F_ISSET(session, WT_SESSION_INTERNAL))
         time_start = __wt_clock(session);
 
+    /*
+     * With application handoff, application threads take a ticket and wait for the eviction
+     * threads to admit it rather than evicting pages themselves.
+     */
+    if (time_start != 0 && __wt_atomic_loadbool(&evict->app_handoff)) {
+        handoff = true;
+        ticket = __wt_atomic_fetch_add64(&evict->app_handoff_tickets, 1);
+        (void)__wt_atomic_add32(&evict->app_handoff_waiters, 1);
+        WT_STAT_CONN_INCR(session, eviction_app_handoff_wait);
+    }
+
     /*
      * Note that this for loop is designed to reset expected eviction error codes before exiting,
      * namely, the busy return and empty eviction queue. We do not need the calling functions to
@@ -2950,6 +3334,22 @@ __wti_evict_app_assist_worker(
         if (!__evict_check_user_ok_with_eviction(session, interruptible))
             break;
 
+        /* Wait for the eviction threads to admit our ticket, up to the maximum wait. */
+        if (handoff) {
+            if (ticket < __wt_atomic_load64(&evict->app_handoff_admitted)) {
+                WT_STAT_CONN_INCR(session, eviction_app_handoff_admitted);
+                handoff_admitted = true;
+                break;
+            }
+            if (WT_CLOCKDIFF_US(__wt_clock(session), time_start) >=
+              evict->app_handoff_wait_max_us) {
+                WT_STAT_CONN_INCR(session, eviction_app_handoff_timed_out);
+                break;
+            }
+            __wt_cond_wait(session, evict->app_handoff_cond, WT_THOUSAND, NULL);
+            continue;
+        }
+
         /* Evict a page. */
         ret = __evict_page(session, false);
         if (ret == 0) {
@@ -2965,6 +3365,12 @@ __wti_evict_app_assist_worker(
     }
 
 err:
+    if (handoff) {
+        (void)__wt_atomic_sub32(&evict->app_handoff_waiters, 1);
+        if (!handoff_admitted)
+            __evict_app_handoff_leave(session, ticket);
+    }
+
     if (time_start != 0) {
         uint64_t time_stop = __wt_clock(session);
         uint64_t elapsed = WT_CLOCKDIFF_US(time_stop, time_start);
@@ -373,6 +373,7 @@ __evict_delete_ref(WT_SESSION_IMPL *session, WT_REF *ref, uint32_t flags)
 static int
 __evict_page_clean_update(WT_SESSION_IMPL *session, WT_REF *ref, uint32_t flags)
 {
+    WT_ADDR_COPY addr;
     WT_DECL_RET;
     bool instantiated;
 
@@ -387,6 +388,14 @@ __evict_page_clean_update(WT_SESSION_IMPL *session, WT_REF *ref, uint32_t flags)
         instantiated = false;
     }
 
+    /*
+     * A page unmodified since it was read can be kept in the block cache as a compressed image,
+     * avoiding a read if the page is needed again. Don't bother when closing the tree.
+     */
+    if (ref->page->modify == NULL && !LF_ISSET(WT_EVICT_CALL_CLOSING) &&
+      !F_ISSET(session->dhandle, WT_DHANDLE_DEAD) && __wt_ref_addr_copy(session, ref, &addr))
+        __wt_blkcache_evict_put(session, ref->page, addr.addr, addr.size);
+
     /*
      * Discard the page and update the reference structure. A leaf page without a disk address is a
      * deleted page that either was created empty and never written out, or had its on-disk page
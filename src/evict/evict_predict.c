@@ -0,0 +1,210 @@
+/*-
+ * Copyright (c) 2014-present MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * Predictive tuning forecasts the cache's growth so eviction can start before the cache crosses a
+ * target, rather than after. The eviction server samples the cache's content, dirty content and
+ * updates, and keeps a moving average of how fast each grows. The growth expected over a horizon
+ * starts eviction early, starts worker threads and lengthens tree walks.
+ *
+ * The forecast horizon is the configured horizon while eviction keeps ahead of the application. If
+ * application threads are still needed to evict pages, the forecast was too short: the horizon is
+ * doubled, up to a limit, and is halved again once application threads haven't evicted pages for a
+ * while.
+ *
+ * Checkpoints clean dirty pages, so the dirty content's growth isn't sampled while a checkpoint
+ * runs. The interval between checkpoint starts and the checkpoints' duration are also tracked. When
+ * the next checkpoint is due within the horizon, the dirty content's forecast also covers the
+ * checkpoint, while eviction skips the dirty pages of the trees being checkpointed.
+ */
+
+/*
+ * __evict_predict_rate --
+ *     Return a growth rate in bytes per second, updated with a new sample.
+ */
+static double
+__evict_predict_rate(double rate, uint64_t last, uint64_t current, uint64_t delta_ms)
+{
+    double sample;
+
+    sample = ((double)current - (double)last) * WT_THOUSAND / (double)delta_ms;
+    return (rate + (sample - rate) / 4);
+}
+
+/*
+ * __evict_predict_growth --
+ *     Return the bytes a growth rate adds over a horizon.
+ */
+static uint64_t
+__evict_predict_growth(double rate, uint64_t horizon_ms)
+{
+    return (rate > 0 ? (uint64_t)(rate * (double)horizon_ms / WT_THOUSAND) : 0);
+}
+
+/*
+ * __evict_predict_pressure --
+ *     Return how far forecast content is between its eviction target and trigger, as a percentage.
+ */
+static uint32_t
+__evict_predict_pressure(uint64_t bytes, uint64_t bytes_max, double target, double trigger)
+{
+    double pct;
+
+    pct = (double)bytes * 100 / (double)bytes_max;
+    if (pct <= target)
+        return (0);
+    if (pct >= trigger)
+        return (100);
+    return ((uint32_t)((pct - target) * 100 / (trigger - target)));
+}
+
+/*
+ * __evict_predict_reset --
+ *     Discard the forecast, the next sample starts again.
+ */
+static void
+__evict_predict_reset(WT_EVICT *evict)
+{
+    evict->predict_last_time.tv_sec = 0;
+    evict->predict_rate_inuse = evict->predict_rate_dirty = evict->predict_rate_updates = 0;
+    evict->predict_inuse_growth = evict->predict_dirty_growth = evict->predict_updates_growth = 0;
+    evict->predict_pressure = 0;
+    evict->predict_quiet = 0;
+    evict->predict_ckpt_running = evict->predict_ckpt_soon = false;
+    evict->predict_ckpt_start.tv_sec = 0;
+    evict->predict_ckpt_interval_ms = evict->predict_ckpt_duration_ms = 0;
+}
+
+/*
+ * __wti_evict_predict_update --
+ *     Sample the cache and update the forecast. Called by the eviction server.
+ */
+void
+__wti_evict_predict_update(WT_SESSION_IMPL *session)
+{
+    struct timespec now;
+    WT_CACHE *cache;
+    WT_CONNECTION_IMPL *conn;
+    WT_EVICT *evict;
+    uint64_t app, bytes_dirty, bytes_inuse, bytes_max, bytes_updates, ckpt_gen, delta_ms,
+      horizon_config_ms, since_ckpt_ms;
+    uint32_t pressure, pressure_dirty, pressure_updates;
+    bool ckpt_running, ckpt_started;
+
+    conn = S2C(session);
+    cache = conn->cache;
+    evict = conn->evict;
+
+    if (!__wt_atomic_loadbool(&evict->predict)) {
+        if (evict->predict_last_time.tv_sec != 0)
+            __evict_predict_reset(evict);
+        return;
+    }
+
+    __wt_epoch(session, &now);
+    delta_ms = WT_TIMEDIFF_MS(now, evict->predict_last_time);
+    if (evict->predict_last_time.tv_sec != 0 && delta_ms < WTI_EVICT_PREDICT_PERIOD)
+        return;
+
+    horizon_config_ms = __wt_atomic_load64(&evict->predict_horizon_config_ms);
+    bytes_inuse = __wt_cache_bytes_inuse(cache);
+    bytes_dirty = __wt_cache_dirty_leaf_inuse(cache);
+    bytes_updates = __wt_cache_bytes_updates(cache);
+    app = evict->app_evicts + evict->app_waits + __wt_atomic_load64(&evict->app_handoff_tickets);
+    ckpt_running = __wt_atomic_loadvbool(&conn->txn_global.checkpoint_running);
+    ckpt_gen = __wt_gen(session, WT_GEN_CHECKPOINT);
+
+    /* The first sample only records the cache's state. */
+    if (evict->predict_last_time.tv_sec == 0) {
+        evict->predict_horizon_ms = horizon_config_ms;
+        goto done;
+    }
+
+    evict->predict_rate_inuse = __evict_predict_rate(
+      evict->predict_rate_inuse, evict->predict_last_inuse, bytes_inuse, delta_ms);
+    evict->predict_rate_updates = __evict_predict_rate(
+      evict->predict_rate_updates, evict->predict_last_updates, bytes_updates, delta_ms);
+
+    /* Checkpoints bump the checkpoint generation when they start. */
+    ckpt_started = ckpt_gen != evict->predict_ckpt_gen;
+    if (!ckpt_running && !ckpt_started && !evict->predict_ckpt_running)
+        evict->predict_rate_dirty = __evict_predict_rate(
+          evict->predict_rate_dirty, evict->predict_last_dirty, bytes_dirty, delta_ms);
+
+    /* Track the interval between checkpoint starts, and how long checkpoints run. */
+    if (ckpt_started) {
+        if (evict->predict_ckpt_start.tv_sec != 0)
+            evict->predict_ckpt_interval_ms = WT_TIMEDIFF_MS(now, evict->predict_ckpt_start);
+        evict->predict_ckpt_start = now;
+    }
+    if (!ckpt_running && (ckpt_started || evict->predict_ckpt_running))
+        evict->predict_ckpt_duration_ms = WT_TIMEDIFF_MS(now, evict->predict_ckpt_start);
+
+    /*
+     * Extend the horizon if application threads evicted pages or waited for eviction since the last
+     * sample, shorten it after a period without.
+     */
+    if (app != evict->predict_last_app) {
+        evict->predict_quiet = 0;
+        if (evict->predict_horizon_ms < horizon_config_ms * WTI_EVICT_PREDICT_HORIZON_MAX) {
+            evict->predict_horizon_ms *= 2;
+            WT_STAT_CONN_INCR(session, eviction_predict_horizon_extended);
+        }
+    } else if (++evict->predict_quiet >= WTI_EVICT_PREDICT_QUIET) {
+        evict->predict_quiet = 0;
+        evict->predict_horizon_ms /= 2;
+    }
+    evict->predict_horizon_ms =
+      WT_MIN(evict->predict_horizon_ms, horizon_config_ms * WTI_EVICT_PREDICT_HORIZON_MAX);
+    evict->predict_horizon_ms = WT_MAX(evict->predict_horizon_ms, horizon_config_ms);
+
+    evict->predict_inuse_growth =
+      __evict_predict_growth(evict->predict_rate_inuse, evict->predict_horizon_ms);
+    evict->predict_dirty_growth =
+      __evict_predict_growth(evict->predict_rate_dirty, evict->predict_horizon_ms);
+    evict->predict_updates_growth =
+      __evict_predict_growth(evict->predict_rate_updates, evict->predict_horizon_ms);
+
+    /*
+     * A checkpoint is due within the horizon if the checkpoints so far were regular. Checkpoints
+     * that stopped, more than twice their interval ago, aren't forecast. Eviction skips the dirty
+     * pages of the trees being checkpointed, forecast the dirty content's growth until the
+     * checkpoint completes.
+     */
+    since_ckpt_ms = WT_TIMEDIFF_MS(now, evict->predict_ckpt_start);
+    evict->predict_ckpt_soon = !ckpt_running && evict->predict_ckpt_interval_ms != 0 &&
+      since_ckpt_ms + evict->predict_horizon_ms >= evict->predict_ckpt_interval_ms &&
+      since_ckpt_ms < 2 * evict->predict_ckpt_interval_ms;
+    if (evict->predict_ckpt_soon && evict->predict_ckpt_duration_ms != 0) {
+        evict->predict_dirty_growth +=
+          __evict_predict_growth(evict->predict_rate_dirty, evict->predict_ckpt_duration_ms);
+        WT_STAT_CONN_INCR(session, eviction_predict_checkpoint);
+    }
+
+    /* Avoid division by zero if the cache size has not yet been set in a shared cache. */
+    bytes_max = conn->cache_size + 1;
+    pressure = __evict_predict_pressure(bytes_inuse + evict->predict_inuse_growth, bytes_max,
+      evict->eviction_target, evict->eviction_trigger);
+    pressure_dirty = __evict_predict_pressure(bytes_dirty + evict->predict_dirty_growth, bytes_max,
+      __wti_evict_dirty_target(evict), evict->eviction_dirty_trigger);
+    pressure_updates = __evict_predict_pressure(bytes_updates + evict->predict_updates_growth,
+      bytes_max, evict->eviction_updates_target, evict->eviction_updates_trigger);
+    pressure = WT_MAX(pressure, WT_MAX(pressure_dirty, pressure_updates));
+    evict->predict_pressure = pressure;
+
+done:
+    evict->predict_last_time = now;
+    evict->predict_last_inuse = bytes_inuse;
+    evict->predict_last_dirty = bytes_dirty;
+    evict->predict_last_updates = bytes_updates;
+    evict->predict_last_app = app;
+    evict->predict_ckpt_gen = ckpt_gen;
+    evict->predict_ckpt_running = ckpt_running;
+}
@@ -15,6 +15,15 @@
 #define WTI_EVICT_MAX_TREES WT_THOUSAND /* Maximum walk points */
 #define WTI_EVICT_WALK_BASE 300         /* Pages tracked across file visits */
 #define WTI_EVICT_WALK_INCR 100         /* Pages added each walk */
+#define WTI_EVICT_NUMA_LOOKAHEAD 8      /* Queued pages checked for the worker's node */
+
+/*
+ * Predictive tuning constants: the sample period, how far the forecast horizon is extended while
+ * application threads are evicting pages, and how many quiet samples shorten it again.
+ */
+#define WTI_EVICT_PREDICT_HORIZON_MAX 8 /* Horizon limit, a multiple of the configured horizon */
+#define WTI_EVICT_PREDICT_PERIOD 100    /* Sample period in milliseconds */
+#define WTI_EVICT_PREDICT_QUIET 50      /* Quiet samples before the horizon is shortened */
 
 /*
  * WTI_EVICT_ENTRY --
@@ -51,7 +60,14 @@ struct __wti_evict_queue {
 
 extern int __wti_evict_app_assist_worker(WT_SESSION_IMPL *session, bool busy, bool readonly,
   bool interruptible) WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
+extern int __wti_evict_dirty_index_next(WT_SESSION_IMPL *session, WT_REF **refp)
+  WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
+extern int __wti_evict_trace_config(WT_SESSION_IMPL *session, const char *cfg[])
+  WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
+extern int __wti_evict_trace_destroy(WT_SESSION_IMPL *session)
+  WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
 extern void __wti_evict_list_clear_page(WT_SESSION_IMPL *session, WT_REF *ref);
+extern void __wti_evict_predict_update(WT_SESSION_IMPL *session);
 static WT_INLINE bool __wti_evict_hs_dirty(WT_SESSION_IMPL *session)
   WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
 static WT_INLINE bool __wti_evict_readgen_is_soon_or_wont_need(uint64_t *readgen)
@@ -60,6 +76,9 @@ static WT_INLINE bool __wti_evict_updates_needed(WT_SESSION_IMPL *session, doubl
   WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
 static WT_INLINE double __wti_evict_dirty_target(WT_EVICT *evict)
   WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
+static WT_INLINE uint8_t __wti_evict_freq_estimate(WT_SESSION_IMPL *session, WT_REF *ref)
+  WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
+static WT_INLINE void __wti_evict_freq_record(WT_SESSION_IMPL *session, WT_REF *ref);
 static WT_INLINE void __wti_evict_read_gen_bump(WT_SESSION_IMPL *session, WT_PAGE *page);
 static WT_INLINE void __wti_evict_read_gen_new(WT_SESSION_IMPL *session, WT_PAGE *page);
 
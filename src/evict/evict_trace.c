@@ -0,0 +1,209 @@
+/*-
+ * Copyright (c) 2014-present MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * The eviction trace records page accesses and reads, the pages eviction queues, and the outcome
+ * of each eviction, so the workload's access pattern can be replayed offline against other
+ * eviction policies and cache sizes (see test/simulator/eviction).
+ *
+ * Sessions buffer records and append the buffer to the trace file when it fills or the session
+ * closes, so the file's records are only ordered within a buffer: the decoder sorts them by their
+ * timestamps. Each trace file has a generation, records a session buffered for an earlier file are
+ * discarded.
+ */
+
+/*
+ * __evict_trace_close --
+ *     Close the trace file.
+ */
+static int
+__evict_trace_close(WT_SESSION_IMPL *session)
+{
+    WT_DECL_RET;
+    WT_EVICT *evict;
+
+    evict = S2C(session)->evict;
+
+    __wt_atomic_storebool(&evict->trace, false);
+
+    __wt_spin_lock(session, &evict->trace_lock);
+    if (evict->trace_fh != NULL)
+        ret = __wt_close(session, &evict->trace_fh);
+    __wt_spin_unlock(session, &evict->trace_lock);
+    return (ret);
+}
+
+/*
+ * __evict_trace_open --
+ *     Open a new trace file and write its header.
+ */
+static int
+__evict_trace_open(WT_SESSION_IMPL *session, WT_CONFIG_ITEM *path)
+{
+    struct timespec ts;
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_ITEM(buf);
+    WT_DECL_ITEM(dir);
+    WT_DECL_RET;
+    WT_EVICT *evict;
+    WT_EVICT_TRACE_HEADER header;
+    uint64_t gen;
+    bool exist;
+
+    conn = S2C(session);
+    evict = conn->evict;
+
+    WT_CLEAR(header);
+    header.magic = WT_EVICT_TRACE_MAGIC;
+    header.version = WT_EVICT_TRACE_VERSION;
+    header.record_size = (uint32_t)sizeof(WT_EVICT_TRACE_RECORD);
+    header.tsc_nsec_ratio = (uint32_t)(__wt_process.tsc_nsec_ratio * WT_THOUSAND);
+    __wt_epoch(session, &ts);
+    header.seconds_epoch = (uint64_t)ts.tv_sec;
+    header.cache_size = conn->cache_size;
+
+    /*
+     * Trace files are named for the process and the trace's generation. Don't overwrite the traces
+     * of an earlier connection in the same process, skip to the next unused generation.
+     */
+    WT_RET(__wt_scr_alloc(session, 0, &dir));
+    WT_ERR(__wt_buf_fmt(session, dir, "%.*s", (int)path->len, path->str));
+    WT_ERR(__wt_scr_alloc(session, 0, &buf));
+    for (gen = __wt_atomic_load64(&evict->trace_gen) + 1;; ++gen) {
+        WT_ERR(__wt_filename_construct(session, (const char *)dir->data, "WiredTigerEvictTrace",
+          __wt_process_id(), (uint32_t)gen, buf));
+        WT_ERR(__wt_fs_exist(session, (const char *)buf->data, &exist));
+        if (!exist)
+            break;
+    }
+
+    __wt_spin_lock(session, &evict->trace_lock);
+    WT_ERR(__wt_open(session, (const char *)buf->data, WT_FS_OPEN_FILE_TYPE_REGULAR,
+      WT_FS_OPEN_CREATE, &evict->trace_fh));
+    if ((ret = __wt_write(session, evict->trace_fh, 0, sizeof(header), &header)) != 0) {
+        WT_TRET(__wt_close(session, &evict->trace_fh));
+        WT_ERR(ret);
+    }
+    evict->trace_offset = (wt_off_t)sizeof(header);
+    __wt_atomic_store64(&evict->trace_gen, gen);
+    __wt_atomic_storebool(&evict->trace, true);
+
+err:
+    __wt_spin_unlock_if_owned(session, &evict->trace_lock);
+    __wt_scr_free(session, &buf);
+    __wt_scr_free(session, &dir);
+    return (ret);
+}
+
+/*
+ * __wti_evict_trace_config --
+ *     Start or stop tracing eviction decisions.
+ */
+int
+__wti_evict_trace_config(WT_SESSION_IMPL *session, const char *cfg[])
+{
+    WT_CONFIG_ITEM cval;
+    WT_EVICT *evict;
+
+    evict = S2C(session)->evict;
+
+    WT_RET(__wt_config_gets(session, cfg, "eviction.trace", &cval));
+    if (cval.val == 0)
+        return (__evict_trace_close(session));
+
+    /* A trace continues into its file until tracing is stopped. */
+    if (__wt_atomic_loadbool(&evict->trace))
+        return (0);
+
+    if (F_ISSET_ATOMIC_32(S2C(session), WT_CONN_READONLY))
+        WT_RET_MSG(
+          session, EINVAL, "eviction tracing is incompatible with read only configuration");
+
+    WT_RET(__wt_config_gets(session, cfg, "eviction.trace_path", &cval));
+    return (__evict_trace_open(session, &cval));
+}
+
+/*
+ * __wti_evict_trace_destroy --
+ *     Close the trace file and discard the trace lock.
+ */
+int
+__wti_evict_trace_destroy(WT_SESSION_IMPL *session)
+{
+    WT_DECL_RET;
+
+    ret = __evict_trace_close(session);
+    __wt_spin_destroy(session, &S2C(session)->evict->trace_lock);
+    return (ret);
+}
+
+/*
+ * __wt_evict_trace_flush --
+ *     Append the session's buffered records to the trace file.
+ */
+void
+__wt_evict_trace_flush(WT_SESSION_IMPL *session)
+{
+    WT_DECL_RET;
+    WT_EVICT *evict;
+    size_t len;
+
+    if (session->evict_trace_next == 0 || (evict = S2C(session)->evict) == NULL)
+        return;
+
+    len = session->evict_trace_next * sizeof(WT_EVICT_TRACE_RECORD);
+    __wt_spin_lock(session, &evict->trace_lock);
+    if (evict->trace_fh != NULL && session->evict_trace_gen == evict->trace_gen) {
+        /*
+         * Write directly to the file handle, like operation tracking: the standard write path
+         * would add statistics and atomic operations to every flush.
+         */
+        ret = evict->trace_fh->handle->fh_write(evict->trace_fh->handle, (WT_SESSION *)session,
+          evict->trace_offset, len, session->evict_trace_buf);
+        if (ret == 0) {
+            evict->trace_offset += (wt_off_t)len;
+            WT_STAT_CONN_INCRV(session, eviction_trace_records, session->evict_trace_next);
+        }
+    }
+    __wt_spin_unlock(session, &evict->trace_lock);
+    session->evict_trace_next = 0;
+
+    /* A trace that can't be written is incomplete, stop tracing. */
+    if (ret != 0) {
+        __wt_atomic_storebool(&evict->trace, false);
+        __wt_err(session, ret, "eviction trace write failed, eviction tracing stopped");
+    }
+}
+
+/*
+ * __wt_evict_trace_add --
+ *     Add a record to the session's buffer, flushing the buffer if it's full.
+ */
+void
+__wt_evict_trace_add(WT_SESSION_IMPL *session, WT_EVICT_TRACE_RECORD *trace)
+{
+    uint64_t gen;
+
+    if (session->evict_trace_buf == NULL &&
+      __wt_calloc_def(session, WT_EVICT_TRACE_MAXRECS, &session->evict_trace_buf) != 0)
+        return;
+
+    /* Discard records buffered for an earlier trace file. */
+    gen = __wt_atomic_load64(&S2C(session)->evict->trace_gen);
+    if (session->evict_trace_gen != gen) {
+        session->evict_trace_gen = gen;
+        session->evict_trace_next = 0;
+    }
+
+    trace->timestamp = __wt_clock(session);
+    session->evict_trace_buf[session->evict_trace_next] = *trace;
+    if (++session->evict_trace_next == WT_EVICT_TRACE_MAXRECS)
+        __wt_evict_trace_flush(session);
+}
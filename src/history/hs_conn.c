@@ -68,6 +68,15 @@ __wt_hs_config(WT_SESSION_IMPL *session, const char **cfg)
     conn = S2C(session);
     tmp_setup_session = NULL;
 
+    WT_ERR(__wt_config_gets(session, cfg, "history_store.delta_chain_max", &cval));
+    conn->cache->hs_delta_chain_max = (u_int)cval.val;
+
+    WT_ERR(__wt_config_gets(session, cfg, "history_store.drop_truncate", &cval));
+    conn->cache->hs_drop_background = WT_CONFIG_LIT_MATCH("background", cval);
+
+    WT_ERR(__wt_config_gets(session, cfg, "history_store.key_filter_size", &cval));
+    conn->cache->hs_filter_size = (uint64_t)cval.val;
+
     WT_ERR(__wt_config_gets(session, cfg, "history_store.file_max", &cval));
     if (cval.val != 0 && cval.val < WT_HS_FILE_MIN)
         WT_ERR_MSG(session, EINVAL, "max history store size %" PRId64 " below minimum %d", cval.val,
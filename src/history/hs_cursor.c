@@ -66,7 +66,7 @@ __wt_hs_find_upd(WT_SESSION_IMPL *session, uint32_t btree_id, WT_ITEM *key,
     size_t max_memsize;
     uint64_t upd_type_full;
     uint8_t *p, recno_key_buf[WT_INTPACK64_MAXSIZE], upd_type;
-    bool upd_found;
+    bool present, upd_found;
 
     hs_cursor = NULL;
     mod_upd = NULL;
@@ -90,6 +90,14 @@ __wt_hs_find_upd(WT_SESSION_IMPL *session, uint32_t btree_id, WT_ITEM *key,
         key->size = WT_PTRDIFF(p, recno_key_buf);
     }
 
+    /* Skip the search if the key has never been written to the history store. */
+    WT_ASSERT(session, S2BT(session)->id == btree_id);
+    WT_ERR(__wt_hs_filter_check(session, S2BT(session), key, &present));
+    if (!present) {
+        WT_STAT_CONN_DSRC_INCR(session, cache_hs_filter_skip);
+        goto done;
+    }
+
     /*
      * If reading from a checkpoint, it is possible to get here because the history store is
      * currently open, but not be able to get a cursor because there was no history store in the
@@ -326,3 +334,96 @@ err:
 
     return (ret);
 }
+
+/*
+ * __hs_btree_dropped_next --
+ *     Return the first file dropped with its history store content still to be truncated.
+ */
+static int
+__hs_btree_dropped_next(WT_SESSION_IMPL *session, WT_ITEM *uri, uint32_t *btree_idp)
+{
+    WT_CONFIG_ITEM cval;
+    WT_CURSOR *cursor;
+    WT_DECL_RET;
+    int exact;
+    const char *key, *value;
+
+    WT_RET(__wt_metadata_cursor(session, &cursor));
+    cursor->set_key(cursor, WT_SYSTEM_HS_DROP_PREFIX);
+    WT_ERR(cursor->search_near(cursor, &exact));
+    if (exact < 0)
+        WT_ERR(cursor->next(cursor));
+    WT_ERR(cursor->get_key(cursor, &key));
+    if (!WT_PREFIX_MATCH(key, WT_SYSTEM_HS_DROP_PREFIX))
+        WT_ERR(WT_NOTFOUND);
+    WT_ERR(cursor->get_value(cursor, &value));
+    WT_ERR(__wt_config_getones(session, value, "id", &cval));
+    *btree_idp = (uint32_t)cval.val;
+    WT_ERR(__wt_buf_set(session, uri, key, strlen(key) + 1));
+
+err:
+    WT_TRET(__wt_metadata_cursor_release(session, &cursor));
+    return (ret);
+}
+
+/*
+ * __wt_hs_btree_truncate_dropped --
+ *     Truncate the history store content of files dropped with the "background" drop_truncate
+ *     setting, removing each file's record from the metadata once its content is gone.
+ */
+int
+__wt_hs_btree_truncate_dropped(WT_SESSION_IMPL *session, bool (*run_chk)(WT_SESSION_IMPL *))
+{
+    WT_DECL_ITEM(uri);
+    WT_DECL_RET;
+    uint32_t btree_id;
+
+    WT_RET(__wt_scr_alloc(session, 0, &uri));
+
+    while (run_chk(session)) {
+        WT_ERR_NOTFOUND_OK(__hs_btree_dropped_next(session, uri, &btree_id), true);
+        if (ret == WT_NOTFOUND) {
+            ret = 0;
+            break;
+        }
+
+        /* Failing to truncate isn't fatal, the record stays in the metadata for the next pass. */
+        if ((ret = __wt_hs_btree_truncate(session, btree_id)) != 0) {
+            __wt_verbose_warning(session, WT_VERB_HS,
+              "Failed to truncate history store for the dropped file ID %" PRIu32 ": %s", btree_id,
+              __wt_strerror(session, ret, NULL, 0));
+            ret = 0;
+            break;
+        }
+        WT_STAT_CONN_INCR(session, cache_hs_btree_truncate_dropped);
+
+        WT_WITH_SCHEMA_LOCK(session, ret = __wt_metadata_remove(session, (const char *)uri->data));
+        WT_ERR(ret);
+    }
+
+err:
+    __wt_scr_free(session, &uri);
+    return (ret);
+}
+
+/*
+ * __wt_hs_btree_dropped --
+ *     Return if the history store content for a file ID belongs to a dropped file, still to be
+ *     truncated.
+ */
+int
+__wt_hs_btree_dropped(WT_SESSION_IMPL *session, uint32_t btree_id, bool *droppedp)
+{
+    WT_DECL_RET;
+    char *value, uri[64];
+
+    *droppedp = false;
+
+    WT_RET(__wt_snprintf(uri, sizeof(uri), "%s%" PRIu32, WT_SYSTEM_HS_DROP_PREFIX, btree_id));
+    WT_RET_NOTFOUND_OK(ret = __wt_metadata_search(session, uri, &value));
+    if (ret == 0) {
+        *droppedp = true;
+        __wt_free(session, value);
+    }
+    return (0);
+}
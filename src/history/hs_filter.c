@@ -0,0 +1,200 @@
+/*-
+ * Copyright (c) 2014-present MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * The history store key filter is an in-memory Bloom filter per btree, recording the keys written
+ * to the history store since the filter was built. A key that isn't in the filter has no versions
+ * in the history store, and searches for it can be skipped. Keys are never removed from the
+ * filter: a key whose history store content has since been removed costs a search, it doesn't
+ * cause a wrong result.
+ *
+ * The filter is allocated and published before it's built from the btree's history store content.
+ * Reconciliation sets a key's bits after inserting the key into the history store, so any key
+ * inserted concurrently with the build is either found by the build's scan or sets its own bits.
+ */
+#define WT_HS_FILTER_HASHES 4
+
+/*
+ * __hs_filter_hash --
+ *     Return the pair of hashes used to calculate a key's filter bits.
+ */
+static WT_INLINE void
+__hs_filter_hash(const WT_ITEM *key, uint64_t *h1p, uint64_t *h2p)
+{
+    uint64_t h;
+
+    h = __wt_hash_city64(key->data, key->size);
+    *h1p = h;
+    *h2p = (h >> 32 | h << 32) | 1;
+}
+
+/*
+ * __hs_filter_set --
+ *     Set a key's bits in a filter.
+ */
+static void
+__hs_filter_set(uint64_t *filter, uint64_t nbits, const WT_ITEM *key)
+{
+    uint64_t bit, h1, h2;
+    u_int i;
+
+    __hs_filter_hash(key, &h1, &h2);
+    for (i = 0; i < WT_HS_FILTER_HASHES; i++, h1 += h2) {
+        bit = h1 % nbits;
+        (void)__wt_atomic_or_generic(&filter[bit / 64], (uint64_t)1 << (bit % 64));
+    }
+}
+
+/*
+ * __hs_filter_build --
+ *     Build a btree's filter from its history store content.
+ */
+static int
+__hs_filter_build(WT_SESSION_IMPL *session, WT_BTREE *btree)
+{
+    WT_CURSOR *hs_cursor;
+    WT_DECL_ITEM(hs_key);
+    WT_DECL_RET;
+    wt_timestamp_t hs_start_ts;
+    uint64_t *filter, hs_counter, nwords;
+    uint32_t hs_btree_id;
+
+    hs_cursor = NULL;
+
+    /* Publish the filter before the scan, a filter left by a failed build is reused. */
+    if (btree->hs_filter == NULL) {
+        nwords = WT_MAX(S2C(session)->cache->hs_filter_size / sizeof(uint64_t), 1);
+        WT_RET(__wt_calloc_def(session, nwords, &filter));
+        btree->hs_filter_bits = nwords * 64;
+        WT_RELEASE_WRITE(btree->hs_filter, filter);
+        WT_FULL_BARRIER();
+    }
+
+    WT_ERR(__wt_scr_alloc(session, 0, &hs_key));
+    WT_ERR(__wt_curhs_open(session, NULL, &hs_cursor));
+    F_SET(hs_cursor, WT_CURSTD_HS_READ_ALL);
+
+    hs_cursor->set_key(hs_cursor, 1, btree->id);
+    for (ret = __wt_curhs_search_near_after(session, hs_cursor); ret == 0;
+         ret = hs_cursor->next(hs_cursor)) {
+        WT_ERR(hs_cursor->get_key(hs_cursor, &hs_btree_id, hs_key, &hs_start_ts, &hs_counter));
+        if (hs_btree_id != btree->id)
+            break;
+        __hs_filter_set(btree->hs_filter, btree->hs_filter_bits, hs_key);
+    }
+    WT_ERR_NOTFOUND_OK(ret, false);
+
+    WT_STAT_CONN_DSRC_INCR(session, cache_hs_filter_build);
+
+err:
+    __wt_scr_free(session, &hs_key);
+    if (hs_cursor != NULL)
+        WT_TRET(hs_cursor->close(hs_cursor));
+    return (ret);
+}
+
+/*
+ * __wt_hs_filter_insert --
+ *     Record a key inserted into the history store in the btree's filter. Called after the insert.
+ */
+void
+__wt_hs_filter_insert(WT_SESSION_IMPL *session, WT_BTREE *btree, const WT_ITEM *key)
+{
+    uint64_t *filter;
+
+    WT_UNUSED(session);
+
+    /* Order the load after the insert, see __hs_filter_build. */
+    WT_FULL_BARRIER();
+    WT_ACQUIRE_READ(filter, btree->hs_filter);
+    if (filter != NULL)
+        __hs_filter_set(filter, btree->hs_filter_bits, key);
+}
+
+/*
+ * __wt_hs_filter_maybe_present --
+ *     Return if a key may have versions in the history store. Returns true unless the btree's
+ *     filter is built and doesn't contain the key.
+ */
+bool
+__wt_hs_filter_maybe_present(WT_SESSION_IMPL *session, WT_BTREE *btree, const WT_ITEM *key)
+{
+    uint64_t bit, h1, h2;
+    uint32_t state;
+    u_int i;
+
+    if (S2C(session)->cache->hs_filter_size == 0)
+        return (true);
+    WT_ACQUIRE_READ(state, btree->hs_filter_state);
+    if (state != WT_HS_FILTER_READY)
+        return (true);
+
+    __hs_filter_hash(key, &h1, &h2);
+    for (i = 0; i < WT_HS_FILTER_HASHES; i++, h1 += h2) {
+        bit = h1 % btree->hs_filter_bits;
+        if ((btree->hs_filter[bit / 64] & ((uint64_t)1 << (bit % 64))) == 0)
+            return (false);
+    }
+    return (true);
+}
+
+/*
+ * __wt_hs_filter_check --
+ *     Return if a reader's key may have versions in the history store, building the btree's filter
+ *     first if needed.
+ */
+int
+__wt_hs_filter_check(WT_SESSION_IMPL *session, WT_BTREE *btree, const WT_ITEM *key, bool *presentp)
+{
+    WT_DECL_RET;
+
+    *presentp = true;
+
+    /*
+     * The filter only describes the current history store: checkpoint readers use the history
+     * store of the checkpoint. Disaggregated storage can pick up history store content written
+     * elsewhere.
+     */
+    if (S2C(session)->cache->hs_filter_size == 0 || WT_READING_CHECKPOINT(session) ||
+      btree->page_log != NULL)
+        return (0);
+
+    /* One reader builds the filter, the others search the history store until it's ready. */
+    if (__wt_atomic_load32(&btree->hs_filter_state) == WT_HS_FILTER_NONE &&
+      __wt_atomic_cas32(&btree->hs_filter_state, WT_HS_FILTER_NONE, WT_HS_FILTER_BUILDING)) {
+        ret = __hs_filter_build(session, btree);
+        WT_RELEASE_WRITE(
+          btree->hs_filter_state, ret == 0 ? WT_HS_FILTER_READY : WT_HS_FILTER_NONE);
+
+        /* Failing to build the filter isn't fatal, the next reader tries again. */
+        if (ret != 0 && ret != WT_PANIC) {
+            __wt_verbose_warning(session, WT_VERB_HS,
+              "failed to build the history store key filter for the file ID %" PRIu32 ": %s",
+              btree->id, __wt_strerror(session, ret, NULL, 0));
+            ret = 0;
+        }
+        WT_RET(ret);
+    }
+
+    *presentp = __wt_hs_filter_maybe_present(session, btree, key);
+    return (0);
+}
+
+/*
+ * __wt_hs_filter_free --
+ *     Discard a btree's filter.
+ */
+void
+__wt_hs_filter_free(WT_SESSION_IMPL *session, WT_BTREE *btree)
+{
+    __wt_free(session, btree->hs_filter);
+    btree->hs_filter_bits = 0;
+    btree->hs_filter_state = WT_HS_FILTER_NONE;
+}
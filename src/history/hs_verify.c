@@ -154,8 +154,9 @@ __wt_hs_verify(WT_SESSION_IMPL *session)
     WT_ITEM key;
     wt_timestamp_t hs_start_ts;
     uint64_t hs_counter;
-    uint32_t btree_id;
+    uint32_t btree_id, dropped_id;
     char *uri_data;
+    bool dropped;
 
     WT_CLEAR(key);
     ds_cursor = hs_cursor = NULL;
@@ -182,6 +183,22 @@ __wt_hs_verify(WT_SESSION_IMPL *session)
          * first key of a new btree id.
          */
         WT_ERR(hs_cursor->get_key(hs_cursor, &btree_id, &key, &hs_start_ts, &hs_counter));
+
+        /* Skip the content of dropped files the checkpoint cleanup thread has yet to truncate. */
+        WT_ERR(__wt_hs_btree_dropped(session, btree_id, &dropped));
+        if (dropped) {
+            dropped_id = btree_id;
+            do {
+                WT_ERR_NOTFOUND_OK(hs_cursor->next(hs_cursor), true);
+                if (ret == WT_NOTFOUND) {
+                    ret = 0;
+                    goto err;
+                }
+                WT_ERR(hs_cursor->get_key(hs_cursor, &btree_id, &key, &hs_start_ts, &hs_counter));
+            } while (btree_id == dropped_id);
+            continue;
+        }
+
         if ((ret = __wt_metadata_btree_id_to_uri(session, btree_id, &uri_data)) != 0) {
             F_SET_ATOMIC_32(S2C(session), WT_CONN_DATA_CORRUPTION);
             WT_ERR_PANIC(session, ret,
@@ -39,6 +39,11 @@
 #define WT_BLKCACHE_RM_FREE 2
 #define WT_BLKCACHE_RM_EVICTION 3
 
+/* Block cache insertion sources. */
+#define WT_BLKCACHE_INSERT_EVICT 1 /* Clean page evicted from the cache */
+#define WT_BLKCACHE_INSERT_READ 2  /* Block read */
+#define WT_BLKCACHE_INSERT_WRITE 3 /* Block written */
+
 /*
  * WT_BLKCACHE_DELTA --
  *     A delta associated with a block in the block cache.
@@ -93,6 +98,7 @@ struct __wt_blkcache {
     int32_t evict_aggressive;                 /* Seconds an unused block stays in the cache */
 
     bool cache_on_checkpoint; /* Don't cache blocks written by checkpoints */
+    bool cache_on_evict;      /* Cache blocks on eviction rather than reads */
     bool cache_on_writes;     /* Cache blocks on writes */
 
 #ifdef ENABLE_MEMKIND
@@ -81,8 +81,15 @@ struct __wt_page_header {
 #define WT_PAGE_FT_UPDATE 0x20u    /* Page contains updated fast-truncate information */
     uint8_t flags;                 /* 25: flags */
 
-    /* A byte of padding, positioned to be added to the flags. */
-    uint8_t unused; /* 26: unused padding */
+/*
+ * The compressor a page was written with, for files configured to choose a compressor per page:
+ * zero is the file's block compressor, other values index the file's adaptive compressors. Pages
+ * that were not adaptively compressed have a zero byte, as this was historically unused padding.
+ * No automatic generation: values cannot change, they're written to disk.
+ */
+#define WT_PAGE_COMPRESSOR_DEFAULT 0x00u /* File's block compressor */
+#define WT_PAGE_COMPRESSOR_NONE 0xffu    /* Written uncompressed after sampling */
+    uint8_t compressor;                  /* 26: adaptive compressor */
 
 #define WT_PAGE_VERSION_ORIG 0 /* Original version */
 #define WT_PAGE_VERSION_TS 1   /* Timestamps added */
@@ -544,6 +551,11 @@ struct __wt_page_modify {
     bool instantiated;        /* True if this is a newly instantiated page. */
     WT_UPDATE **inst_updates; /* Update list for instantiated page with unresolved truncate. */
 
+    /* Dirty page index information, see evict_dirty.c. */
+    TAILQ_ENTRY(__wt_page_modify) dirtyq; /* Tree's dirty page index */
+    WT_PAGE *dirty_page;                  /* Indexed page */
+    WT_REF *dirty_ref;                    /* Indexed page's reference */
+
 #define WT_PAGE_LOCK(s, p) __wt_spin_lock_track((s), &(p)->modify->page_lock)
 #define WT_PAGE_TRYLOCK(s, p) __wt_spin_trylock_track((s), &(p)->modify->page_lock)
 #define WT_PAGE_UNLOCK(s, p) __wt_spin_unlock((s), &(p)->modify->page_lock)
@@ -818,13 +830,14 @@ struct __wt_page {
 #define WT_PAGE_COMPACTION_WRITE 0x002u   /* Writing the page for compaction */
 #define WT_PAGE_DISK_ALLOC 0x004u         /* Disk image in allocated memory */
 #define WT_PAGE_DISK_MAPPED 0x008u        /* Disk image in mapped memory */
-#define WT_PAGE_EVICT_LRU 0x010u          /* Page is on the LRU queue */
-#define WT_PAGE_EVICT_LRU_URGENT 0x020u   /* Page is in the urgent queue */
-#define WT_PAGE_EVICT_NO_PROGRESS 0x040u  /* Eviction doesn't count as progress */
-#define WT_PAGE_INTL_OVERFLOW_KEYS 0x080u /* Internal page has overflow keys (historic only) */
-#define WT_PAGE_PREFETCH 0x100u           /* The page is being pre-fetched */
-#define WT_PAGE_SPLIT_INSERT 0x200u       /* A leaf page was split for append */
-#define WT_PAGE_UPDATE_IGNORE 0x400u      /* Ignore updates on page discard */
+#define WT_PAGE_EVICT_DIRTY_INDEX 0x010u  /* Page is in the tree's dirty page index */
+#define WT_PAGE_EVICT_LRU 0x020u          /* Page is on the LRU queue */
+#define WT_PAGE_EVICT_LRU_URGENT 0x040u   /* Page is in the urgent queue */
+#define WT_PAGE_EVICT_NO_PROGRESS 0x080u  /* Eviction doesn't count as progress */
+#define WT_PAGE_INTL_OVERFLOW_KEYS 0x100u /* Internal page has overflow keys (historic only) */
+#define WT_PAGE_PREFETCH 0x200u           /* The page is being pre-fetched */
+#define WT_PAGE_SPLIT_INSERT 0x400u       /* A leaf page was split for append */
+#define WT_PAGE_UPDATE_IGNORE 0x800u      /* Ignore updates on page discard */
                                           /* AUTOMATIC FLAG VALUE GENERATION STOP 16 */
     wt_shared uint16_t flags_atomic;      /* Atomic flags, use F_*_ATOMIC_16 */
 
@@ -840,7 +853,7 @@ struct __wt_page {
 #define WT_PAGE_ROW_LEAF 7      /* Row-store leaf page */
     uint8_t type;               /* Page type */
 
-    /* 1 byte hole expected. */
+    uint8_t numa_node; /* NUMA node the page is charged to */
 
     wt_shared size_t memory_footprint; /* Memory attached to the page */
 
@@ -89,6 +89,12 @@ typedef enum {
     CKSUM_UNENCRYPTED = 4   /* Unencrypted blocks only */
 } WT_BTREE_CHECKSUM;
 
+typedef enum {
+    WT_COMPRESS_POLICY_NONE = 1,       /* Block compressor only */
+    WT_COMPRESS_POLICY_RATIO = 2,      /* Best sampled compression ratio */
+    WT_COMPRESS_POLICY_TEMPERATURE = 3 /* Block compressor if hot, best sampled ratio if cold */
+} WT_BTREE_COMPRESS_POLICY;
+
 typedef enum { /* Start position for eviction walk */
     WT_EVICT_WALK_PREV,
     WT_EVICT_WALK_NEXT,
@@ -131,6 +137,9 @@ struct __wt_btree {
 
     WT_BTREE_CHECKSUM checksum; /* Checksum configuration */
 
+    u_int cache_quota_max; /* Maximum share of the cache, percent */
+    u_int cache_quota_min; /* Minimum share of the cache, percent */
+
     /*
      * Reconciliation...
      */
@@ -138,6 +147,7 @@ struct __wt_btree {
     bool internal_key_truncate;   /* Internal key truncate */
     bool prefix_compression;      /* Prefix compression */
     u_int prefix_compression_min; /* Prefix compression min */
+    wt_timestamp_t ttl;           /* Record time-to-live */
 
 #define WT_SPLIT_DEEPEN_MIN_CHILD_DEF (10 * WT_THOUSAND)
     u_int split_deepen_min_child; /* Minimum entries to deepen tree */
@@ -156,6 +166,12 @@ struct __wt_btree {
     bool intlpage_compadjust;     /* Run-time compression adjustment */
     uint64_t maxintlpage_precomp; /* Internal page pre-compression size */
 
+    /* Per-page compressor selection, the compressors the policy can choose beyond the default. */
+#define WT_BTREE_COMPRESSOR_ADAPTIVE_MAX 8
+    WT_COMPRESSOR *compressor_adaptive[WT_BTREE_COMPRESSOR_ADAPTIVE_MAX];
+    u_int compressor_adaptive_count;
+    WT_BTREE_COMPRESS_POLICY compress_policy;
+
     WT_BUCKET_STORAGE *bstorage;    /* Tiered storage source */
     WT_KEYED_ENCRYPTOR *kencryptor; /* Page encryptor */
 
@@ -175,6 +191,14 @@ struct __wt_btree {
 
     bool hs_entries; /* Has entries in the history store table */
 
+    /* History store key presence filter, see hs_filter.c. */
+    wt_shared uint64_t *hs_filter; /* Filter bits */
+    uint64_t hs_filter_bits;       /* Filter size in bits */
+#define WT_HS_FILTER_NONE 0     /* Filter not built */
+#define WT_HS_FILTER_BUILDING 1 /* Filter being built */
+#define WT_HS_FILTER_READY 2    /* Filter usable */
+    wt_shared uint32_t hs_filter_state;
+
     WT_BM *bm;          /* Block manager reference */
     u_int block_header; /* WT_PAGE_HEADER_BYTE_SIZE */
 
@@ -252,6 +276,14 @@ struct __wt_btree {
     uint64_t flush_most_recent_secs; /* Wall clock time for the most recent flush */
     uint64_t flush_most_recent_ts;   /* Timestamp of the most recent flush */
 
+    /*
+     * Dirty leaf pages in the order they were first modified, see evict_dirty.c. The index is owned
+     * by eviction, it's cleared when the tree is opened.
+     */
+    WT_SPINLOCK evict_dirty_lock;                                    /* Dirty page index lock */
+    TAILQ_HEAD(__wt_evict_dirty_qh, __wt_page_modify) evict_dirtyqh; /* Dirty page index */
+    wt_shared uint64_t evict_dirty_count;                            /* Dirty page index entries */
+
 /*
  * All of the following fields live at the end of the structure so it's easier to clear everything
  * but the fields that persist.
@@ -36,6 +36,21 @@ __wt_btree_disable_bulk(WT_SESSION_IMPL *session)
     }
 }
 
+/*
+ * __wt_btree_compressor --
+ *     Return the compressor for a page header's compressor byte, NULL if the page isn't to be
+ *     compressed or the byte doesn't match the tree's configuration.
+ */
+static WT_INLINE WT_COMPRESSOR *
+__wt_btree_compressor(WT_BTREE *btree, uint8_t compressor)
+{
+    if (compressor == WT_PAGE_COMPRESSOR_DEFAULT)
+        return (btree->compressor);
+    if (compressor == WT_PAGE_COMPRESSOR_NONE || compressor > btree->compressor_adaptive_count)
+        return (NULL);
+    return (btree->compressor_adaptive[compressor - 1]);
+}
+
 /*
  * __wt_page_is_empty --
  *     Return if the page is empty.
@@ -287,6 +302,8 @@ __wt_cache_page_inmem_incr(WT_SESSION_IMPL *session, WT_PAGE *page, size_t size,
      * threads that are trying to decrease the sizes concurrently.
      */
     (void)__wt_atomic_add64(&cache->bytes_inmem, size);
+    if (cache->numa.nodes > 1)
+        (void)__wt_atomic_add64(&cache->bytes_inmem_numa[page->numa_node], size);
     (void)__wt_atomic_add64(&btree->bytes_inmem, size);
     if (WT_PAGE_IS_INTERNAL(page)) {
         (void)__wt_atomic_add64(&cache->bytes_internal, size);
@@ -479,6 +496,9 @@ __wt_cache_page_inmem_decr(WT_SESSION_IMPL *session, WT_PAGE *page, size_t size)
     __wt_cache_decr_check_size(session, &page->memory_footprint, size, "WT_PAGE.memory_footprint");
     __wt_cache_decr_check_uint64(session, &btree->bytes_inmem, size, "WT_BTREE.bytes_inmem");
     __wt_cache_decr_check_uint64(session, &cache->bytes_inmem, size, "WT_CACHE.bytes_inmem");
+    if (cache->numa.nodes > 1)
+        __wt_cache_decr_check_uint64(
+          session, &cache->bytes_inmem_numa[page->numa_node], size, "WT_CACHE.bytes_inmem_numa");
     if (page->modify != NULL && !WT_PAGE_IS_INTERNAL(page))
         __wt_cache_page_byte_updates_decr(session, page, size);
     if (__wt_page_is_modified(page))
@@ -1955,12 +1975,13 @@ __wt_page_release(WT_SESSION_IMPL *session, WT_REF *ref, uint32_t flags)
 
     if (__wt_evict_page_soon_check(session, ref, &inmem_split)) {
         /*
-         * If the operation has disabled eviction or splitting, or the session is preventing from
-         * reconciling, then just queue the page for urgent eviction. Otherwise, attempt to release
-         * and evict it.
+         * If the operation has disabled eviction or splitting, the session is preventing from
+         * reconciling, or the session hands eviction off to the eviction threads, then just queue
+         * the page for urgent eviction. Otherwise, attempt to release and evict it.
          */
         if (LF_ISSET(WT_READ_NO_EVICT) ||
-          (inmem_split ? LF_ISSET(WT_READ_NO_SPLIT) : F_ISSET(session, WT_SESSION_NO_RECONCILE)))
+          (inmem_split ? LF_ISSET(WT_READ_NO_SPLIT) : F_ISSET(session, WT_SESSION_NO_RECONCILE)) ||
+          __wt_evict_app_handoff(session))
             WT_IGNORE_RET(__wt_evict_page_urgent(session, ref));
         else {
             WT_RET_BUSY_OK(__wt_page_release_evict(session, ref, flags));
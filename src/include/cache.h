@@ -56,7 +56,17 @@ struct __wt_cache {
 
     u_int overhead_pct; /* Cache percent adjustment */
 
-    uint32_t hs_fileid; /* History store table file ID */
+    /*
+     * NUMA partitioning: each page is charged to the node of the thread that allocated it, see
+     * __wt_page_alloc. The cache is partitioned if the machine has more than one node.
+     */
+    WT_NUMA numa;
+    wt_shared uint64_t bytes_inmem_numa[WT_NUMA_NODE_MAX]; /* Bytes in memory on each node */
+
+    uint32_t hs_fileid;       /* History store table file ID */
+    u_int hs_delta_chain_max; /* Maximum consecutive reverse deltas per key in the history store */
+    bool hs_drop_background;  /* Truncate dropped files' history store content in the background */
+    uint64_t hs_filter_size;  /* History store key filter size per btree */
 
     /*
      * The "history_activity" verbose messages are throttled to once per checkpoint. To accomplish
@@ -71,13 +81,21 @@ struct __wt_cache {
     uint64_t cp_pass_pressure;   /* Calculated pressure from this pass */
     uint64_t cp_quota;           /* Maximum size for this cache */
     uint64_t cp_reserved;        /* Base size for this cache */
+    uint32_t cp_priority;        /* Weight of this cache's pressure */
     WT_SESSION_IMPL *cp_session; /* May be used for cache management */
     uint32_t cp_skip_count;      /* Post change stabilization */
     wt_thread_t cp_tid;          /* Thread ID for cache pool manager */
+    bool cp_burst;               /* Application threads evicted in the last pass */
     /* State seen at the last pass of the shared cache manager */
-    uint64_t cp_saved_app_evicts; /* User eviction count at last review */
-    uint64_t cp_saved_app_waits;  /* User wait count at last review */
-    uint64_t cp_saved_read;       /* Read count at last review */
+    uint64_t cp_saved_app_evicts;  /* User eviction count at last review */
+    uint64_t cp_saved_app_time_us; /* User eviction time at last review */
+    uint64_t cp_saved_app_waits;   /* User wait count at last review */
+    uint64_t cp_saved_read;        /* Read count at last review */
+    /* Marginal utility: how much the read rate fell after the cache last grew */
+    uint64_t cp_read_rate;      /* Smoothed reads per pass */
+    uint64_t cp_grow_read_rate; /* Read rate when the cache last grew, 0 if not measuring */
+    uint64_t cp_grow_size;      /* Cache size before it last grew */
+    uint32_t cp_gain;           /* Smoothed fall in reads relative to growth, a percentage */
 
 /*
  * Flags.
@@ -102,6 +120,7 @@ struct __wt_cache_pool {
     uint64_t quota;
     uint64_t currently_used;
     uint32_t refs; /* Reference count for structure. */
+    bool burst;    /* A participant's application threads are evicting */
     /* Locked: List of connections participating in the cache pool. */
     TAILQ_HEAD(__wt_cache_pool_qh, __wt_connection_impl) cache_pool_qh;
 
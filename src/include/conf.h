@@ -142,20 +142,20 @@ WT_CONF_API_DECLARE(WT_CONNECTION, debug_info, 1, 7);
 WT_CONF_API_DECLARE(WT_CONNECTION, load_extension, 1, 4);
 WT_CONF_API_DECLARE(WT_CONNECTION, open_session, 3, 9);
 WT_CONF_API_DECLARE(WT_CONNECTION, query_timestamp, 1, 1);
-WT_CONF_API_DECLARE(WT_CONNECTION, reconfigure, 19, 106);
+WT_CONF_API_DECLARE(WT_CONNECTION, reconfigure, 19, 121);
 WT_CONF_API_DECLARE(WT_CONNECTION, rollback_to_stable, 1, 2);
 WT_CONF_API_DECLARE(WT_CONNECTION, set_timestamp, 1, 4);
 WT_CONF_API_DECLARE(WT_CURSOR, bound, 1, 3);
 WT_CONF_API_DECLARE(WT_CURSOR, reconfigure, 1, 3);
-WT_CONF_API_DECLARE(WT_SESSION, alter, 3, 16);
+WT_CONF_API_DECLARE(WT_SESSION, alter, 4, 20);
 WT_CONF_API_DECLARE(WT_SESSION, begin_transaction, 2, 11);
 WT_CONF_API_DECLARE(WT_SESSION, checkpoint, 3, 12);
 WT_CONF_API_DECLARE(WT_SESSION, commit_transaction, 1, 4);
 WT_CONF_API_DECLARE(WT_SESSION, compact, 1, 6);
-WT_CONF_API_DECLARE(WT_SESSION, create, 6, 67);
+WT_CONF_API_DECLARE(WT_SESSION, create, 8, 75);
 WT_CONF_API_DECLARE(WT_SESSION, drop, 1, 5);
 WT_CONF_API_DECLARE(WT_SESSION, log_flush, 1, 1);
-WT_CONF_API_DECLARE(WT_SESSION, open_cursor, 3, 29);
+WT_CONF_API_DECLARE(WT_SESSION, open_cursor, 3, 30);
 WT_CONF_API_DECLARE(WT_SESSION, prepare_transaction, 1, 1);
 WT_CONF_API_DECLARE(WT_SESSION, query_timestamp, 1, 1);
 WT_CONF_API_DECLARE(WT_SESSION, reconfigure, 3, 9);
@@ -164,17 +164,17 @@ WT_CONF_API_DECLARE(WT_SESSION, salvage, 1, 1);
 WT_CONF_API_DECLARE(WT_SESSION, timestamp_transaction, 1, 4);
 WT_CONF_API_DECLARE(WT_SESSION, verify, 1, 12);
 WT_CONF_API_DECLARE(colgroup, meta, 2, 12);
-WT_CONF_API_DECLARE(file, config, 5, 55);
-WT_CONF_API_DECLARE(file, meta, 6, 65);
+WT_CONF_API_DECLARE(file, config, 7, 63);
+WT_CONF_API_DECLARE(file, meta, 8, 73);
 WT_CONF_API_DECLARE(index, meta, 2, 15);
-WT_CONF_API_DECLARE(object, meta, 6, 67);
+WT_CONF_API_DECLARE(object, meta, 8, 75);
 WT_CONF_API_DECLARE(table, meta, 2, 13);
-WT_CONF_API_DECLARE(tier, meta, 6, 68);
-WT_CONF_API_DECLARE(tiered, meta, 6, 70);
-WT_CONF_API_DECLARE(GLOBAL, wiredtiger_open, 24, 175);
-WT_CONF_API_DECLARE(GLOBAL, wiredtiger_open_all, 24, 176);
-WT_CONF_API_DECLARE(GLOBAL, wiredtiger_open_basecfg, 24, 170);
-WT_CONF_API_DECLARE(GLOBAL, wiredtiger_open_usercfg, 24, 169);
+WT_CONF_API_DECLARE(tier, meta, 8, 76);
+WT_CONF_API_DECLARE(tiered, meta, 8, 78);
+WT_CONF_API_DECLARE(GLOBAL, wiredtiger_open, 26, 198);
+WT_CONF_API_DECLARE(GLOBAL, wiredtiger_open_all, 26, 199);
+WT_CONF_API_DECLARE(GLOBAL, wiredtiger_open_basecfg, 26, 193);
+WT_CONF_API_DECLARE(GLOBAL, wiredtiger_open_usercfg, 26, 192);
 
 #define WT_CONF_API_ELEMENTS 53
 
@@ -16,310 +16,337 @@
  * API configuration keys: BEGIN
  */
 #define WT_CONF_ID_Assert 1ULL
-#define WT_CONF_ID_Block_cache 157ULL
-#define WT_CONF_ID_Checkpoint 172ULL
-#define WT_CONF_ID_Checkpoint_cleanup 175ULL
-#define WT_CONF_ID_Chunk_cache 177ULL
-#define WT_CONF_ID_Compatibility 179ULL
-#define WT_CONF_ID_Debug 101ULL
-#define WT_CONF_ID_Debug_mode 181ULL
-#define WT_CONF_ID_Disaggregated 199ULL
-#define WT_CONF_ID_Encryption 19ULL
-#define WT_CONF_ID_Eviction 201ULL
-#define WT_CONF_ID_File_manager 215ULL
-#define WT_CONF_ID_Flush_tier 146ULL
-#define WT_CONF_ID_Hash 279ULL
-#define WT_CONF_ID_Heuristic_controls 220ULL
-#define WT_CONF_ID_History_store 224ULL
-#define WT_CONF_ID_Import 87ULL
-#define WT_CONF_ID_Incremental 106ULL
-#define WT_CONF_ID_Io_capacity 226ULL
-#define WT_CONF_ID_Live_restore 60ULL
-#define WT_CONF_ID_Log 36ULL
-#define WT_CONF_ID_Operation_tracking 236ULL
-#define WT_CONF_ID_Prefetch 258ULL
-#define WT_CONF_ID_Rollback_to_stable 238ULL
-#define WT_CONF_ID_Roundup_timestamps 139ULL
-#define WT_CONF_ID_Shared_cache 240ULL
-#define WT_CONF_ID_Statistics_log 244ULL
-#define WT_CONF_ID_Tiered_storage 47ULL
-#define WT_CONF_ID_Transaction_sync 298ULL
+#define WT_CONF_ID_Block_cache 166ULL
+#define WT_CONF_ID_Block_compressor_adaptive 16ULL
+#define WT_CONF_ID_Cache_huge_pages 285ULL
+#define WT_CONF_ID_Cache_quota 20ULL
+#define WT_CONF_ID_Checkpoint 182ULL
+#define WT_CONF_ID_Checkpoint_cleanup 185ULL
+#define WT_CONF_ID_Chunk_cache 188ULL
+#define WT_CONF_ID_Compatibility 190ULL
+#define WT_CONF_ID_Compression 297ULL
+#define WT_CONF_ID_Debug 109ULL
+#define WT_CONF_ID_Debug_mode 192ULL
+#define WT_CONF_ID_Disaggregated 210ULL
+#define WT_CONF_ID_Encryption 26ULL
+#define WT_CONF_ID_Eviction 212ULL
+#define WT_CONF_ID_File_manager 233ULL
+#define WT_CONF_ID_Flush_tier 155ULL
+#define WT_CONF_ID_Hash 305ULL
+#define WT_CONF_ID_Heuristic_controls 238ULL
+#define WT_CONF_ID_History_store 242ULL
+#define WT_CONF_ID_Import 95ULL
+#define WT_CONF_ID_Incremental 114ULL
+#define WT_CONF_ID_Io_capacity 247ULL
+#define WT_CONF_ID_Live_restore 68ULL
+#define WT_CONF_ID_Log 43ULL
+#define WT_CONF_ID_Operation_tracking 258ULL
+#define WT_CONF_ID_Prefetch 280ULL
+#define WT_CONF_ID_Rollback_to_stable 260ULL
+#define WT_CONF_ID_Roundup_timestamps 148ULL
+#define WT_CONF_ID_Shared_cache 262ULL
+#define WT_CONF_ID_Statistics_log 266ULL
+#define WT_CONF_ID_Tiered_storage 54ULL
+#define WT_CONF_ID_Transaction_sync 325ULL
 #define WT_CONF_ID_access_pattern_hint 12ULL
-#define WT_CONF_ID_action 76ULL
+#define WT_CONF_ID_action 84ULL
 #define WT_CONF_ID_allocation_size 13ULL
+#define WT_CONF_ID_app_handoff 218ULL
+#define WT_CONF_ID_app_handoff_wait_max_ms 219ULL
 #define WT_CONF_ID_app_metadata 0ULL
-#define WT_CONF_ID_append 73ULL
-#define WT_CONF_ID_archive 230ULL
-#define WT_CONF_ID_auth_token 48ULL
-#define WT_CONF_ID_available 291ULL
-#define WT_CONF_ID_background 80ULL
-#define WT_CONF_ID_background_compact 182ULL
-#define WT_CONF_ID_backup 150ULL
-#define WT_CONF_ID_backup_restore_target 260ULL
-#define WT_CONF_ID_bitmap 61ULL
-#define WT_CONF_ID_blkcache_eviction_aggression 160ULL
+#define WT_CONF_ID_append 81ULL
+#define WT_CONF_ID_archive 251ULL
+#define WT_CONF_ID_auth_token 55ULL
+#define WT_CONF_ID_available 318ULL
+#define WT_CONF_ID_background 88ULL
+#define WT_CONF_ID_background_compact 193ULL
+#define WT_CONF_ID_backup 159ULL
+#define WT_CONF_ID_backup_restore_target 282ULL
+#define WT_CONF_ID_bitmap 69ULL
+#define WT_CONF_ID_blkcache_eviction_aggression 170ULL
 #define WT_CONF_ID_block_allocation 14ULL
 #define WT_CONF_ID_block_compressor 15ULL
-#define WT_CONF_ID_bound 77ULL
-#define WT_CONF_ID_bucket 49ULL
-#define WT_CONF_ID_bucket_prefix 50ULL
-#define WT_CONF_ID_buckets 280ULL
-#define WT_CONF_ID_buffer_alignment 261ULL
-#define WT_CONF_ID_builtin_extension_config 262ULL
-#define WT_CONF_ID_bulk 99ULL
-#define WT_CONF_ID_cache 151ULL
-#define WT_CONF_ID_cache_cursors 254ULL
-#define WT_CONF_ID_cache_directory 51ULL
-#define WT_CONF_ID_cache_max_wait_ms 168ULL
-#define WT_CONF_ID_cache_on_checkpoint 158ULL
-#define WT_CONF_ID_cache_on_writes 159ULL
-#define WT_CONF_ID_cache_overhead 169ULL
-#define WT_CONF_ID_cache_resident 16ULL
-#define WT_CONF_ID_cache_size 170ULL
-#define WT_CONF_ID_cache_stuck_timeout_ms 171ULL
-#define WT_CONF_ID_capacity 264ULL
-#define WT_CONF_ID_checkpoint 56ULL
-#define WT_CONF_ID_checkpoint_backup_info 57ULL
-#define WT_CONF_ID_checkpoint_cleanup 143ULL
-#define WT_CONF_ID_checkpoint_cleanup_obsolete_tw_pages_dirty_max 221ULL
-#define WT_CONF_ID_checkpoint_crash_point 144ULL
-#define WT_CONF_ID_checkpoint_fail_before_turtle_update 255ULL
-#define WT_CONF_ID_checkpoint_lsn 58ULL
-#define WT_CONF_ID_checkpoint_read_timestamp 102ULL
-#define WT_CONF_ID_checkpoint_retention 184ULL
-#define WT_CONF_ID_checkpoint_sync 263ULL
-#define WT_CONF_ID_checkpoint_use_history 100ULL
-#define WT_CONF_ID_checkpoint_wait 93ULL
-#define WT_CONF_ID_checksum 17ULL
-#define WT_CONF_ID_chunk 241ULL
-#define WT_CONF_ID_chunk_cache 228ULL
-#define WT_CONF_ID_chunk_cache_evict_trigger 265ULL
-#define WT_CONF_ID_chunk_size 266ULL
-#define WT_CONF_ID_close_handle_minimum 216ULL
-#define WT_CONF_ID_close_idle_time 217ULL
-#define WT_CONF_ID_close_scan_interval 218ULL
-#define WT_CONF_ID_colgroups 69ULL
+#define WT_CONF_ID_block_compressor_config 19ULL
+#define WT_CONF_ID_bound 85ULL
+#define WT_CONF_ID_bucket 56ULL
+#define WT_CONF_ID_bucket_prefix 57ULL
+#define WT_CONF_ID_buckets 306ULL
+#define WT_CONF_ID_buffer_alignment 283ULL
+#define WT_CONF_ID_builtin_extension_config 284ULL
+#define WT_CONF_ID_bulk 107ULL
+#define WT_CONF_ID_cache 160ULL
+#define WT_CONF_ID_cache_cursors 276ULL
+#define WT_CONF_ID_cache_directory 58ULL
+#define WT_CONF_ID_cache_max_wait_ms 178ULL
+#define WT_CONF_ID_cache_numa 287ULL
+#define WT_CONF_ID_cache_on_checkpoint 167ULL
+#define WT_CONF_ID_cache_on_evict 168ULL
+#define WT_CONF_ID_cache_on_writes 169ULL
+#define WT_CONF_ID_cache_overhead 179ULL
+#define WT_CONF_ID_cache_resident 23ULL
+#define WT_CONF_ID_cache_size 180ULL
+#define WT_CONF_ID_cache_stuck_timeout_ms 181ULL
+#define WT_CONF_ID_capacity 289ULL
+#define WT_CONF_ID_checkpoint 64ULL
+#define WT_CONF_ID_checkpoint_backup_info 65ULL
+#define WT_CONF_ID_checkpoint_cleanup 152ULL
+#define WT_CONF_ID_checkpoint_cleanup_obsolete_tw_pages_dirty_max 239ULL
+#define WT_CONF_ID_checkpoint_crash_point 153ULL
+#define WT_CONF_ID_checkpoint_fail_before_turtle_update 277ULL
+#define WT_CONF_ID_checkpoint_lsn 66ULL
+#define WT_CONF_ID_checkpoint_read_timestamp 110ULL
+#define WT_CONF_ID_checkpoint_retention 195ULL
+#define WT_CONF_ID_checkpoint_sync 288ULL
+#define WT_CONF_ID_checkpoint_use_history 108ULL
+#define WT_CONF_ID_checkpoint_wait 101ULL
+#define WT_CONF_ID_checksum 24ULL
+#define WT_CONF_ID_chunk 263ULL
+#define WT_CONF_ID_chunk_cache 249ULL
+#define WT_CONF_ID_chunk_cache_evict_trigger 290ULL
+#define WT_CONF_ID_chunk_size 291ULL
+#define WT_CONF_ID_close_handle_minimum 234ULL
+#define WT_CONF_ID_close_idle_time 235ULL
+#define WT_CONF_ID_close_scan_interval 236ULL
+#define WT_CONF_ID_colgroups 77ULL
 #define WT_CONF_ID_collator 6ULL
 #define WT_CONF_ID_columns 7ULL
 #define WT_CONF_ID_commit_timestamp 2ULL
-#define WT_CONF_ID_compare_timestamp 88ULL
-#define WT_CONF_ID_compile_configuration_count 271ULL
-#define WT_CONF_ID_compressor 285ULL
-#define WT_CONF_ID_config 250ULL
-#define WT_CONF_ID_config_base 272ULL
-#define WT_CONF_ID_configuration 185ULL
-#define WT_CONF_ID_consolidate 107ULL
-#define WT_CONF_ID_corruption_abort 183ULL
-#define WT_CONF_ID_create 273ULL
-#define WT_CONF_ID_cursor_copy 186ULL
-#define WT_CONF_ID_cursor_reposition 187ULL
-#define WT_CONF_ID_cursors 152ULL
-#define WT_CONF_ID_default 292ULL
-#define WT_CONF_ID_dhandle_buckets 281ULL
-#define WT_CONF_ID_dictionary 18ULL
-#define WT_CONF_ID_direct_io 274ULL
-#define WT_CONF_ID_do_not_clear_txn_id 122ULL
-#define WT_CONF_ID_drop 145ULL
-#define WT_CONF_ID_dryrun 81ULL
-#define WT_CONF_ID_dump 105ULL
-#define WT_CONF_ID_dump_address 123ULL
-#define WT_CONF_ID_dump_all_data 124ULL
-#define WT_CONF_ID_dump_blocks 125ULL
-#define WT_CONF_ID_dump_key_data 126ULL
-#define WT_CONF_ID_dump_layout 127ULL
-#define WT_CONF_ID_dump_offsets 128ULL
-#define WT_CONF_ID_dump_pages 129ULL
-#define WT_CONF_ID_dump_tree_shape 130ULL
-#define WT_CONF_ID_dump_version 103ULL
+#define WT_CONF_ID_compare_timestamp 96ULL
+#define WT_CONF_ID_compile_configuration_count 296ULL
+#define WT_CONF_ID_compressor 311ULL
+#define WT_CONF_ID_compressor_config 312ULL
+#define WT_CONF_ID_compressors 17ULL
+#define WT_CONF_ID_config 272ULL
+#define WT_CONF_ID_config_base 298ULL
+#define WT_CONF_ID_configuration 196ULL
+#define WT_CONF_ID_consolidate 115ULL
+#define WT_CONF_ID_corruption_abort 194ULL
+#define WT_CONF_ID_create 299ULL
+#define WT_CONF_ID_cursor_copy 197ULL
+#define WT_CONF_ID_cursor_reposition 198ULL
+#define WT_CONF_ID_cursors 161ULL
+#define WT_CONF_ID_default 319ULL
+#define WT_CONF_ID_delta_chain_max 243ULL
+#define WT_CONF_ID_dhandle_buckets 307ULL
+#define WT_CONF_ID_dictionary 25ULL
+#define WT_CONF_ID_direct_io 300ULL
+#define WT_CONF_ID_dirty_page_index 220ULL
+#define WT_CONF_ID_do_not_clear_txn_id 131ULL
+#define WT_CONF_ID_drop 154ULL
+#define WT_CONF_ID_drop_truncate 244ULL
+#define WT_CONF_ID_dryrun 89ULL
+#define WT_CONF_ID_dump 113ULL
+#define WT_CONF_ID_dump_address 132ULL
+#define WT_CONF_ID_dump_all_data 133ULL
+#define WT_CONF_ID_dump_blocks 134ULL
+#define WT_CONF_ID_dump_key_data 135ULL
+#define WT_CONF_ID_dump_layout 136ULL
+#define WT_CONF_ID_dump_offsets 137ULL
+#define WT_CONF_ID_dump_pages 138ULL
+#define WT_CONF_ID_dump_tree_shape 139ULL
+#define WT_CONF_ID_dump_version 111ULL
 #define WT_CONF_ID_durable_timestamp 3ULL
-#define WT_CONF_ID_early_load 251ULL
-#define WT_CONF_ID_enabled 37ULL
-#define WT_CONF_ID_entry 252ULL
-#define WT_CONF_ID_error_prefix 200ULL
-#define WT_CONF_ID_evict_sample_inmem 204ULL
-#define WT_CONF_ID_evict_use_softptr 205ULL
-#define WT_CONF_ID_eviction 188ULL
-#define WT_CONF_ID_eviction_checkpoint_target 207ULL
-#define WT_CONF_ID_eviction_checkpoint_ts_ordering 198ULL
-#define WT_CONF_ID_eviction_dirty_target 208ULL
-#define WT_CONF_ID_eviction_dirty_trigger 209ULL
-#define WT_CONF_ID_eviction_obsolete_tw_pages_dirty_max 222ULL
-#define WT_CONF_ID_eviction_target 210ULL
-#define WT_CONF_ID_eviction_trigger 211ULL
-#define WT_CONF_ID_eviction_updates_target 212ULL
-#define WT_CONF_ID_eviction_updates_trigger 213ULL
-#define WT_CONF_ID_exclude 82ULL
-#define WT_CONF_ID_exclusive 86ULL
-#define WT_CONF_ID_exclusive_refreshed 79ULL
-#define WT_CONF_ID_extensions 277ULL
-#define WT_CONF_ID_extra_diagnostics 214ULL
-#define WT_CONF_ID_file 108ULL
-#define WT_CONF_ID_file_extend 278ULL
-#define WT_CONF_ID_file_max 225ULL
-#define WT_CONF_ID_file_metadata 89ULL
-#define WT_CONF_ID_final_flush 148ULL
-#define WT_CONF_ID_flush_time 67ULL
-#define WT_CONF_ID_flush_timestamp 68ULL
-#define WT_CONF_ID_flushed_data_cache_insertion 268ULL
-#define WT_CONF_ID_force 94ULL
-#define WT_CONF_ID_force_stop 109ULL
-#define WT_CONF_ID_force_write_wait 286ULL
-#define WT_CONF_ID_format 22ULL
-#define WT_CONF_ID_free_space_target 83ULL
-#define WT_CONF_ID_full_target 161ULL
-#define WT_CONF_ID_generation_drain_timeout_ms 219ULL
-#define WT_CONF_ID_get 121ULL
-#define WT_CONF_ID_granularity 110ULL
-#define WT_CONF_ID_handles 153ULL
-#define WT_CONF_ID_hashsize 163ULL
-#define WT_CONF_ID_hazard_max 282ULL
-#define WT_CONF_ID_huffman_key 23ULL
-#define WT_CONF_ID_huffman_value 24ULL
-#define WT_CONF_ID_id 59ULL
-#define WT_CONF_ID_ignore_cache_size 257ULL
-#define WT_CONF_ID_ignore_in_memory_cache_size 25ULL
-#define WT_CONF_ID_ignore_prepare 134ULL
-#define WT_CONF_ID_immutable 66ULL
-#define WT_CONF_ID_in_memory 283ULL
-#define WT_CONF_ID_inclusive 78ULL
-#define WT_CONF_ID_internal_item_max 26ULL
-#define WT_CONF_ID_internal_key_max 27ULL
-#define WT_CONF_ID_internal_key_truncate 28ULL
-#define WT_CONF_ID_internal_page_max 29ULL
-#define WT_CONF_ID_interval 297ULL
-#define WT_CONF_ID_isolation 135ULL
-#define WT_CONF_ID_json 245ULL
-#define WT_CONF_ID_json_output 229ULL
-#define WT_CONF_ID_key_format 30ULL
-#define WT_CONF_ID_key_gap 31ULL
-#define WT_CONF_ID_keyid 21ULL
-#define WT_CONF_ID_last 70ULL
-#define WT_CONF_ID_leaf_item_max 32ULL
-#define WT_CONF_ID_leaf_key_max 33ULL
-#define WT_CONF_ID_leaf_page_max 34ULL
-#define WT_CONF_ID_leaf_value_max 35ULL
-#define WT_CONF_ID_leak_memory 149ULL
-#define WT_CONF_ID_legacy_page_visit_strategy 206ULL
-#define WT_CONF_ID_local_retention 52ULL
-#define WT_CONF_ID_lock_wait 95ULL
-#define WT_CONF_ID_log 154ULL
-#define WT_CONF_ID_log_retention 189ULL
-#define WT_CONF_ID_log_size 173ULL
-#define WT_CONF_ID_max_percent_overhead 164ULL
-#define WT_CONF_ID_memory_page_image_max 38ULL
-#define WT_CONF_ID_memory_page_max 39ULL
-#define WT_CONF_ID_metadata_file 90ULL
-#define WT_CONF_ID_method 176ULL
-#define WT_CONF_ID_mmap 288ULL
-#define WT_CONF_ID_mmap_all 289ULL
-#define WT_CONF_ID_multiprocess 290ULL
-#define WT_CONF_ID_name 20ULL
-#define WT_CONF_ID_nbits 62ULL
-#define WT_CONF_ID_next_random 113ULL
-#define WT_CONF_ID_next_random_sample_size 114ULL
-#define WT_CONF_ID_next_random_seed 115ULL
-#define WT_CONF_ID_no_timestamp 136ULL
-#define WT_CONF_ID_nvram_path 165ULL
-#define WT_CONF_ID_object_target_size 53ULL
-#define WT_CONF_ID_obsolete_tw_btree_max 223ULL
-#define WT_CONF_ID_oldest 71ULL
-#define WT_CONF_ID_oldest_timestamp 259ULL
-#define WT_CONF_ID_on_close 246ULL
-#define WT_CONF_ID_operation_timeout_ms 137ULL
-#define WT_CONF_ID_os_cache_dirty_max 40ULL
-#define WT_CONF_ID_os_cache_dirty_pct 231ULL
-#define WT_CONF_ID_os_cache_max 41ULL
-#define WT_CONF_ID_overwrite 74ULL
-#define WT_CONF_ID_page_log 275ULL
-#define WT_CONF_ID_panic_corrupt 91ULL
-#define WT_CONF_ID_path 237ULL
-#define WT_CONF_ID_percent_file_in_dram 166ULL
-#define WT_CONF_ID_pinned 178ULL
-#define WT_CONF_ID_prealloc 232ULL
-#define WT_CONF_ID_prealloc_init_count 233ULL
-#define WT_CONF_ID_prefix_compression 42ULL
-#define WT_CONF_ID_prefix_compression_min 43ULL
-#define WT_CONF_ID_prefix_search 75ULL
-#define WT_CONF_ID_prepare_timestamp 142ULL
-#define WT_CONF_ID_prepared 140ULL
-#define WT_CONF_ID_priority 138ULL
-#define WT_CONF_ID_quota 242ULL
-#define WT_CONF_ID_raw 116ULL
-#define WT_CONF_ID_read 141ULL
-#define WT_CONF_ID_read_corrupt 131ULL
-#define WT_CONF_ID_read_once 117ULL
-#define WT_CONF_ID_read_size 284ULL
+#define WT_CONF_ID_early_load 273ULL
+#define WT_CONF_ID_enabled 44ULL
+#define WT_CONF_ID_entry 274ULL
+#define WT_CONF_ID_error_prefix 211ULL
+#define WT_CONF_ID_evict_sample_inmem 215ULL
+#define WT_CONF_ID_evict_use_softptr 216ULL
+#define WT_CONF_ID_eviction 199ULL
+#define WT_CONF_ID_eviction_checkpoint_target 225ULL
+#define WT_CONF_ID_eviction_checkpoint_ts_ordering 209ULL
+#define WT_CONF_ID_eviction_dirty_target 226ULL
+#define WT_CONF_ID_eviction_dirty_trigger 227ULL
+#define WT_CONF_ID_eviction_obsolete_tw_pages_dirty_max 240ULL
+#define WT_CONF_ID_eviction_target 228ULL
+#define WT_CONF_ID_eviction_trigger 229ULL
+#define WT_CONF_ID_eviction_updates_target 230ULL
+#define WT_CONF_ID_eviction_updates_trigger 231ULL
+#define WT_CONF_ID_exclude 90ULL
+#define WT_CONF_ID_exclusive 94ULL
+#define WT_CONF_ID_exclusive_refreshed 87ULL
+#define WT_CONF_ID_extensions 303ULL
+#define WT_CONF_ID_extra_diagnostics 232ULL
+#define WT_CONF_ID_file 116ULL
+#define WT_CONF_ID_file_extend 304ULL
+#define WT_CONF_ID_file_max 245ULL
+#define WT_CONF_ID_file_metadata 97ULL
+#define WT_CONF_ID_final_flush 157ULL
+#define WT_CONF_ID_flush_time 75ULL
+#define WT_CONF_ID_flush_timestamp 76ULL
+#define WT_CONF_ID_flushed_data_cache_insertion 293ULL
+#define WT_CONF_ID_force 102ULL
+#define WT_CONF_ID_force_stop 117ULL
+#define WT_CONF_ID_force_write_wait 313ULL
+#define WT_CONF_ID_format 29ULL
+#define WT_CONF_ID_free_space_target 91ULL
+#define WT_CONF_ID_full_target 171ULL
+#define WT_CONF_ID_generation_drain_timeout_ms 237ULL
+#define WT_CONF_ID_get 130ULL
+#define WT_CONF_ID_granularity 118ULL
+#define WT_CONF_ID_group_commit_wait_max 252ULL
+#define WT_CONF_ID_handles 162ULL
+#define WT_CONF_ID_hashsize 173ULL
+#define WT_CONF_ID_hazard_max 308ULL
+#define WT_CONF_ID_history_store_threads 186ULL
+#define WT_CONF_ID_huffman_key 30ULL
+#define WT_CONF_ID_huffman_value 31ULL
+#define WT_CONF_ID_id 67ULL
+#define WT_CONF_ID_ignore_cache_size 279ULL
+#define WT_CONF_ID_ignore_in_memory_cache_size 32ULL
+#define WT_CONF_ID_ignore_prepare 143ULL
+#define WT_CONF_ID_immutable 74ULL
+#define WT_CONF_ID_in_memory 309ULL
+#define WT_CONF_ID_inclusive 86ULL
+#define WT_CONF_ID_internal_item_max 33ULL
+#define WT_CONF_ID_internal_key_max 34ULL
+#define WT_CONF_ID_internal_key_truncate 35ULL
+#define WT_CONF_ID_internal_page_max 36ULL
+#define WT_CONF_ID_interval 324ULL
+#define WT_CONF_ID_isolation 144ULL
+#define WT_CONF_ID_json 267ULL
+#define WT_CONF_ID_json_output 250ULL
+#define WT_CONF_ID_key_filter_size 246ULL
+#define WT_CONF_ID_key_format 37ULL
+#define WT_CONF_ID_key_gap 38ULL
+#define WT_CONF_ID_keyid 28ULL
+#define WT_CONF_ID_last 78ULL
+#define WT_CONF_ID_leaf_item_max 39ULL
+#define WT_CONF_ID_leaf_key_max 40ULL
+#define WT_CONF_ID_leaf_page_max 41ULL
+#define WT_CONF_ID_leaf_value_max 42ULL
+#define WT_CONF_ID_leak_memory 158ULL
+#define WT_CONF_ID_legacy_page_visit_strategy 217ULL
+#define WT_CONF_ID_local_retention 59ULL
+#define WT_CONF_ID_lock_wait 103ULL
+#define WT_CONF_ID_log 163ULL
+#define WT_CONF_ID_log_retention 200ULL
+#define WT_CONF_ID_log_size 183ULL
+#define WT_CONF_ID_log_tail_wait 121ULL
+#define WT_CONF_ID_max 21ULL
+#define WT_CONF_ID_max_percent_overhead 174ULL
+#define WT_CONF_ID_memory_page_image_max 45ULL
+#define WT_CONF_ID_memory_page_max 46ULL
+#define WT_CONF_ID_metadata_file 98ULL
+#define WT_CONF_ID_method 187ULL
+#define WT_CONF_ID_min 22ULL
+#define WT_CONF_ID_mmap 315ULL
+#define WT_CONF_ID_mmap_all 316ULL
+#define WT_CONF_ID_multiprocess 317ULL
+#define WT_CONF_ID_name 27ULL
+#define WT_CONF_ID_nbits 70ULL
+#define WT_CONF_ID_next_random 122ULL
+#define WT_CONF_ID_next_random_sample_size 123ULL
+#define WT_CONF_ID_next_random_seed 124ULL
+#define WT_CONF_ID_no_timestamp 145ULL
+#define WT_CONF_ID_nvram_path 175ULL
+#define WT_CONF_ID_object_target_size 60ULL
+#define WT_CONF_ID_obsolete_tw_btree_max 241ULL
+#define WT_CONF_ID_oldest 79ULL
+#define WT_CONF_ID_oldest_timestamp 281ULL
+#define WT_CONF_ID_on_close 268ULL
+#define WT_CONF_ID_operation_timeout_ms 146ULL
+#define WT_CONF_ID_os_cache_dirty_max 47ULL
+#define WT_CONF_ID_os_cache_dirty_pct 253ULL
+#define WT_CONF_ID_os_cache_max 48ULL
+#define WT_CONF_ID_overwrite 82ULL
+#define WT_CONF_ID_page_log 301ULL
+#define WT_CONF_ID_page_size 286ULL
+#define WT_CONF_ID_panic_corrupt 99ULL
+#define WT_CONF_ID_path 259ULL
+#define WT_CONF_ID_percent_file_in_dram 176ULL
+#define WT_CONF_ID_pinned 189ULL
+#define WT_CONF_ID_policy 18ULL
+#define WT_CONF_ID_prealloc 254ULL
+#define WT_CONF_ID_prealloc_init_count 255ULL
+#define WT_CONF_ID_prefix_compression 49ULL
+#define WT_CONF_ID_prefix_compression_min 50ULL
+#define WT_CONF_ID_prefix_search 83ULL
+#define WT_CONF_ID_prepare_timestamp 151ULL
+#define WT_CONF_ID_prepared 149ULL
+#define WT_CONF_ID_priority 147ULL
+#define WT_CONF_ID_quota 264ULL
+#define WT_CONF_ID_raw 125ULL
+#define WT_CONF_ID_read 150ULL
+#define WT_CONF_ID_read_corrupt 140ULL
+#define WT_CONF_ID_read_once 126ULL
+#define WT_CONF_ID_read_size 310ULL
 #define WT_CONF_ID_read_timestamp 4ULL
-#define WT_CONF_ID_readonly 63ULL
-#define WT_CONF_ID_realloc_exact 190ULL
-#define WT_CONF_ID_realloc_malloc 191ULL
-#define WT_CONF_ID_recover 287ULL
-#define WT_CONF_ID_release 180ULL
-#define WT_CONF_ID_release_evict 104ULL
-#define WT_CONF_ID_release_evict_page 256ULL
-#define WT_CONF_ID_remove 234ULL
-#define WT_CONF_ID_remove_files 96ULL
-#define WT_CONF_ID_remove_shared 97ULL
-#define WT_CONF_ID_repair 92ULL
-#define WT_CONF_ID_require_max 269ULL
-#define WT_CONF_ID_require_min 270ULL
-#define WT_CONF_ID_reserve 243ULL
-#define WT_CONF_ID_rollback_error 192ULL
-#define WT_CONF_ID_run_once 84ULL
-#define WT_CONF_ID_salvage 293ULL
-#define WT_CONF_ID_secretkey 276ULL
-#define WT_CONF_ID_session_max 294ULL
-#define WT_CONF_ID_session_scratch_max 295ULL
-#define WT_CONF_ID_session_table_cache 296ULL
-#define WT_CONF_ID_sessions 155ULL
-#define WT_CONF_ID_shared 54ULL
-#define WT_CONF_ID_size 162ULL
-#define WT_CONF_ID_skip_sort_check 118ULL
-#define WT_CONF_ID_slow_checkpoint 193ULL
+#define WT_CONF_ID_readonly 71ULL
+#define WT_CONF_ID_realloc_exact 201ULL
+#define WT_CONF_ID_realloc_malloc 202ULL
+#define WT_CONF_ID_recover 314ULL
+#define WT_CONF_ID_release 191ULL
+#define WT_CONF_ID_release_evict 112ULL
+#define WT_CONF_ID_release_evict_page 278ULL
+#define WT_CONF_ID_remove 256ULL
+#define WT_CONF_ID_remove_files 104ULL
+#define WT_CONF_ID_remove_shared 105ULL
+#define WT_CONF_ID_repair 100ULL
+#define WT_CONF_ID_require_max 294ULL
+#define WT_CONF_ID_require_min 295ULL
+#define WT_CONF_ID_reserve 265ULL
+#define WT_CONF_ID_rollback_error 203ULL
+#define WT_CONF_ID_run_once 92ULL
+#define WT_CONF_ID_salvage 320ULL
+#define WT_CONF_ID_secretkey 302ULL
+#define WT_CONF_ID_session_max 321ULL
+#define WT_CONF_ID_session_scratch_max 322ULL
+#define WT_CONF_ID_session_table_cache 323ULL
+#define WT_CONF_ID_sessions 164ULL
+#define WT_CONF_ID_shared 61ULL
+#define WT_CONF_ID_size 172ULL
+#define WT_CONF_ID_skip_sort_check 127ULL
+#define WT_CONF_ID_slow_checkpoint 204ULL
 #define WT_CONF_ID_source 8ULL
-#define WT_CONF_ID_sources 247ULL
-#define WT_CONF_ID_split_deepen_min_child 44ULL
-#define WT_CONF_ID_split_deepen_per_child 45ULL
-#define WT_CONF_ID_split_pct 46ULL
-#define WT_CONF_ID_src_id 111ULL
-#define WT_CONF_ID_stable_timestamp 132ULL
-#define WT_CONF_ID_statistics 119ULL
-#define WT_CONF_ID_storage_path 267ULL
-#define WT_CONF_ID_stress_skiplist 194ULL
-#define WT_CONF_ID_strict 133ULL
-#define WT_CONF_ID_sync 98ULL
-#define WT_CONF_ID_system_ram 167ULL
-#define WT_CONF_ID_table_logging 195ULL
-#define WT_CONF_ID_target 120ULL
-#define WT_CONF_ID_terminate 253ULL
-#define WT_CONF_ID_this_id 112ULL
-#define WT_CONF_ID_threads 239ULL
-#define WT_CONF_ID_threads_max 202ULL
-#define WT_CONF_ID_threads_min 203ULL
-#define WT_CONF_ID_tiered_flush_error_continue 196ULL
-#define WT_CONF_ID_tiered_object 64ULL
-#define WT_CONF_ID_tiers 72ULL
-#define WT_CONF_ID_timeout 85ULL
-#define WT_CONF_ID_timestamp 248ULL
-#define WT_CONF_ID_timing_stress_for_test 249ULL
-#define WT_CONF_ID_total 227ULL
-#define WT_CONF_ID_txn 156ULL
+#define WT_CONF_ID_sources 269ULL
+#define WT_CONF_ID_split_deepen_min_child 51ULL
+#define WT_CONF_ID_split_deepen_per_child 52ULL
+#define WT_CONF_ID_split_pct 53ULL
+#define WT_CONF_ID_src_id 119ULL
+#define WT_CONF_ID_stable_timestamp 141ULL
+#define WT_CONF_ID_statistics 128ULL
+#define WT_CONF_ID_storage_path 292ULL
+#define WT_CONF_ID_stress_skiplist 205ULL
+#define WT_CONF_ID_strict 142ULL
+#define WT_CONF_ID_sync 106ULL
+#define WT_CONF_ID_system_ram 177ULL
+#define WT_CONF_ID_table_logging 206ULL
+#define WT_CONF_ID_target 129ULL
+#define WT_CONF_ID_terminate 275ULL
+#define WT_CONF_ID_this_id 120ULL
+#define WT_CONF_ID_threads 261ULL
+#define WT_CONF_ID_threads_max 213ULL
+#define WT_CONF_ID_threads_min 214ULL
+#define WT_CONF_ID_tiered_flush_error_continue 207ULL
+#define WT_CONF_ID_tiered_object 72ULL
+#define WT_CONF_ID_tiers 80ULL
+#define WT_CONF_ID_timeout 93ULL
+#define WT_CONF_ID_timestamp 270ULL
+#define WT_CONF_ID_timing_stress_for_test 271ULL
+#define WT_CONF_ID_total 248ULL
+#define WT_CONF_ID_trace 223ULL
+#define WT_CONF_ID_trace_path 224ULL
+#define WT_CONF_ID_ttl 62ULL
+#define WT_CONF_ID_tuning 221ULL
+#define WT_CONF_ID_tuning_horizon_ms 222ULL
+#define WT_CONF_ID_txn 165ULL
 #define WT_CONF_ID_type 9ULL
-#define WT_CONF_ID_update_restore_evict 197ULL
-#define WT_CONF_ID_use_environment 299ULL
-#define WT_CONF_ID_use_environment_priv 300ULL
-#define WT_CONF_ID_use_timestamp 147ULL
-#define WT_CONF_ID_value_format 55ULL
+#define WT_CONF_ID_update_restore_evict 208ULL
+#define WT_CONF_ID_use_environment 326ULL
+#define WT_CONF_ID_use_environment_priv 327ULL
+#define WT_CONF_ID_use_timestamp 156ULL
+#define WT_CONF_ID_value_format 63ULL
 #define WT_CONF_ID_verbose 10ULL
-#define WT_CONF_ID_verify_metadata 301ULL
-#define WT_CONF_ID_version 65ULL
-#define WT_CONF_ID_wait 174ULL
-#define WT_CONF_ID_write_through 302ULL
+#define WT_CONF_ID_verify_metadata 328ULL
+#define WT_CONF_ID_version 73ULL
+#define WT_CONF_ID_wait 184ULL
+#define WT_CONF_ID_write_through 329ULL
 #define WT_CONF_ID_write_timestamp 5ULL
 #define WT_CONF_ID_write_timestamp_usage 11ULL
-#define WT_CONF_ID_zero_fill 235ULL
+#define WT_CONF_ID_zero_fill 257ULL
 
-#define WT_CONF_ID_COUNT 303
+#define WT_CONF_ID_COUNT 330
 /*
  * API configuration keys: END
  */
@@ -341,6 +368,7 @@ static const struct {
     struct {
         uint64_t blkcache_eviction_aggression;
         uint64_t cache_on_checkpoint;
+        uint64_t cache_on_evict;
         uint64_t cache_on_writes;
         uint64_t enabled;
         uint64_t full_target;
@@ -352,11 +380,25 @@ static const struct {
         uint64_t system_ram;
         uint64_t type;
     } Block_cache;
+    struct {
+        uint64_t compressors;
+        uint64_t policy;
+    } Block_compressor_adaptive;
+    struct {
+        uint64_t enabled;
+        uint64_t page_size;
+        uint64_t size;
+    } Cache_huge_pages;
+    struct {
+        uint64_t max;
+        uint64_t min;
+    } Cache_quota;
     struct {
         uint64_t log_size;
         uint64_t wait;
     } Checkpoint;
     struct {
+        uint64_t history_store_threads;
         uint64_t method;
         uint64_t wait;
     } Checkpoint_cleanup;
@@ -376,6 +418,9 @@ static const struct {
         uint64_t require_max;
         uint64_t require_min;
     } Compatibility;
+    struct {
+        uint64_t threads;
+    } Compression;
     struct {
         uint64_t checkpoint_fail_before_turtle_update;
         uint64_t release_evict_page;
@@ -408,11 +453,19 @@ static const struct {
         uint64_t secretkey;
     } Encryption;
     struct {
+        uint64_t app_handoff;
+        uint64_t app_handoff_wait_max_ms;
+        uint64_t dirty_page_index;
         uint64_t evict_sample_inmem;
         uint64_t evict_use_softptr;
         uint64_t legacy_page_visit_strategy;
+        uint64_t policy;
         uint64_t threads_max;
         uint64_t threads_min;
+        uint64_t trace;
+        uint64_t trace_path;
+        uint64_t tuning;
+        uint64_t tuning_horizon_ms;
     } Eviction;
     struct {
         uint64_t close_handle_minimum;
@@ -435,7 +488,10 @@ static const struct {
         uint64_t obsolete_tw_btree_max;
     } Heuristic_controls;
     struct {
+        uint64_t delta_chain_max;
+        uint64_t drop_truncate;
         uint64_t file_max;
+        uint64_t key_filter_size;
     } History_store;
     struct {
         uint64_t compare_timestamp;
@@ -467,9 +523,11 @@ static const struct {
     struct {
         uint64_t archive;
         uint64_t compressor;
+        uint64_t compressor_config;
         uint64_t enabled;
         uint64_t file_max;
         uint64_t force_write_wait;
+        uint64_t group_commit_wait_max;
         uint64_t os_cache_dirty_pct;
         uint64_t path;
         uint64_t prealloc;
@@ -496,6 +554,7 @@ static const struct {
     struct {
         uint64_t chunk;
         uint64_t name;
+        uint64_t priority;
         uint64_t quota;
         uint64_t reserve;
         uint64_t size;
@@ -532,6 +591,7 @@ static const struct {
     uint64_t backup_restore_target;
     uint64_t block_allocation;
     uint64_t block_compressor;
+    uint64_t block_compressor_config;
     uint64_t bound;
     uint64_t bucket;
     uint64_t bucket_prefix;
@@ -542,6 +602,7 @@ static const struct {
     uint64_t cache_cursors;
     uint64_t cache_directory;
     uint64_t cache_max_wait_ms;
+    uint64_t cache_numa;
     uint64_t cache_overhead;
     uint64_t cache_resident;
     uint64_t cache_size;
@@ -628,6 +689,7 @@ static const struct {
     uint64_t leak_memory;
     uint64_t lock_wait;
     uint64_t log;
+    uint64_t log_tail_wait;
     uint64_t memory_page_image_max;
     uint64_t memory_page_max;
     uint64_t mmap;
@@ -678,6 +740,7 @@ static const struct {
     uint64_t tiers;
     uint64_t timeout;
     uint64_t timing_stress_for_test;
+    uint64_t ttl;
     uint64_t txn;
     uint64_t type;
     uint64_t use_environment;
@@ -699,6 +762,7 @@ static const struct {
   {
     WT_CONF_ID_Block_cache | (WT_CONF_ID_blkcache_eviction_aggression << 16),
     WT_CONF_ID_Block_cache | (WT_CONF_ID_cache_on_checkpoint << 16),
+    WT_CONF_ID_Block_cache | (WT_CONF_ID_cache_on_evict << 16),
     WT_CONF_ID_Block_cache | (WT_CONF_ID_cache_on_writes << 16),
     WT_CONF_ID_Block_cache | (WT_CONF_ID_enabled << 16),
     WT_CONF_ID_Block_cache | (WT_CONF_ID_full_target << 16),
@@ -710,11 +774,25 @@ static const struct {
     WT_CONF_ID_Block_cache | (WT_CONF_ID_system_ram << 16),
     WT_CONF_ID_Block_cache | (WT_CONF_ID_type << 16),
   },
+  {
+    WT_CONF_ID_Block_compressor_adaptive | (WT_CONF_ID_compressors << 16),
+    WT_CONF_ID_Block_compressor_adaptive | (WT_CONF_ID_policy << 16),
+  },
+  {
+    WT_CONF_ID_Cache_huge_pages | (WT_CONF_ID_enabled << 16),
+    WT_CONF_ID_Cache_huge_pages | (WT_CONF_ID_page_size << 16),
+    WT_CONF_ID_Cache_huge_pages | (WT_CONF_ID_size << 16),
+  },
+  {
+    WT_CONF_ID_Cache_quota | (WT_CONF_ID_max << 16),
+    WT_CONF_ID_Cache_quota | (WT_CONF_ID_min << 16),
+  },
   {
     WT_CONF_ID_Checkpoint | (WT_CONF_ID_log_size << 16),
     WT_CONF_ID_Checkpoint | (WT_CONF_ID_wait << 16),
   },
   {
+    WT_CONF_ID_Checkpoint_cleanup | (WT_CONF_ID_history_store_threads << 16),
     WT_CONF_ID_Checkpoint_cleanup | (WT_CONF_ID_method << 16),
     WT_CONF_ID_Checkpoint_cleanup | (WT_CONF_ID_wait << 16),
   },
@@ -734,6 +812,9 @@ static const struct {
     WT_CONF_ID_Compatibility | (WT_CONF_ID_require_max << 16),
     WT_CONF_ID_Compatibility | (WT_CONF_ID_require_min << 16),
   },
+  {
+    WT_CONF_ID_Compression | (WT_CONF_ID_threads << 16),
+  },
   {
     WT_CONF_ID_Debug | (WT_CONF_ID_checkpoint_fail_before_turtle_update << 16),
     WT_CONF_ID_Debug | (WT_CONF_ID_release_evict_page << 16),
@@ -766,11 +847,19 @@ static const struct {
     WT_CONF_ID_Encryption | (WT_CONF_ID_secretkey << 16),
   },
   {
+    WT_CONF_ID_Eviction | (WT_CONF_ID_app_handoff << 16),
+    WT_CONF_ID_Eviction | (WT_CONF_ID_app_handoff_wait_max_ms << 16),
+    WT_CONF_ID_Eviction | (WT_CONF_ID_dirty_page_index << 16),
     WT_CONF_ID_Eviction | (WT_CONF_ID_evict_sample_inmem << 16),
     WT_CONF_ID_Eviction | (WT_CONF_ID_evict_use_softptr << 16),
     WT_CONF_ID_Eviction | (WT_CONF_ID_legacy_page_visit_strategy << 16),
+    WT_CONF_ID_Eviction | (WT_CONF_ID_policy << 16),
     WT_CONF_ID_Eviction | (WT_CONF_ID_threads_max << 16),
     WT_CONF_ID_Eviction | (WT_CONF_ID_threads_min << 16),
+    WT_CONF_ID_Eviction | (WT_CONF_ID_trace << 16),
+    WT_CONF_ID_Eviction | (WT_CONF_ID_trace_path << 16),
+    WT_CONF_ID_Eviction | (WT_CONF_ID_tuning << 16),
+    WT_CONF_ID_Eviction | (WT_CONF_ID_tuning_horizon_ms << 16),
   },
   {
     WT_CONF_ID_File_manager | (WT_CONF_ID_close_handle_minimum << 16),
@@ -794,7 +883,10 @@ static const struct {
     WT_CONF_ID_Heuristic_controls | (WT_CONF_ID_obsolete_tw_btree_max << 16),
   },
   {
+    WT_CONF_ID_History_store | (WT_CONF_ID_delta_chain_max << 16),
+    WT_CONF_ID_History_store | (WT_CONF_ID_drop_truncate << 16),
     WT_CONF_ID_History_store | (WT_CONF_ID_file_max << 16),
+    WT_CONF_ID_History_store | (WT_CONF_ID_key_filter_size << 16),
   },
   {
     WT_CONF_ID_Import | (WT_CONF_ID_compare_timestamp << 16),
@@ -826,9 +918,11 @@ static const struct {
   {
     WT_CONF_ID_Log | (WT_CONF_ID_archive << 16),
     WT_CONF_ID_Log | (WT_CONF_ID_compressor << 16),
+    WT_CONF_ID_Log | (WT_CONF_ID_compressor_config << 16),
     WT_CONF_ID_Log | (WT_CONF_ID_enabled << 16),
     WT_CONF_ID_Log | (WT_CONF_ID_file_max << 16),
     WT_CONF_ID_Log | (WT_CONF_ID_force_write_wait << 16),
+    WT_CONF_ID_Log | (WT_CONF_ID_group_commit_wait_max << 16),
     WT_CONF_ID_Log | (WT_CONF_ID_os_cache_dirty_pct << 16),
     WT_CONF_ID_Log | (WT_CONF_ID_path << 16),
     WT_CONF_ID_Log | (WT_CONF_ID_prealloc << 16),
@@ -855,6 +949,7 @@ static const struct {
   {
     WT_CONF_ID_Shared_cache | (WT_CONF_ID_chunk << 16),
     WT_CONF_ID_Shared_cache | (WT_CONF_ID_name << 16),
+    WT_CONF_ID_Shared_cache | (WT_CONF_ID_priority << 16),
     WT_CONF_ID_Shared_cache | (WT_CONF_ID_quota << 16),
     WT_CONF_ID_Shared_cache | (WT_CONF_ID_reserve << 16),
     WT_CONF_ID_Shared_cache | (WT_CONF_ID_size << 16),
@@ -891,6 +986,7 @@ static const struct {
   WT_CONF_ID_backup_restore_target,
   WT_CONF_ID_block_allocation,
   WT_CONF_ID_block_compressor,
+  WT_CONF_ID_block_compressor_config,
   WT_CONF_ID_bound,
   WT_CONF_ID_bucket,
   WT_CONF_ID_bucket_prefix,
@@ -901,6 +997,7 @@ static const struct {
   WT_CONF_ID_cache_cursors,
   WT_CONF_ID_cache_directory,
   WT_CONF_ID_cache_max_wait_ms,
+  WT_CONF_ID_cache_numa,
   WT_CONF_ID_cache_overhead,
   WT_CONF_ID_cache_resident,
   WT_CONF_ID_cache_size,
@@ -987,6 +1084,7 @@ static const struct {
   WT_CONF_ID_leak_memory,
   WT_CONF_ID_lock_wait,
   WT_CONF_ID_log,
+  WT_CONF_ID_log_tail_wait,
   WT_CONF_ID_memory_page_image_max,
   WT_CONF_ID_memory_page_max,
   WT_CONF_ID_mmap,
@@ -1037,6 +1135,7 @@ static const struct {
   WT_CONF_ID_tiers,
   WT_CONF_ID_timeout,
   WT_CONF_ID_timing_stress_for_test,
+  WT_CONF_ID_ttl,
   WT_CONF_ID_txn,
   WT_CONF_ID_type,
   WT_CONF_ID_use_environment,
@@ -160,6 +160,8 @@ struct __wt_config_parser_impl {
 #define WT_CONFIG_ENTRY_wiredtiger_open_usercfg 52
 
 extern const char __WT_CONFIG_CHOICE_NULL[]; /* not set in configuration */
+extern const char __WT_CONFIG_CHOICE_1GB[];
+extern const char __WT_CONFIG_CHOICE_2MB[];
 extern const char __WT_CONFIG_CHOICE_DRAM[];
 extern const char __WT_CONFIG_CHOICE_FILE[];
 extern const char __WT_CONFIG_CHOICE_aggressive_stash_free[];
@@ -168,6 +170,7 @@ extern const char __WT_CONFIG_CHOICE_all[];
 extern const char __WT_CONFIG_CHOICE_all_durable[];
 extern const char __WT_CONFIG_CHOICE_always[];
 extern const char __WT_CONFIG_CHOICE_api[];
+extern const char __WT_CONFIG_CHOICE_background[];
 extern const char __WT_CONFIG_CHOICE_backup[];
 extern const char __WT_CONFIG_CHOICE_backup_checkpoint[];
 extern const char __WT_CONFIG_CHOICE_backup_rename[];
@@ -209,6 +212,7 @@ extern const char __WT_CONFIG_CHOICE_fileops[];
 extern const char __WT_CONFIG_CHOICE_first[];
 extern const char __WT_CONFIG_CHOICE_first_commit[];
 extern const char __WT_CONFIG_CHOICE_force[];
+extern const char __WT_CONFIG_CHOICE_frequency[];
 extern const char __WT_CONFIG_CHOICE_fsync[];
 extern const char __WT_CONFIG_CHOICE_generation[];
 extern const char __WT_CONFIG_CHOICE_generation_check[];
@@ -220,6 +224,7 @@ extern const char __WT_CONFIG_CHOICE_history_store_checkpoint_delay[];
 extern const char __WT_CONFIG_CHOICE_history_store_search[];
 extern const char __WT_CONFIG_CHOICE_history_store_sweep_race[];
 extern const char __WT_CONFIG_CHOICE_hs_validate[];
+extern const char __WT_CONFIG_CHOICE_immediate[];
 extern const char __WT_CONFIG_CHOICE_json[];
 extern const char __WT_CONFIG_CHOICE_key_consistent[];
 extern const char __WT_CONFIG_CHOICE_key_out_of_order[];
@@ -230,6 +235,7 @@ extern const char __WT_CONFIG_CHOICE_live_restore_progress[];
 extern const char __WT_CONFIG_CHOICE_log[];
 extern const char __WT_CONFIG_CHOICE_log_validate[];
 extern const char __WT_CONFIG_CHOICE_lower[];
+extern const char __WT_CONFIG_CHOICE_lru[];
 extern const char __WT_CONFIG_CHOICE_message[];
 extern const char __WT_CONFIG_CHOICE_metadata[];
 extern const char __WT_CONFIG_CHOICE_mixed_mode[];
@@ -246,6 +252,7 @@ extern const char __WT_CONFIG_CHOICE_ordered[];
 extern const char __WT_CONFIG_CHOICE_out_of_order[];
 extern const char __WT_CONFIG_CHOICE_overflow[];
 extern const char __WT_CONFIG_CHOICE_pinned[];
+extern const char __WT_CONFIG_CHOICE_predictive[];
 extern const char __WT_CONFIG_CHOICE_prefetch[];
 extern const char __WT_CONFIG_CHOICE_prefetch_1[];
 extern const char __WT_CONFIG_CHOICE_prefetch_2[];
@@ -260,6 +267,8 @@ extern const char __WT_CONFIG_CHOICE_pretty[];
 extern const char __WT_CONFIG_CHOICE_pretty_hex[];
 extern const char __WT_CONFIG_CHOICE_print[];
 extern const char __WT_CONFIG_CHOICE_random[];
+extern const char __WT_CONFIG_CHOICE_ratio[];
+extern const char __WT_CONFIG_CHOICE_reactive[];
 extern const char __WT_CONFIG_CHOICE_read[];
 extern const char __WT_CONFIG_CHOICE_read_committed[];
 extern const char __WT_CONFIG_CHOICE_read_uncommitted[];
@@ -288,6 +297,7 @@ extern const char __WT_CONFIG_CHOICE_split_7[];
 extern const char __WT_CONFIG_CHOICE_split_8[];
 extern const char __WT_CONFIG_CHOICE_stable[];
 extern const char __WT_CONFIG_CHOICE_stable_timestamp[];
+extern const char __WT_CONFIG_CHOICE_temperature[];
 extern const char __WT_CONFIG_CHOICE_temporary[];
 extern const char __WT_CONFIG_CHOICE_thread_group[];
 extern const char __WT_CONFIG_CHOICE_tiered[];
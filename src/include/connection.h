@@ -36,6 +36,10 @@ struct __wt_process {
 
     WT_CACHE_POOL *cache_pool; /* shared cache information */
 
+    WT_HUGE_ARENA *huge_arena;          /* huge page arena, locked by the process spinlock */
+    wt_shared uint8_t *huge_arena_base; /* huge page arena's mapped range */
+    wt_shared uint8_t *huge_arena_end;
+
     /*
      * WT_CURSOR.modify operations set unspecified bytes to space in 'S' format and to a nul byte in
      * all other formats. It makes it easier to debug format test program stress failures if strings
@@ -199,6 +203,18 @@ struct __wt_named_collator {
     TAILQ_ENTRY(__wt_named_collator) q; /* Linked list of collators */
 };
 
+/*
+ * WT_CUSTOM_COMPRESSOR --
+ *	A list entry for a compressor with a unique (name, configuration).
+ */
+struct __wt_custom_compressor {
+    const char *config;        /* Configuration of compressor */
+    int owned;                 /* Compressor needs to be terminated */
+    WT_COMPRESSOR *compressor; /* User supplied callbacks */
+    /* Linked list of compressors */
+    TAILQ_ENTRY(__wt_custom_compressor) q;
+};
+
 /*
  * WT_NAMED_COMPRESSOR --
  *	A compressor list entry
@@ -206,6 +222,8 @@ struct __wt_named_collator {
 struct __wt_named_compressor {
     const char *name;          /* Name of compressor */
     WT_COMPRESSOR *compressor; /* User supplied callbacks */
+    /* Locked: list of compressors by configuration */
+    TAILQ_HEAD(__wt_custom_qh, __wt_custom_compressor) customqh;
     /* Linked list of compressors */
     TAILQ_ENTRY(__wt_named_compressor) q;
 };
@@ -501,6 +519,7 @@ struct __wt_connection_impl {
     size_t session_scratch_max; /* Max scratch memory per session */
 
     WT_CACHE *cache;                        /* Page cache */
+    WT_HUGE_ARENA *huge_arena;              /* Huge page arena the cache allocates from */
     wt_shared volatile uint64_t cache_size; /* Cache size (either statically
                                      configured or the current size
                                      within a cache pool). */
@@ -572,6 +591,7 @@ struct __wt_connection_impl {
     uint32_t evict_threads_max; /* Max eviction threads */
     uint32_t evict_threads_min; /* Min eviction threads */
     bool evict_sample_inmem;
+    wt_shared bool evict_dirty_page_index;
     wt_shared bool evict_use_npos;
     bool evict_legacy_page_visit_strategy;
 
@@ -586,6 +606,14 @@ struct __wt_connection_impl {
     bool prefetch_auto_on;
     bool prefetch_available;
 
+#define WT_REC_COMPRESS_THREADS_MAX 16
+    WT_SPINLOCK rec_compress_lock;
+    WT_THREAD_GROUP rec_compress_threads;
+    uint32_t rec_compress_threads_count; /* Configured compression threads */
+    wt_shared bool rec_compress_run;     /* Compression workers accepting work */
+    /* Queue of reconciliation chunks to compress, locked: rec_compress_lock */
+    TAILQ_HEAD(__wt_rec_compress_qh, __wti_rec_chunk) rec_compress_qh;
+
 #define WT_STATLOG_FILENAME "WiredTigerStat.%d.%H"
     WT_SESSION_IMPL *stat_session; /* Statistics log session */
     wt_thread_t stat_tid;          /* Statistics log thread */
@@ -639,6 +667,7 @@ struct __wt_connection_impl {
     TAILQ_HEAD(__wt_coll_qh, __wt_named_collator) collqh;
 
     /* Locked: compressor list */
+    WT_SPINLOCK compressor_lock; /* Custom compressor list lock */
     TAILQ_HEAD(__wt_comp_qh, __wt_named_compressor) compqh;
 
     /* Locked: data source list */
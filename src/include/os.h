@@ -179,3 +179,62 @@ struct __wt_fstream {
     int (*fstr_getline)(WT_SESSION_IMPL *, WT_FSTREAM *, WT_ITEM *);
     int (*fstr_printf)(WT_SESSION_IMPL *, WT_FSTREAM *, const char *, va_list);
 };
+
+/*
+ * WT_NUMA --
+ *	The machine's NUMA nodes, see __wt_numa_init.
+ */
+#define WT_NUMA_NODE_MAX 64
+struct __wt_numa {
+    u_int nodes;                   /* Nodes with CPUs */
+    int node_id[WT_NUMA_NODE_MAX]; /* System ID of each node */
+    uint8_t *cpu_node;             /* Node of each CPU */
+    u_int cpus;                    /* CPU table size */
+};
+
+/*
+ * WT_HUGE_ARENA --
+ *	Memory mapped from huge pages, see __wt_huge_arena_acquire. The arena is divided into slabs,
+ * each slab serves a single size class: sizes between the minimum and maximum, four classes for
+ * each power of two.
+ */
+#define WT_HUGE_ARENA_MIN_SHIFT 10 /* 1KB */
+#define WT_HUGE_ARENA_MAX_SHIFT 20 /* 1MB */
+#define WT_HUGE_ARENA_MIN ((size_t)1 << WT_HUGE_ARENA_MIN_SHIFT)
+#define WT_HUGE_ARENA_MAX ((size_t)1 << WT_HUGE_ARENA_MAX_SHIFT)
+#define WT_HUGE_ARENA_CLASSES (4 * (WT_HUGE_ARENA_MAX_SHIFT - WT_HUGE_ARENA_MIN_SHIFT) + 1)
+#define WT_HUGE_ARENA_SLAB (2 * WT_MEGABYTE)
+
+struct __wt_huge_class {
+    WT_SPINLOCK lock;
+    size_t size;   /* Allocation size */
+    void *free;    /* Freed allocations, linked through their first word */
+    uint8_t *next; /* Unallocated space in the class's current slab */
+    uint8_t *end;
+};
+
+struct __wt_huge_arena {
+    uint8_t *base; /* Arena memory */
+    size_t len;
+    void *map;        /* Mapped memory, if the arena was aligned within it */
+    size_t page_size; /* Huge page size */
+    bool hugetlb;     /* Explicit huge pages, otherwise transparent huge pages */
+
+    uint32_t slabs;                 /* Slab count */
+    wt_shared uint32_t slab_next;   /* Next unassigned slab */
+    uint8_t *slab_class;            /* Size class of each slab */
+    wt_shared uint64_t bytes_inuse; /* Bytes allocated */
+
+    WT_HUGE_CLASS classes[WT_HUGE_ARENA_CLASSES];
+
+    uint32_t refs; /* Connections using the arena */
+};
+
+/*
+ * WT_HUGE_ARENA_OWNS --
+ *	If memory was allocated from the huge page arena. The mapped range is kept in the process
+ * structure so freeing memory that wasn't allocated from an arena doesn't read the arena.
+ */
+#define WT_HUGE_ARENA_OWNS(p)                          \
+    ((uint8_t *)(p) >= __wt_process.huge_arena_base && \
+      (uint8_t *)(p) < __wt_process.huge_arena_end)
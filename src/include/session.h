@@ -245,7 +245,8 @@ struct __wt_session_impl {
     u_int op_handle_next;       /* Next empty slot */
     size_t op_handle_allocated; /* Bytes allocated */
 
-    void *reconcile; /* Reconciliation support */
+    void *reconcile;       /* Reconciliation support */
+    void *reconcile_arena; /* Reconciliation memory cached between reconciliations */
     int (*reconcile_cleanup)(WT_SESSION_IMPL *);
 
     /* Salvage support. */
@@ -347,6 +348,15 @@ struct __wt_session_impl {
     /* Hashed handle reference list array */
     TAILQ_HEAD(__dhandles_hash, __wt_data_handle_cache) * dhhash;
 
+    /*
+     * Background commits are counted as they are written and notified once the log server has made
+     * them durable. The counts persist past session close, so the log server never finds a closed
+     * session with notifications outstanding.
+     */
+    WT_LSN bg_commit_lsn;                 /* LSN of the last background commit */
+    wt_shared uint64_t bg_commit_count;   /* Background commits written */
+    wt_shared uint64_t bg_commit_durable; /* Background commits notified durable */
+
 /* Generations manager */
 #define WT_GEN_CHECKPOINT 0   /* Checkpoint generation */
 #define WT_GEN_EVICT 1        /* Eviction generation */
@@ -398,6 +408,13 @@ struct __wt_session_impl {
     uint64_t optrack_offset;
     WT_FH *optrack_fh;
 
+    /*
+     * Eviction decision trace.
+     */
+    WT_EVICT_TRACE_RECORD *evict_trace_buf;
+    u_int evict_trace_next;
+    uint64_t evict_trace_gen;
+
     WT_SESSION_STATS stats;
 };
 
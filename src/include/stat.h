@@ -457,9 +457,11 @@ struct __wt_connection_stats {
     int64_t block_cache_blocks_removed;
     int64_t block_cache_blocks_removed_blocked;
     int64_t block_cache_blocks;
+    int64_t block_cache_blocks_insert_evict;
     int64_t block_cache_blocks_insert_read;
     int64_t block_cache_blocks_insert_write;
     int64_t block_cache_bytes;
+    int64_t block_cache_bytes_insert_evict;
     int64_t block_cache_bytes_insert_read;
     int64_t block_cache_bytes_insert_write;
     int64_t disagg_block_hs_byte_read;
@@ -493,6 +495,9 @@ struct __wt_connection_stats {
     int64_t block_remap_file_write;
     int64_t eviction_interupted_by_app;
     int64_t eviction_app_time;
+    int64_t eviction_app_handoff_wait;
+    int64_t eviction_app_handoff_timed_out;
+    int64_t eviction_app_handoff_admitted;
     int64_t cache_eviction_app_threads_fill_ratio_lt_25;
     int64_t cache_eviction_app_threads_fill_ratio_25_50;
     int64_t cache_eviction_app_threads_fill_ratio_50_75;
@@ -520,6 +525,8 @@ struct __wt_connection_stats {
     int64_t eviction_get_ref_empty2;
     int64_t eviction_aggressive_set;
     int64_t eviction_empty_score;
+    int64_t eviction_frequency_age;
+    int64_t eviction_frequency_ranked;
     int64_t cache_eviction_blocked_no_ts_checkpoint_race_1;
     int64_t cache_eviction_blocked_no_ts_checkpoint_race_2;
     int64_t cache_eviction_blocked_no_ts_checkpoint_race_3;
@@ -527,6 +534,10 @@ struct __wt_connection_stats {
     int64_t cache_eviction_blocked_remove_hs_race_with_checkpoint;
     int64_t cache_eviction_blocked_no_progress;
     int64_t eviction_walk_passes;
+    int64_t eviction_predict_early_start;
+    int64_t eviction_predict_horizon_extended;
+    int64_t eviction_predict_horizon;
+    int64_t eviction_predict_checkpoint;
     int64_t eviction_queue_empty;
     int64_t eviction_queue_not_empty;
     int64_t eviction_server_skip_dirty_pages_during_checkpoint;
@@ -537,14 +548,17 @@ struct __wt_connection_stats {
     int64_t eviction_server_skip_unwanted_pages;
     int64_t eviction_server_skip_unwanted_tree;
     int64_t eviction_server_skip_trees_too_many_active_walks;
+    int64_t eviction_server_skip_trees_below_cache_quota;
     int64_t eviction_server_skip_checkpointing_trees;
     int64_t eviction_server_skip_trees_stick_in_cache;
     int64_t eviction_server_skip_trees_eviction_disabled;
     int64_t eviction_server_skip_trees_not_useful_before;
+    int64_t eviction_server_skip_trees_cache_quota_over;
     int64_t eviction_server_slept;
     int64_t eviction_slow;
     int64_t eviction_walk_leaf_notfound;
     int64_t eviction_state;
+    int64_t eviction_trace_records;
     int64_t eviction_walk_sleeps;
     int64_t npos_evict_walk_max;
     int64_t eviction_restored_pos;
@@ -569,6 +583,7 @@ struct __wt_connection_stats {
     int64_t eviction_walk_saved_pos;
     int64_t eviction_active_workers;
     int64_t eviction_stable_state_workers;
+    int64_t eviction_predict_worker_start;
     int64_t eviction_walks_active;
     int64_t eviction_walks_started;
     int64_t eviction_force_no_retry;
@@ -585,6 +600,7 @@ struct __wt_connection_stats {
     int64_t cache_hazard_checks;
     int64_t cache_hazard_walks;
     int64_t cache_hazard_max;
+    int64_t cache_hs_filter_build;
     int64_t cache_hs_insert;
     int64_t cache_hs_insert_restart;
     int64_t cache_hs_ondisk_max;
@@ -593,9 +609,11 @@ struct __wt_connection_stats {
     int64_t cache_hs_read_miss;
     int64_t cache_hs_read_squash;
     int64_t cache_hs_order_lose_durable_timestamp;
+    int64_t cache_hs_filter_skip;
     int64_t cache_hs_key_truncate_rts_unstable;
     int64_t cache_hs_key_truncate_rts;
     int64_t cache_hs_btree_truncate;
+    int64_t cache_hs_btree_truncate_dropped;
     int64_t cache_hs_key_truncate;
     int64_t cache_hs_order_remove;
     int64_t cache_hs_key_truncate_onpage_removal;
@@ -604,6 +622,9 @@ struct __wt_connection_stats {
     int64_t cache_hs_key_truncate_rts_dryrun;
     int64_t cache_hs_order_reinsert;
     int64_t cache_hs_write_squash;
+    int64_t cache_huge_arena_alloc;
+    int64_t cache_huge_arena_fallback;
+    int64_t cache_huge_arena_bytes;
     int64_t cache_inmem_splittable;
     int64_t cache_inmem_split;
     int64_t cache_eviction_blocked_internal_page_split;
@@ -633,11 +654,13 @@ struct __wt_connection_stats {
     int64_t eviction_app_fail;
     int64_t cache_eviction_deepen;
     int64_t cache_write_hs;
+    int64_t eviction_numa_worker_local;
     int64_t eviction_consider_prefetch;
     int64_t cache_pages_inuse;
     int64_t cache_eviction_dirty_obsolete_tw;
     int64_t eviction_pages_in_parallel_with_checkpoint;
     int64_t eviction_pages_ordinary_queued;
+    int64_t eviction_dirty_index_pages_queued;
     int64_t eviction_pages_queued_post_lru;
     int64_t eviction_pages_queued_urgent;
     int64_t eviction_pages_queued_oldest;
@@ -651,10 +674,12 @@ struct __wt_connection_stats {
     int64_t cache_pages_prefetch;
     int64_t cache_eviction_pages_seen;
     int64_t eviction_pages_already_queued;
+    int64_t eviction_dirty_index_pages_seen;
     int64_t eviction_fail;
     int64_t eviction_fail_active_children_on_an_internal_page;
     int64_t eviction_fail_in_reconciliation;
     int64_t eviction_fail_checkpoint_no_ts;
+    int64_t eviction_numa_walk_skip;
     int64_t eviction_walk;
     int64_t cache_write;
     int64_t cache_write_restore;
@@ -692,6 +717,7 @@ struct __wt_connection_stats {
     int64_t capacity_time_log;
     int64_t capacity_time_read;
     int64_t capacity_time_chunkcache;
+    int64_t checkpoint_cleanup_hs_parallel;
     int64_t checkpoint_cleanup_success;
     int64_t checkpoint_snapshot_acquired;
     int64_t checkpoint_skipped;
@@ -917,6 +943,7 @@ struct __wt_connection_stats {
     int64_t log_force_remove_sleep;
     int64_t log_bytes_payload;
     int64_t log_bytes_written;
+    int64_t log_cursor_tail_wait;
     int64_t log_zero_fills;
     int64_t log_flush;
     int64_t log_force_write;
@@ -930,6 +957,7 @@ struct __wt_connection_stats {
     int64_t log_write_lsn;
     int64_t log_write_lsn_skip;
     int64_t log_sync;
+    int64_t log_sync_covered;
     int64_t log_sync_duration;
     int64_t log_sync_dir;
     int64_t log_sync_dir_duration;
@@ -944,6 +972,8 @@ struct __wt_connection_stats {
     int64_t log_slot_close_race;
     int64_t log_slot_close_unbuf;
     int64_t log_slot_closes;
+    int64_t log_slot_group_commit_wait_duration;
+    int64_t log_slot_group_commit_wait;
     int64_t log_slot_races;
     int64_t log_slot_yield_race;
     int64_t log_slot_immediate;
@@ -1037,6 +1067,11 @@ struct __wt_connection_stats {
     int64_t rec_vlcs_emptied_pages;
     int64_t rec_time_window_bytes_ts;
     int64_t rec_time_window_bytes_txn;
+    int64_t rec_arena_alloc;
+    int64_t rec_arena_chunk;
+    int64_t rec_compress_parallel;
+    int64_t rec_compress_parallel_discarded;
+    int64_t rec_compress_parallel_sync;
     int64_t rec_page_delete_fast;
     int64_t rec_overflow_key_leaf;
     int64_t rec_maximum_milliseconds;
@@ -1063,6 +1098,7 @@ struct __wt_connection_stats {
     int64_t rec_time_window_pages_durable_stop_ts;
     int64_t rec_time_window_pages_stop_ts;
     int64_t rec_time_window_pages_stop_txn;
+    int64_t rec_ttl_expired;
     int64_t rec_time_window_prepared;
     int64_t rec_time_window_durable_start_ts;
     int64_t rec_time_window_start_ts;
@@ -1269,15 +1305,18 @@ struct __wt_dsrc_stats {
     int64_t cache_eviction_target_page_lt128;
     int64_t cache_eviction_target_page_reduced;
     int64_t cache_eviction_blocked_hazard;
+    int64_t cache_hs_filter_build;
     int64_t cache_hs_insert;
     int64_t cache_hs_insert_restart;
     int64_t cache_hs_read;
     int64_t cache_hs_read_miss;
     int64_t cache_hs_read_squash;
     int64_t cache_hs_order_lose_durable_timestamp;
+    int64_t cache_hs_filter_skip;
     int64_t cache_hs_key_truncate_rts_unstable;
     int64_t cache_hs_key_truncate_rts;
     int64_t cache_hs_btree_truncate;
+    int64_t cache_hs_btree_truncate_dropped;
     int64_t cache_hs_key_truncate;
     int64_t cache_hs_order_remove;
     int64_t cache_hs_key_truncate_onpage_removal;
@@ -1363,6 +1402,7 @@ struct __wt_dsrc_stats {
     int64_t compress_read_ratio_hist_16;
     int64_t compress_read_ratio_hist_32;
     int64_t compress_read_ratio_hist_64;
+    int64_t compress_adaptive_sample;
     int64_t compress_write;
     int64_t compress_write_ratio_hist_max;
     int64_t compress_write_ratio_hist_2;
@@ -1371,6 +1411,8 @@ struct __wt_dsrc_stats {
     int64_t compress_write_ratio_hist_16;
     int64_t compress_write_ratio_hist_32;
     int64_t compress_write_ratio_hist_64;
+    int64_t compress_adaptive_none;
+    int64_t compress_adaptive_alternate;
     int64_t cursor_tree_walk_del_page_skip;
     int64_t cursor_next_skip_total;
     int64_t cursor_prev_skip_total;
@@ -1469,6 +1511,7 @@ struct __wt_dsrc_stats {
     int64_t rec_time_window_pages_durable_stop_ts;
     int64_t rec_time_window_pages_stop_ts;
     int64_t rec_time_window_pages_stop_txn;
+    int64_t rec_ttl_expired;
     int64_t rec_time_window_prepared;
     int64_t rec_time_window_durable_start_ts;
     int64_t rec_time_window_start_ts;
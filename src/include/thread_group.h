@@ -31,6 +31,8 @@ struct __wt_thread {
                                   /* AUTOMATIC FLAG VALUE GENERATION STOP 32 */
     uint32_t flags;
 
+    bool numa_bound; /* Thread has been bound to a NUMA node */
+
     /*
      * Condition signalled when a thread becomes active. Paused threads wait on this condition.
      */
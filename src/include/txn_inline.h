@@ -1063,6 +1063,64 @@ __wt_txn_tw_stop_visible_all(WT_SESSION_IMPL *session, WT_TIME_WINDOW *tw)
       __wt_txn_visible_all(session, tw->stop_txn, tw->durable_stop_ts));
 }
 
+/*
+ * __txn_tw_expire_ts --
+ *     Return the timestamp at which a time window's start time point expires based on the tree's
+ *     time-to-live, or WT_TS_NONE if it never expires.
+ */
+static WT_INLINE wt_timestamp_t
+__txn_tw_expire_ts(WT_SESSION_IMPL *session, WT_TIME_WINDOW *tw)
+{
+    wt_timestamp_t ttl;
+
+    ttl = S2BT(session)->ttl;
+
+    /*
+     * Values committed without a timestamp, or that are still prepared, never expire. Use the
+     * durable timestamp, it's the one tracked for values reconstructed from modifies or read from
+     * the history store.
+     */
+    if (ttl == 0 || tw->durable_start_ts == WT_TS_NONE || tw->prepare ||
+      tw->durable_start_ts > WT_TS_MAX - ttl)
+        return (WT_TS_NONE);
+    return (tw->durable_start_ts + ttl);
+}
+
+/*
+ * __wt_txn_tw_expired --
+ *     Has the given time window's value expired for the current reader? Values expire once the
+ *     reader's read timestamp reaches the expiration time, or once the expiration time is globally
+ *     visible, as reconciliation may discard the value from that point.
+ */
+static WT_INLINE bool
+__wt_txn_tw_expired(WT_SESSION_IMPL *session, WT_TIME_WINDOW *tw)
+{
+    wt_timestamp_t expire_ts;
+
+    if ((expire_ts = __txn_tw_expire_ts(session, tw)) == WT_TS_NONE)
+        return (false);
+
+    if (F_ISSET(session->txn, WT_TXN_SHARED_TS_READ) &&
+      __wt_txn_timestamp_visible(session, expire_ts, expire_ts))
+        return (true);
+    return (__wt_txn_visible_all(session, WT_TXN_NONE, expire_ts));
+}
+
+/*
+ * __wt_txn_tw_expired_all --
+ *     Has the given time window's value expired for all (possible) readers?
+ */
+static WT_INLINE bool
+__wt_txn_tw_expired_all(WT_SESSION_IMPL *session, WT_TIME_WINDOW *tw)
+{
+    wt_timestamp_t expire_ts;
+
+    if (WT_TIME_WINDOW_HAS_STOP(tw) || (expire_ts = __txn_tw_expire_ts(session, tw)) == WT_TS_NONE)
+        return (false);
+    return (__wt_txn_tw_start_visible_all(session, tw) &&
+      __wt_txn_visible_all(session, WT_TXN_NONE, expire_ts));
+}
+
 /*
  * __wt_txn_visible_id_snapshot --
  *     Is the id visible in terms of the given snapshot?
@@ -1449,6 +1507,25 @@ __wt_txn_read_upd_list_internal(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt,
     return (0);
 }
 
+/*
+ * __txn_read_expire --
+ *     Return a value whose time-to-live has expired for the reader as deleted.
+ */
+static WT_INLINE void
+__txn_read_expire(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt)
+{
+    if (S2BT(session)->ttl == 0 || F_ISSET(&cbt->iface, WT_CURSTD_IGNORE_TOMBSTONE))
+        return;
+    if (cbt->upd_value->type != WT_UPDATE_STANDARD && cbt->upd_value->type != WT_UPDATE_MODIFY)
+        return;
+    if (!__wt_txn_tw_expired(session, &cbt->upd_value->tw))
+        return;
+
+    cbt->upd_value->buf.data = NULL;
+    cbt->upd_value->buf.size = 0;
+    cbt->upd_value->type = WT_UPDATE_TOMBSTONE;
+}
+
 /*
  * __wt_txn_read_upd_list --
  *     Get the first visible update in a list (or NULL if none are visible).
@@ -1456,7 +1533,9 @@ __wt_txn_read_upd_list_internal(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt,
 static WT_INLINE int
 __wt_txn_read_upd_list(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, WT_UPDATE *upd)
 {
-    return (__wt_txn_read_upd_list_internal(session, cbt, upd, NULL, NULL));
+    WT_RET(__wt_txn_read_upd_list_internal(session, cbt, upd, NULL, NULL));
+    __txn_read_expire(session, cbt);
+    return (0);
 }
 
 /*
@@ -1481,8 +1560,10 @@ __wt_txn_read(
 retry:
     WT_RET(__wt_txn_read_upd_list_internal(session, cbt, upd, &prepare_upd, &restored_upd));
     if (WT_UPDATE_DATA_VALUE(cbt->upd_value) ||
-      (cbt->upd_value->type == WT_UPDATE_MODIFY && cbt->upd_value->skip_buf))
+      (cbt->upd_value->type == WT_UPDATE_MODIFY && cbt->upd_value->skip_buf)) {
+        __txn_read_expire(session, cbt);
         return (0);
+    }
     WT_ASSERT(session, cbt->upd_value->type == WT_UPDATE_INVALID);
 
     /* If there is no ondisk value, there can't be anything in the history store either. */
@@ -1555,6 +1636,7 @@ retry:
                 cbt->upd_value->type = WT_UPDATE_STANDARD;
 
                 WT_TIME_WINDOW_COPY_START(&cbt->upd_value->tw, &tw);
+                __txn_read_expire(session, cbt);
                 return (0);
             }
         }
@@ -1606,6 +1688,7 @@ retry:
 
     /* Return invalid not tombstone if nothing is found in history store. */
     WT_ASSERT(session, cbt->upd_value->type != WT_UPDATE_TOMBSTONE);
+    __txn_read_expire(session, cbt);
     return (0);
 }
 
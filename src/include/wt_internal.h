@@ -211,6 +211,8 @@ struct __wt_cursor_table;
 typedef struct __wt_cursor_table WT_CURSOR_TABLE;
 struct __wt_cursor_version;
 typedef struct __wt_cursor_version WT_CURSOR_VERSION;
+struct __wt_custom_compressor;
+typedef struct __wt_custom_compressor WT_CUSTOM_COMPRESSOR;
 struct __wt_data_handle;
 typedef struct __wt_data_handle WT_DATA_HANDLE;
 struct __wt_data_handle_cache;
@@ -227,6 +229,10 @@ struct __wt_evict;
 typedef struct __wt_evict WT_EVICT;
 struct __wt_evict_timeline;
 typedef struct __wt_evict_timeline WT_EVICT_TIMELINE;
+struct __wt_evict_trace_header;
+typedef struct __wt_evict_trace_header WT_EVICT_TRACE_HEADER;
+struct __wt_evict_trace_record;
+typedef struct __wt_evict_trace_record WT_EVICT_TRACE_RECORD;
 struct __wt_ext;
 typedef struct __wt_ext WT_EXT;
 struct __wt_extlist;
@@ -253,6 +259,10 @@ struct __wt_hazard_cookie;
 typedef struct __wt_hazard_cookie WT_HAZARD_COOKIE;
 struct __wt_heuristic_controls;
 typedef struct __wt_heuristic_controls WT_HEURISTIC_CONTROLS;
+struct __wt_huge_arena;
+typedef struct __wt_huge_arena WT_HUGE_ARENA;
+struct __wt_huge_class;
+typedef struct __wt_huge_class WT_HUGE_CLASS;
 struct __wt_ikey;
 typedef struct __wt_ikey WT_IKEY;
 struct __wt_import_entry;
@@ -293,6 +303,8 @@ struct __wt_named_page_log;
 typedef struct __wt_named_page_log WT_NAMED_PAGE_LOG;
 struct __wt_named_storage_source;
 typedef struct __wt_named_storage_source WT_NAMED_STORAGE_SOURCE;
+struct __wt_numa;
+typedef struct __wt_numa WT_NUMA;
 struct __wt_optrack_header;
 typedef struct __wt_optrack_header WT_OPTRACK_HEADER;
 struct __wt_optrack_record;
@@ -447,6 +459,10 @@ struct __wti_logslot;
 typedef struct __wti_logslot WTI_LOGSLOT;
 struct __wti_myslot;
 typedef struct __wti_myslot WTI_MYSLOT;
+struct __wti_rec_arena;
+typedef struct __wti_rec_arena WTI_REC_ARENA;
+struct __wti_rec_arena_chunk;
+typedef struct __wti_rec_arena_chunk WTI_REC_ARENA_CHUNK;
 struct __wti_rec_chunk;
 typedef struct __wti_rec_chunk WTI_REC_CHUNK;
 struct __wti_rec_dictionary;
@@ -519,6 +535,7 @@ typedef uint64_t wt_timestamp_t;
 #include "timestamp.h"    /* required by reconcile.h */
 #include "thread_group.h" /* required by rollback_to_stable.h */
 #include "verbose.h"      /* required by rollback_to_stable.h */
+#include "os.h"           /* required by cache.h */
 
 #include "api.h"
 #include "bitstring.h"
@@ -548,7 +565,6 @@ typedef uint64_t wt_timestamp_t;
 #include "../log/log.h"
 #include "meta.h" /* required by block.h */
 #include "optrack.h"
-#include "os.h"
 #include "../reconcile/reconcile.h"
 #include "rollback_to_stable.h"
 #include "schema.h"
@@ -286,6 +286,9 @@ __log_fsync_file(WT_SESSION_IMPL *session, WT_LSN *min_lsn, const char *method,
         WT_ASSIGN_LSN(&log->sync_lsn, min_lsn);
         WT_STAT_CONN_INCR(session, log_sync);
         WT_STAT_CONN_INCRV(session, log_sync_duration, fsync_duration_usecs);
+        /* Group commit sizes its wait from the recent sync latency. */
+        __wt_atomic_store64(&log->sync_duration,
+          (__wt_atomic_load64(&log->sync_duration) * 7 + fsync_duration_usecs) / 8);
         __wt_cond_signal(session, log->log_sync_cond);
     }
 err:
@@ -1894,7 +1897,7 @@ __wti_log_release(WT_SESSION_IMPL *session, WTI_LOGSLOT *slot, bool *freep)
     WT_CONNECTION_IMPL *conn;
     WT_DECL_RET;
     WTI_LOG *log;
-    WT_LSN sync_lsn;
+    WT_LSN sync_lsn, write_lsn;
     int64_t release_buffered, release_bytes;
 
     conn = S2C(session);
@@ -1978,6 +1981,19 @@ __wti_log_release(WT_SESSION_IMPL *session, WTI_LOGSLOT *slot, bool *freep)
      * writing to the log will wait while the current fsync completes and advance log->sync_lsn.
      */
     while (F_ISSET_ATOMIC_16(slot, WTI_SLOT_SYNC | WTI_SLOT_SYNC_DIR)) {
+        /*
+         * A sync by another thread covers everything written before it started, so a concurrent
+         * sync may have already made our slot durable. Don't queue behind the lock in that case.
+         */
+        if ((!F_ISSET_ATOMIC_16(slot, WTI_SLOT_SYNC) ||
+              __wt_log_cmp(&log->sync_lsn, &slot->slot_end_lsn) >= 0) &&
+          (!F_ISSET_ATOMIC_16(slot, WTI_SLOT_SYNC_DIR) ||
+            log->sync_dir_lsn.l.file >= slot->slot_end_lsn.l.file)) {
+            WT_STAT_CONN_INCR(session, log_sync_covered);
+            F_CLR_ATOMIC_16(slot, WTI_SLOT_SYNC | WTI_SLOT_SYNC_DIR);
+            break;
+        }
+
         /*
          * We have to wait until earlier log files have finished their sync operations. The most
          * recent one will set the LSN to the beginning of our file.
@@ -1990,9 +2006,13 @@ __wti_log_release(WT_SESSION_IMPL *session, WTI_LOGSLOT *slot, bool *freep)
 
         /*
          * Record the current end of our update after the lock. That is how far our calls can
-         * guarantee.
+         * guarantee. Later slots already written to the same file are made durable by the same
+         * sync, extend the LSN to cover them so their threads don't have to sync again.
          */
         WT_ASSIGN_LSN(&sync_lsn, &slot->slot_end_lsn);
+        WT_ASSIGN_LSN(&write_lsn, &log->write_lsn);
+        if (write_lsn.l.file == sync_lsn.l.file && __wt_log_cmp(&write_lsn, &sync_lsn) > 0)
+            WT_ASSIGN_LSN(&sync_lsn, &write_lsn);
         /*
          * Check if we have to sync the parent directory. Some combinations of sync flags may result
          * in the log file not yet stable in its parent directory. Do that now if needed.
@@ -2679,6 +2699,14 @@ __log_write_internal(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp, ui
      */
     __wti_log_slot_join(session, rdup_len, flags, &myslot);
 
+    /*
+     * A commit that syncs the log may wait for other commits to join its slot before forcing the
+     * slot out.
+     */
+    if (LF_ISSET(WT_LOG_FSYNC) && myslot.end_offset < WTI_LOG_SLOT_BUF_MAX &&
+      !F_ISSET(&myslot, WTI_MYSLOT_UNBUFFERED))
+        __wti_log_slot_group_commit(session, &myslot);
+
     /*
      * If the addition of this record crosses the buffer boundary, switch in a new slot.
      */
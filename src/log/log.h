@@ -144,6 +144,7 @@ struct __wt_log_manager {
     wt_off_t extend_len;            /* configuration : file_extend log length */
     wt_off_t file_max;              /* configuration : Log file max size */
     uint32_t force_write_wait;      /* configuration : Log force write wait */
+    uint64_t group_commit_wait_max; /* configuration : Group commit max wait (usecs) */
     const char *log_path;           /* configuration : Logging path format */
     wt_shared uint32_t txn_logsync; /* configuration : Log sync */
 
@@ -179,6 +180,8 @@ struct __wt_log_manager {
 
 extern int __wt_curlog_open(WT_SESSION_IMPL *session, const char *uri, const char *cfg[],
   WT_CURSOR **cursorp) WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
+extern int __wt_log_bg_commit_drain(WT_SESSION_IMPL *session)
+  WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
 extern int __wt_log_compat_verify(WT_SESSION_IMPL *session)
   WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
 extern int __wt_log_filename(WT_SESSION_IMPL *session, uint32_t id, const char *file_prefix,
@@ -313,12 +316,15 @@ extern int __wt_logop_write(WT_SESSION_IMPL *session, uint8_t **pp, uint8_t *end
   uint32_t opsize) WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
 extern int __wt_logrec_alloc(WT_SESSION_IMPL *session, size_t size, WT_ITEM **logrecp)
   WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
+extern int __wt_logrec_commit_pack(WT_SESSION_IMPL *session, WT_ITEM *logrec, uint64_t txnid)
+  WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
 extern int __wt_logrec_read(WT_SESSION_IMPL *session, const uint8_t **pp, const uint8_t *end,
   uint32_t *rectypep) WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
 extern int __wt_txn_op_printlog(WT_SESSION_IMPL *session, const uint8_t **pp, const uint8_t *end,
   WT_TXN_PRINTLOG_ARGS *args) WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
 extern int __wt_verbose_dump_log(WT_SESSION_IMPL *session)
   WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
+extern void __wt_log_bg_commit(WT_SESSION_IMPL *session, WT_LSN *lsnp);
 extern void __wt_log_ckpt(WT_SESSION_IMPL *session, WT_LSN *ckpt_lsn);
 extern void __wt_log_written_reset(WT_SESSION_IMPL *session);
 extern void __wt_logmgr_compat_version(WT_SESSION_IMPL *session);
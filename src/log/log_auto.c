@@ -146,6 +146,29 @@ __wt_logrec_free(WT_SESSION_IMPL *session, WT_ITEM **logrecp)
     __wt_scr_free(session, logrecp);
 }
 
+/*
+ * __wt_logrec_commit_pack --
+ *     Pack the header of a transaction commit record, the record type and transaction ID. Every
+ *     commit writes one, so avoid the format-driven packing code.
+ */
+int
+__wt_logrec_commit_pack(WT_SESSION_IMPL *session, WT_ITEM *logrec, uint64_t txnid)
+{
+    size_t size;
+    uint8_t *buf, *end;
+
+    size = __wt_vsize_uint(WT_LOGREC_COMMIT) + __wt_vsize_uint(txnid);
+    WT_RET(__wt_buf_extend(session, logrec, logrec->size + size));
+
+    buf = (uint8_t *)logrec->data + logrec->size;
+    end = buf + size;
+    WT_RET(__pack_encode_uintAny(&buf, end, WT_LOGREC_COMMIT));
+    WT_RET(__pack_encode_uintAny(&buf, end, txnid));
+
+    logrec->size += (uint32_t)size;
+    return (0);
+}
+
 /*
  * __wt_logrec_read --
  *     Read the record type.
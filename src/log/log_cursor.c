@@ -190,6 +190,37 @@ err:
     return (ret);
 }
 
+/*
+ * __curlog_tail_wait --
+ *     Wait for a log record to be written past the cursor's position, for up to the cursor's
+ *     configured time. Records are only read once written, a record being copied into the log
+ *     buffer may follow a hole in the file.
+ */
+static int
+__curlog_tail_wait(WT_SESSION_IMPL *session, WTI_CURSOR_LOG *cl)
+{
+    WTI_LOG *log;
+    uint64_t time_start, time_stop;
+
+    log = S2C(session)->log_mgr.log;
+    if (log == NULL)
+        return (0);
+
+    time_start = __wt_clock(session);
+    for (;;) {
+        /* Records may be sitting in a log buffer, force them out. */
+        WT_RET(__wti_log_force_write(session, true, NULL));
+        if (__wt_log_cmp(&log->write_lsn, cl->next_lsn) > 0)
+            break;
+        time_stop = __wt_clock(session);
+        if (WT_CLOCKDIFF_MS(time_stop, time_start) >= cl->tail_wait_ms)
+            return (WT_NOTFOUND);
+        WT_STAT_CONN_INCR(session, log_cursor_tail_wait);
+        __wt_cond_wait(session, log->log_write_cond, 10 * WT_THOUSAND, NULL);
+    }
+    return (0);
+}
+
 /*
  * __curlog_next --
  *     WT_CURSOR.next method for the step log cursor type.
@@ -211,6 +242,8 @@ __curlog_next(WT_CURSOR *cursor)
      */
     if (cl->stepp == NULL || cl->stepp >= cl->stepp_end || !*cl->stepp) {
         cl->txnid = 0;
+        if (cl->tail_wait_ms != 0)
+            WT_ERR(__curlog_tail_wait(session, cl));
         ret = __wt_log_scan(session, cl->next_lsn, NULL, WT_LOGSCAN_ONE, __curlog_logrec, cl);
         if (ret == ENOENT)
             ret = WT_NOTFOUND;
@@ -351,6 +384,7 @@ __wt_curlog_open(WT_SESSION_IMPL *session, const char *uri, const char *cfg[], W
       __wt_cursor_reopen_notsup,                      /* reopen */
       __wt_cursor_checkpoint_id,                      /* checkpoint ID */
       __curlog_close);                                /* close */
+    WT_CONFIG_ITEM cval;
     WT_CURSOR *cursor;
     WTI_CURSOR_LOG *cl;
     WT_DECL_RET;
@@ -378,6 +412,9 @@ __wt_curlog_open(WT_SESSION_IMPL *session, const char *uri, const char *cfg[], W
 
     WT_ERR(__wt_cursor_init(cursor, uri, NULL, cfg, cursorp));
 
+    WT_ERR(__wt_config_gets_def(session, cfg, "log_tail_wait", 0, &cval));
+    cl->tail_wait_ms = (uint64_t)cval.val;
+
     if (log != NULL) {
         /*
          * The user may be trying to read a log record they just wrote. Log records may be buffered,
@@ -195,7 +195,7 @@ __logmgr_version(WT_SESSION_IMPL *session, bool reconfig)
 int
 __wt_logmgr_config(WT_SESSION_IMPL *session, const char **cfg, bool reconfig)
 {
-    WT_CONFIG_ITEM cval;
+    WT_CONFIG_ITEM ccfg, cval;
     WT_CONNECTION_IMPL *conn;
     WT_LOG_MANAGER *log_mgr;
     bool enabled;
@@ -257,9 +257,15 @@ __wt_logmgr_config(WT_SESSION_IMPL *session, const char **cfg, bool reconfig)
      * See above: should never happen.
      */
     if (!reconfig) {
+        /*
+         * Each log record is compressed on its own, so recovery can start reading at any record.
+         * Small records compress better with a compressor customized with a trained dictionary.
+         */
         log_mgr->compressor = NULL;
         WT_RET(__wt_config_gets_none(session, cfg, "log.compressor", &cval));
-        WT_RET(__wt_compressor_config(session, &cval, &log_mgr->compressor));
+        WT_RET(__wt_config_gets(session, cfg, "log.compressor_config", &ccfg));
+        WT_RET(__wt_compressor_config_custom(
+          session, "log.compressor", &cval, &ccfg, &log_mgr->compressor));
 
         log_mgr->log_path = NULL;
         WT_RET(__wt_config_gets(session, cfg, "log.path", &cval));
@@ -301,6 +307,9 @@ __wt_logmgr_config(WT_SESSION_IMPL *session, const char **cfg, bool reconfig)
         WT_STAT_CONN_SET(session, log_max_filesize, log_mgr->file_max);
     }
 
+    WT_RET(__wt_config_gets(session, cfg, "log.group_commit_wait_max", &cval));
+    log_mgr->group_commit_wait_max = (uint64_t)cval.val;
+
     WT_RET(__wt_config_gets(session, cfg, "log.os_cache_dirty_pct", &cval));
     if (cval.val != 0)
         log_mgr->dirty_max = (log_mgr->file_max * cval.val) / 100;
@@ -890,6 +899,128 @@ err:
     return (WT_THREAD_RET_VALUE);
 }
 
+/*
+ * __log_bg_commit_notify_session --
+ *     Notify a session its background commits are durable, if its last one is before the given sync
+ *     LSN. Called with the background commit lock held when logging is enabled.
+ */
+static void
+__log_bg_commit_notify_session(WT_SESSION_IMPL *session, WT_SESSION_IMPL *s, WT_LSN *sync_lsn)
+{
+    WT_DECL_RET;
+    WT_EVENT_HANDLER *handler;
+    WT_LSN lsn;
+    uint64_t count;
+
+    /*
+     * Read the count before the LSN: the LSN is written first, so it can only belong to the same or
+     * a later commit than the one the count includes.
+     */
+    WT_ACQUIRE_READ_WITH_BARRIER(count, s->bg_commit_count);
+    if (count == s->bg_commit_durable)
+        return;
+    WT_ASSIGN_LSN(&lsn, &s->bg_commit_lsn);
+    if (sync_lsn != NULL && __wt_log_cmp(&lsn, sync_lsn) >= 0)
+        return;
+
+    __wt_atomic_store64(&s->bg_commit_durable, count);
+    handler = s->event_handler;
+    if (handler != NULL && handler->handle_general != NULL &&
+      (ret = handler->handle_general(handler, &S2C(session)->iface, (WT_SESSION *)s,
+         WT_EVENT_COMMIT_DURABLE, &count)) != 0)
+        __wt_err(session, ret, "background commit durable notification");
+}
+
+/*
+ * __log_bg_commit_notify --
+ *     Make the background commits written so far durable and notify their sessions.
+ */
+static int
+__log_bg_commit_notify(WT_SESSION_IMPL *session)
+{
+    WT_CONNECTION_IMPL *conn;
+    WTI_LOG *log;
+    WT_LSN sync_lsn;
+    WT_SESSION_IMPL *s;
+    uint64_t bg_commits;
+    uint32_t i, session_cnt;
+
+    conn = S2C(session);
+    log = conn->log_mgr.log;
+
+    bg_commits = __wt_atomic_load64(&log->bg_commits);
+    if (bg_commits == log->bg_commits_notified)
+        return (0);
+
+    /*
+     * Every background commit counted has its record in the log already, a single sync covers all
+     * of them.
+     */
+    WT_RET(__wt_log_flush(session, WT_LOG_FSYNC));
+    WT_ASSIGN_LSN(&sync_lsn, &log->sync_lsn);
+
+    __wt_spin_lock(session, &log->bg_commit_lock);
+    WT_ACQUIRE_READ_WITH_BARRIER(session_cnt, conn->session_array.cnt);
+    for (s = WT_CONN_SESSIONS_GET(conn), i = 0; i < session_cnt; ++s, ++i)
+        if (s->active)
+            __log_bg_commit_notify_session(session, s, &sync_lsn);
+    log->bg_commits_notified = bg_commits;
+    __wt_spin_unlock(session, &log->bg_commit_lock);
+    return (0);
+}
+
+/*
+ * __wt_log_bg_commit --
+ *     Record a background commit, written to the log at the given LSN or not logged if the LSN is
+ *     NULL. The session is notified once the commit is durable.
+ */
+void
+__wt_log_bg_commit(WT_SESSION_IMPL *session, WT_LSN *lsnp)
+{
+    WT_LOG_MANAGER *log_mgr;
+
+    log_mgr = &S2C(session)->log_mgr;
+
+    if (lsnp != NULL)
+        WT_ASSIGN_LSN(&session->bg_commit_lsn, lsnp);
+    (void)__wt_atomic_add64(&session->bg_commit_count, 1);
+
+    /* Without logging there is nothing to wait for. */
+    if (!F_ISSET(log_mgr, WT_LOG_ENABLED)) {
+        __log_bg_commit_notify_session(session, session, NULL);
+        return;
+    }
+
+    (void)__wt_atomic_add64(&log_mgr->log->bg_commits, 1);
+    if (log_mgr->server.cond != NULL)
+        __wt_cond_signal(session, log_mgr->server.cond);
+}
+
+/*
+ * __wt_log_bg_commit_drain --
+ *     Make a closing session's background commits durable and notify it.
+ */
+int
+__wt_log_bg_commit_drain(WT_SESSION_IMPL *session)
+{
+    WTI_LOG *log;
+    WT_LSN sync_lsn;
+
+    if (__wt_atomic_load64(&session->bg_commit_count) ==
+      __wt_atomic_load64(&session->bg_commit_durable))
+        return (0);
+
+    log = S2C(session)->log_mgr.log;
+    WT_ASSERT(session, log != NULL);
+    WT_RET(__wt_log_flush(session, WT_LOG_FSYNC));
+    WT_ASSIGN_LSN(&sync_lsn, &log->sync_lsn);
+
+    __wt_spin_lock(session, &log->bg_commit_lock);
+    __log_bg_commit_notify_session(session, session, &sync_lsn);
+    __wt_spin_unlock(session, &log->bg_commit_lock);
+    return (0);
+}
+
 /*
  * __log_server --
  *     The log server thread.
@@ -941,6 +1072,10 @@ __log_server(void *arg)
             WT_ERR_ERROR_OK(__wti_log_force_write(session, false, &did_work), EBUSY, false);
             force_write_time_start = __wt_clock(session);
         }
+
+        /* Make background commits durable and notify their sessions. */
+        WT_ERR(__log_bg_commit_notify(session));
+
         /*
          * We don't want to remove or pre-allocate files as often as we want to force out log
          * buffers. Only do it once per second or if the condition was signalled.
@@ -1021,6 +1156,7 @@ __wt_logmgr_create(WT_SESSION_IMPL *session)
     WT_RET(__wt_spin_init(session, &log->log_slot_lock, "log slot"));
     WT_RET(__wt_spin_init(session, &log->log_sync_lock, "log sync"));
     WT_RET(__wt_spin_init(session, &log->log_writelsn_lock, "log write LSN"));
+    WT_RET(__wt_spin_init(session, &log->bg_commit_lock, "log background commit"));
     WT_RET(__wt_rwlock_init(session, &log->log_remove_lock));
 
     WT_INIT_LSN(&log->alloc_lsn);
@@ -1197,6 +1333,7 @@ __wt_logmgr_destroy(WT_SESSION_IMPL *session)
     __wt_spin_destroy(session, &log_mgr->log->log_slot_lock);
     __wt_spin_destroy(session, &log_mgr->log->log_sync_lock);
     __wt_spin_destroy(session, &log_mgr->log->log_writelsn_lock);
+    __wt_spin_destroy(session, &log_mgr->log->bg_commit_lock);
     __wt_free(session, log_mgr->log_path);
     __wt_free(session, log_mgr->log);
     return (ret);
@@ -220,6 +220,20 @@ struct __wti_log {
     /* Notify any waiting threads when write_lsn is updated. */
     WT_CONDVAR *log_write_cond;
 
+    /*
+     * Group commit information
+     */
+    wt_shared uint64_t sync_arrival_gap;  /* Recent time between syncing commits (usecs) */
+    wt_shared uint64_t sync_arrival_last; /* Time of the last syncing commit */
+    wt_shared uint64_t sync_duration;     /* Recent log sync duration (usecs) */
+
+    /*
+     * Background commit information
+     */
+    WT_SPINLOCK bg_commit_lock;    /* Locked: Background commit notification */
+    wt_shared uint64_t bg_commits; /* Background commits written */
+    uint64_t bg_commits_notified;  /* Background commits notified durable */
+
 /*
  * Consolidation array information Our testing shows that the more consolidation we generate the
  * better the performance we see which equates to an active slot count of one.
@@ -281,6 +295,7 @@ struct __wti_cursor_log {
     uint32_t step_count;              /* Intra-record count */
     uint32_t rectype;                 /* Record type */
     uint64_t txnid;                   /* Record txnid */
+    uint64_t tail_wait_ms;            /* Wait for new records at the end of the log */
 
 /* AUTOMATIC FLAG VALUE GENERATION START 0 */
 #define WTI_CURLOG_REMOVE_LOCK 0x1u /* Remove lock held */
@@ -325,6 +340,7 @@ extern int64_t __wti_log_slot_release(WTI_MYSLOT *myslot, int64_t size)
   WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
 extern void __wti_log_slot_activate(WT_SESSION_IMPL *session, WTI_LOGSLOT *slot);
 extern void __wti_log_slot_free(WT_SESSION_IMPL *session, WTI_LOGSLOT *slot);
+extern void __wti_log_slot_group_commit(WT_SESSION_IMPL *session, WTI_MYSLOT *myslot);
 extern void __wti_log_slot_join(
   WT_SESSION_IMPL *session, uint64_t mysize, uint32_t flags, WTI_MYSLOT *myslot);
 extern void __wti_log_wrlsn(WT_SESSION_IMPL *session, int *yield);
@@ -640,6 +640,60 @@ __wti_log_slot_join(WT_SESSION_IMPL *session, uint64_t mysize, uint32_t flags, W
     myslot->end_offset = (wt_off_t)((uint64_t)join_offset + mysize);
 }
 
+/*
+ * __wti_log_slot_group_commit --
+ *     Hold the slot a syncing commit joined open for a while, so other commits can join it and
+ *     share its sync. The wait is chosen from the recent sync latency and the rate syncing commits
+ *     arrive: if another commit is not expected before a sync would complete, there is no point in
+ *     waiting, and holding the slot for more than half a sync only adds latency.
+ */
+void
+__wti_log_slot_group_commit(WT_SESSION_IMPL *session, WTI_MYSLOT *myslot)
+{
+    WT_LOG_MANAGER *log_mgr;
+    WTI_LOG *log;
+    WTI_LOGSLOT *slot;
+    uint64_t gap, last, now, sync_usecs, time_start, wait_usecs;
+    int64_t state;
+
+    log_mgr = &S2C(session)->log_mgr;
+    log = log_mgr->log;
+    slot = myslot->slot;
+
+    if (log_mgr->group_commit_wait_max == 0)
+        return;
+
+    /*
+     * Track the time between syncing commits as a moving average. The updates aren't serialized,
+     * an occasional lost update doesn't matter.
+     */
+    now = __wt_clock(session);
+    last = __wt_atomic_load64(&log->sync_arrival_last);
+    __wt_atomic_store64(&log->sync_arrival_last, now);
+    gap = last == 0 || now < last ? WT_MILLION : WT_CLOCKDIFF_US(now, last);
+    gap = (__wt_atomic_load64(&log->sync_arrival_gap) * 7 + WT_MIN(gap, WT_MILLION)) / 8;
+    __wt_atomic_store64(&log->sync_arrival_gap, gap);
+
+    sync_usecs = __wt_atomic_load64(&log->sync_duration);
+    if (gap >= sync_usecs)
+        return;
+    wait_usecs = WT_MIN(sync_usecs / 2, log_mgr->group_commit_wait_max);
+
+    WT_STAT_CONN_INCR(session, log_slot_group_commit_wait);
+    time_start = now;
+    for (;;) {
+        state = __wt_atomic_loadiv64(&slot->slot_state);
+        if (!WTI_LOG_SLOT_OPEN(state) || WTI_LOG_SLOT_JOINED(state) >= WTI_LOG_SLOT_BUF_MAX)
+            break;
+        now = __wt_clock(session);
+        if (WT_CLOCKDIFF_US(now, time_start) >= wait_usecs)
+            break;
+        __wt_yield();
+    }
+    WT_STAT_CONN_INCRV(session, log_slot_group_commit_wait_duration,
+      WT_CLOCKDIFF_US(__wt_clock(session), time_start));
+}
+
 /*
  * __wti_log_slot_release --
  *     Each thread in a consolidated group releases its portion to signal it has completed copying
@@ -41,6 +41,13 @@
 
 #endif
 
+/*
+ * WT_HUGE_ALLOC_OK --
+ *	If an allocation can come from the connection's huge page arena.
+ */
+#define WT_HUGE_ALLOC_OK(session, bytes) \
+    ((session) != NULL && S2C(session)->huge_arena != NULL && (bytes) >= WT_HUGE_ARENA_MIN)
+
 /*
  * __wt_calloc --
  *     ANSI calloc function.
@@ -65,6 +72,13 @@ __wt_calloc(WT_SESSION_IMPL *session, size_t number, size_t size, void *retp)
     if (session != NULL)
         WT_STAT_CONN_INCR(session, memory_allocation);
 
+    if (WT_HUGE_ALLOC_OK(session, number * size) &&
+      (p = __wt_huge_alloc(session, number * size)) != NULL) {
+        memset(p, 0, number * size);
+        *(void **)retp = p;
+        return (0);
+    }
+
     if ((p = calloc(number, size)) == NULL)
         WT_RET_MSG(session, __wt_errno(), "memory allocation of %" WT_SIZET_FMT " bytes failed",
           size * number);
@@ -96,6 +110,12 @@ __wt_malloc(WT_SESSION_IMPL *session, size_t bytes_to_allocate, void *retp)
     if (session != NULL)
         WT_STAT_CONN_INCR(session, memory_allocation);
 
+    if (WT_HUGE_ALLOC_OK(session, bytes_to_allocate) &&
+      (p = __wt_huge_alloc(session, bytes_to_allocate)) != NULL) {
+        *(void **)retp = p;
+        return (0);
+    }
+
     if ((p = malloc(bytes_to_allocate)) == NULL)
         WT_RET_MSG(session, __wt_errno(), "memory allocation of %" WT_SIZET_FMT " bytes failed",
           bytes_to_allocate);
@@ -104,6 +124,36 @@ __wt_malloc(WT_SESSION_IMPL *session, size_t bytes_to_allocate, void *retp)
     return (0);
 }
 
+/*
+ * __realloc_huge --
+ *     Reallocate memory allocated from the huge page arena, or allocate memory the huge page arena
+ *     can serve.
+ */
+static int
+__realloc_huge(WT_SESSION_IMPL *session, size_t bytes_to_allocate, void **pp)
+{
+    size_t size;
+    void *p;
+
+    /* Allocations are rounded up to their size class, the memory may already be large enough. */
+    size = *pp == NULL ? 0 : __wt_huge_size(*pp);
+    if (bytes_to_allocate <= size)
+        return (0);
+
+    p = NULL;
+    if (WT_HUGE_ALLOC_OK(session, bytes_to_allocate))
+        p = __wt_huge_alloc(session, bytes_to_allocate);
+    if (p == NULL && (p = malloc(bytes_to_allocate)) == NULL)
+        WT_RET_MSG(session, __wt_errno(), "memory allocation of %" WT_SIZET_FMT " bytes failed",
+          bytes_to_allocate);
+    if (*pp != NULL) {
+        memcpy(p, *pp, size);
+        __wt_huge_free(*pp);
+    }
+    *pp = p;
+    return (0);
+}
+
 /*
  * __realloc_func --
  *     ANSI realloc function.
@@ -156,7 +206,9 @@ __realloc_func(WT_SESSION_IMPL *session, size_t *bytes_allocated_ret, size_t byt
             __wt_explicit_overwrite(tmpp, bytes_allocated);
             __wt_free(session, tmpp);
         }
-    } else {
+    } else if (WT_HUGE_ARENA_OWNS(p) || (p == NULL && WT_HUGE_ALLOC_OK(session, bytes_to_allocate)))
+        WT_RET(__realloc_huge(session, bytes_to_allocate, &p));
+    else {
         if ((p = realloc(p, bytes_to_allocate)) == NULL)
             WT_RET_MSG(session, __wt_errno(), "memory allocation of %" WT_SIZET_FMT " bytes failed",
               bytes_to_allocate);
@@ -271,5 +323,8 @@ __wt_free_int(WT_SESSION_IMPL *session, const void *p_arg)
     if (session != NULL)
         WT_STAT_CONN_INCR(session, memory_free);
 
-    free(p);
+    if (WT_HUGE_ARENA_OWNS(p))
+        __wt_huge_free(p);
+    else
+        free(p);
 }
@@ -0,0 +1,348 @@
+/*-
+ * Copyright (c) 2014-present MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * A large cache mapped with the system's base page size spends a measurable part of each search in
+ * TLB misses. The huge page arena maps memory from explicitly reserved huge pages, and serves page
+ * images and other large allocations from it: allocations between WT_HUGE_ARENA_MIN and
+ * WT_HUGE_ARENA_MAX are rounded up to a size class, smaller and larger allocations, and allocations
+ * once the arena is exhausted, come from the heap. If the system has no huge pages reserved, the
+ * arena maps ordinary pages and asks for transparent huge pages.
+ *
+ * The arena is divided into slabs, a slab is assigned to a size class when the class first needs
+ * space, and never returned. Freed allocations are kept on their class's free list.
+ *
+ * The arena is shared by the connections in the process that configure it: memory can be freed
+ * without a session, so the arena freeing memory must be found from the memory's address alone.
+ * It's unmapped when the last connection using it closes, unless memory allocated from it hasn't
+ * been freed.
+ */
+
+/*
+ * __huge_class --
+ *     Return the size class of an allocation: four classes for each power of two.
+ */
+static WT_INLINE u_int
+__huge_class(size_t size)
+{
+    uint32_t bits;
+
+    if (size <= WT_HUGE_ARENA_MIN)
+        return (0);
+
+    /* The allocation is larger than 2^bits, and no larger than 2^(bits + 1). */
+    bits = __wt_log2_int((uint32_t)(size - 1));
+    return (1 + 4 * (bits - WT_HUGE_ARENA_MIN_SHIFT) +
+      (u_int)((size - 1 - ((size_t)1 << bits)) >> (bits - 2)));
+}
+
+/*
+ * __huge_class_size --
+ *     Return the allocation size of a size class.
+ */
+static size_t
+__huge_class_size(u_int class)
+{
+    u_int bits;
+
+    if (class == 0)
+        return (WT_HUGE_ARENA_MIN);
+
+    bits = WT_HUGE_ARENA_MIN_SHIFT + (class - 1) / 4;
+    return (((size_t)1 << bits) + ((class - 1) % 4 + 1) * ((size_t)1 << (bits - 2)));
+}
+
+/*
+ * __huge_map --
+ *     Map the arena's memory.
+ */
+static int
+__huge_map(WT_SESSION_IMPL *session, WT_HUGE_ARENA *arena)
+{
+#if defined(__linux__) && defined(MAP_HUGETLB)
+    int flags;
+    void *p;
+
+    flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB;
+#ifdef MAP_HUGE_SHIFT
+    flags |= (int)__wt_log2_int((uint32_t)arena->page_size) << MAP_HUGE_SHIFT;
+#endif
+    if ((p = mmap(NULL, arena->len, PROT_READ | PROT_WRITE, flags, -1, 0)) != MAP_FAILED) {
+        arena->base = p;
+        arena->hugetlb = true;
+        return (0);
+    }
+
+    /*
+     * The system doesn't have enough huge pages of the configured size reserved. Map ordinary pages
+     * and ask for transparent huge pages instead, they're only used for aligned ranges: map an
+     * extra huge page and skip to the first huge page boundary.
+     */
+    __wt_verbose_warning(session, WT_VERB_EVICTION,
+      "%" WT_SIZET_FMT " bytes of huge pages of %" WT_SIZET_FMT
+      " bytes are not available, using transparent huge pages",
+      arena->len, arena->page_size);
+    if ((p = mmap(NULL, arena->len + WT_HUGE_ARENA_SLAB, PROT_READ | PROT_WRITE,
+           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)) == MAP_FAILED)
+        WT_RET_MSG(session, __wt_errno(),
+          "huge page arena: mmap of %" WT_SIZET_FMT " bytes failed", arena->len);
+    arena->map = p;
+    arena->base = (uint8_t *)WT_ALIGN((uintptr_t)p, WT_HUGE_ARENA_SLAB);
+#ifdef MADV_HUGEPAGE
+    (void)madvise(arena->base, arena->len, MADV_HUGEPAGE);
+#endif
+    arena->hugetlb = false;
+    return (0);
+#else
+    WT_UNUSED(arena);
+    WT_RET_MSG(session, ENOTSUP, "cache_huge_pages is only supported on Linux");
+#endif
+}
+
+/*
+ * __huge_arena_discard --
+ *     Unmap the arena's memory and discard the arena.
+ */
+static int
+__huge_arena_discard(WT_SESSION_IMPL *session, WT_HUGE_ARENA *arena)
+{
+    WT_DECL_RET;
+    u_int i;
+
+#if defined(__linux__) && defined(MAP_HUGETLB)
+    if (arena->map != NULL) {
+        if (munmap(arena->map, arena->len + WT_HUGE_ARENA_SLAB) != 0)
+            ret = __wt_errno();
+    } else if (arena->base != NULL && munmap(arena->base, arena->len) != 0)
+        ret = __wt_errno();
+    if (ret != 0)
+        __wt_err(session, ret, "huge page arena: munmap of %" WT_SIZET_FMT " bytes", arena->len);
+#endif
+
+    /* The arena is discarded after the connection's statistics, don't count the frees. */
+    for (i = 0; i < WT_HUGE_ARENA_CLASSES; ++i)
+        __wt_spin_destroy(NULL, &arena->classes[i].lock);
+    __wt_free(NULL, arena->slab_class);
+    __wt_free(NULL, arena);
+    return (ret);
+}
+
+/*
+ * __huge_arena_create --
+ *     Create an arena.
+ */
+static int
+__huge_arena_create(
+  WT_SESSION_IMPL *session, size_t len, size_t page_size, WT_HUGE_ARENA **arenap)
+{
+    WT_DECL_RET;
+    WT_HUGE_ARENA *arena;
+    u_int i;
+
+    *arenap = NULL;
+
+    WT_RET(__wt_calloc_one(session, &arena));
+    arena->len = len;
+    arena->page_size = page_size;
+    arena->slabs = (uint32_t)(len / WT_HUGE_ARENA_SLAB);
+    WT_ERR(__wt_calloc_def(session, arena->slabs, &arena->slab_class));
+    for (i = 0; i < WT_HUGE_ARENA_CLASSES; ++i) {
+        WT_ERR(__wt_spin_init(session, &arena->classes[i].lock, "huge page arena"));
+        arena->classes[i].size = __huge_class_size(i);
+    }
+    WT_ERR(__huge_map(session, arena));
+
+    *arenap = arena;
+    return (0);
+
+err:
+    WT_TRET(__huge_arena_discard(session, arena));
+    return (ret);
+}
+
+/*
+ * __wt_huge_arena_acquire --
+ *     Configure the connection to allocate from the huge page arena, creating the arena if no other
+ *     connection in the process has.
+ */
+int
+__wt_huge_arena_acquire(WT_SESSION_IMPL *session, const char *cfg[])
+{
+    WT_CONFIG_ITEM cval;
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+    WT_HUGE_ARENA *arena;
+    size_t len, page_size;
+
+    conn = S2C(session);
+
+    WT_RET(__wt_config_gets(session, cfg, "cache_huge_pages.enabled", &cval));
+    if (cval.val == 0)
+        return (0);
+
+    WT_RET(__wt_config_gets(session, cfg, "cache_huge_pages.page_size", &cval));
+    page_size = WT_CONFIG_LIT_MATCH("1GB", cval) ? WT_GIGABYTE : 2 * WT_MEGABYTE;
+
+    /* The arena defaults to the cache size, a shared cache's size isn't known yet. */
+    WT_RET(__wt_config_gets(session, cfg, "cache_huge_pages.size", &cval));
+    len = cval.val != 0 ? (size_t)cval.val : (size_t)conn->cache_size;
+    if (len == 0)
+        WT_RET_MSG(
+          session, EINVAL, "cache_huge_pages.size must be configured with a shared cache");
+    len = WT_ALIGN(len, page_size);
+
+    __wt_spin_lock(session, &__wt_process.spinlock);
+    if ((arena = __wt_process.huge_arena) == NULL) {
+        WT_ERR(__huge_arena_create(session, len, page_size, &arena));
+        __wt_process.huge_arena = arena;
+        __wt_process.huge_arena_base = arena->base;
+        __wt_process.huge_arena_end = arena->base + arena->len;
+        WT_RELEASE_BARRIER();
+        __wt_verbose_info(session, WT_VERB_EVICTION,
+          "huge page arena of %" WT_SIZET_FMT " bytes mapped from %s pages of %" WT_SIZET_FMT
+          " bytes",
+          arena->len, arena->hugetlb ? "huge" : "transparent huge", arena->page_size);
+    } else if (arena->len != len || arena->page_size != page_size)
+        __wt_verbose_info(session, WT_VERB_EVICTION,
+          "sharing the process's huge page arena of %" WT_SIZET_FMT " bytes", arena->len);
+    ++arena->refs;
+    conn->huge_arena = arena;
+
+err:
+    __wt_spin_unlock(session, &__wt_process.spinlock);
+    return (ret);
+}
+
+/*
+ * __wt_huge_arena_release --
+ *     Stop the connection allocating from the huge page arena, discarding the arena if no other
+ *     connection uses it and all of its memory has been freed.
+ */
+int
+__wt_huge_arena_release(WT_SESSION_IMPL *session)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_HUGE_ARENA *arena;
+    uint64_t bytes_inuse;
+    bool discard;
+
+    conn = S2C(session);
+    if ((arena = conn->huge_arena) == NULL)
+        return (0);
+    conn->huge_arena = NULL;
+
+    __wt_spin_lock(session, &__wt_process.spinlock);
+    bytes_inuse = __wt_atomic_load64(&arena->bytes_inuse);
+    discard = --arena->refs == 0 && bytes_inuse == 0;
+    if (discard) {
+        __wt_process.huge_arena = NULL;
+        __wt_process.huge_arena_base = __wt_process.huge_arena_end = NULL;
+        WT_FULL_BARRIER();
+    }
+    __wt_spin_unlock(session, &__wt_process.spinlock);
+
+    if (discard)
+        return (__huge_arena_discard(session, arena));
+
+    /* Memory that hasn't been freed may still be freed: keep the arena. */
+    if (arena->refs == 0)
+        __wt_errx(session, "huge page arena: %" PRIu64 " bytes allocated at close", bytes_inuse);
+    return (0);
+}
+
+/*
+ * __wt_huge_alloc --
+ *     Allocate memory from the connection's huge page arena, returning NULL if the arena doesn't
+ *     serve the size or is exhausted.
+ */
+void *
+__wt_huge_alloc(WT_SESSION_IMPL *session, size_t size)
+{
+    WT_HUGE_ARENA *arena;
+    WT_HUGE_CLASS *hc;
+    uint32_t slab;
+    u_int class;
+    void *p;
+
+    arena = S2C(session)->huge_arena;
+    if (size > WT_HUGE_ARENA_MAX)
+        return (NULL);
+    class = __huge_class(size);
+    hc = &arena->classes[class];
+
+    __wt_spin_lock(session, &hc->lock);
+    if ((p = hc->free) != NULL)
+        hc->free = *(void **)p;
+    else {
+        /* Assign the class a new slab if its current slab is full. */
+        if ((size_t)(hc->end - hc->next) < hc->size) {
+            if (__wt_atomic_load32(&arena->slab_next) >= arena->slabs ||
+              (slab = __wt_atomic_fetch_add32(&arena->slab_next, 1)) >= arena->slabs) {
+                __wt_spin_unlock(session, &hc->lock);
+                WT_STAT_CONN_INCR(session, cache_huge_arena_fallback);
+                return (NULL);
+            }
+            arena->slab_class[slab] = (uint8_t)class;
+            hc->next = arena->base + (size_t)slab * WT_HUGE_ARENA_SLAB;
+            hc->end = hc->next + WT_HUGE_ARENA_SLAB;
+        }
+        p = hc->next;
+        hc->next += hc->size;
+    }
+    __wt_spin_unlock(session, &hc->lock);
+
+    (void)__wt_atomic_add64(&arena->bytes_inuse, hc->size);
+    WT_STAT_CONN_INCR(session, cache_huge_arena_alloc);
+    return (p);
+}
+
+/*
+ * __huge_owner --
+ *     Return the size class of memory allocated from the huge page arena.
+ */
+static WT_INLINE WT_HUGE_CLASS *
+__huge_owner(WT_HUGE_ARENA *arena, const void *p)
+{
+    size_t slab;
+
+    slab = (size_t)((const uint8_t *)p - arena->base) / WT_HUGE_ARENA_SLAB;
+    return (&arena->classes[arena->slab_class[slab]]);
+}
+
+/*
+ * __wt_huge_size --
+ *     Return the usable size of memory allocated from the huge page arena.
+ */
+size_t
+__wt_huge_size(const void *p)
+{
+    return (__huge_owner(__wt_process.huge_arena, p)->size);
+}
+
+/*
+ * __wt_huge_free --
+ *     Free memory allocated from the huge page arena.
+ */
+void
+__wt_huge_free(void *p)
+{
+    WT_HUGE_ARENA *arena;
+    WT_HUGE_CLASS *hc;
+
+    arena = __wt_process.huge_arena;
+    hc = __huge_owner(arena, p);
+
+    __wt_spin_lock(NULL, &hc->lock);
+    *(void **)p = hc->free;
+    hc->free = p;
+    __wt_spin_unlock(NULL, &hc->lock);
+
+    (void)__wt_atomic_sub64(&arena->bytes_inuse, hc->size);
+}
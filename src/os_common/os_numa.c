@@ -0,0 +1,121 @@
+/*-
+ * Copyright (c) 2014-present MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+#ifdef ENABLE_NUMA
+#include <numa.h>
+#include <sched.h>
+#endif
+
+/*
+ * The machine's NUMA nodes are numbered from 0 in the order of their system IDs, skipping nodes
+ * without CPUs: memory-only nodes have no threads to allocate memory locally or to bind to. A table
+ * maps each CPU to its node so the current node can be found without calling into libnuma.
+ */
+
+/*
+ * __wt_numa_init --
+ *     Find the machine's NUMA nodes. A machine without NUMA support has a single node.
+ */
+int
+__wt_numa_init(WT_SESSION_IMPL *session, WT_NUMA *numa)
+{
+#ifdef ENABLE_NUMA
+    struct bitmask *cpus;
+    WT_DECL_RET;
+    u_int cpu, max_cpus;
+    int id, max_node;
+
+    numa->nodes = 1;
+    if (numa_available() < 0)
+        return (0);
+
+    max_cpus = (u_int)numa_num_possible_cpus();
+    max_node = numa_max_node();
+    if ((cpus = numa_allocate_cpumask()) == NULL)
+        return (__wt_set_return(session, ENOMEM));
+    WT_ERR(__wt_calloc_def(session, max_cpus, &numa->cpu_node));
+    numa->cpus = max_cpus;
+
+    numa->nodes = 0;
+    for (id = 0; id <= max_node && numa->nodes < WT_NUMA_NODE_MAX; ++id) {
+        if (numa_node_to_cpus(id, cpus) != 0 || numa_bitmask_weight(cpus) == 0)
+            continue;
+        for (cpu = 0; cpu < max_cpus; ++cpu)
+            if (numa_bitmask_isbitset(cpus, cpu))
+                numa->cpu_node[cpu] = (uint8_t)numa->nodes;
+        numa->node_id[numa->nodes++] = id;
+    }
+    if (numa->nodes == 0)
+        numa->nodes = 1;
+
+err:
+    numa_free_cpumask(cpus);
+    return (ret);
+#else
+    WT_UNUSED(session);
+    numa->nodes = 1;
+    return (0);
+#endif
+}
+
+/*
+ * __wt_numa_destroy --
+ *     Discard the NUMA node information.
+ */
+void
+__wt_numa_destroy(WT_SESSION_IMPL *session, WT_NUMA *numa)
+{
+    __wt_free(session, numa->cpu_node);
+    numa->cpus = 0;
+    numa->nodes = 1;
+}
+
+/*
+ * __wt_numa_node_current --
+ *     Return the NUMA node of the CPU the calling thread is running on.
+ */
+u_int
+__wt_numa_node_current(WT_NUMA *numa)
+{
+#ifdef ENABLE_NUMA
+    int cpu;
+
+    if (numa->nodes == 1 || (cpu = sched_getcpu()) < 0 || (u_int)cpu >= numa->cpus)
+        return (0);
+    return (numa->cpu_node[cpu]);
+#else
+    WT_UNUSED(numa);
+    return (0);
+#endif
+}
+
+/*
+ * __wt_numa_bind_thread --
+ *     Bind the calling thread to the CPUs of a NUMA node, and allocate its memory from the node.
+ */
+int
+__wt_numa_bind_thread(WT_SESSION_IMPL *session, WT_NUMA *numa, u_int node)
+{
+#ifdef ENABLE_NUMA
+    WT_DECL_RET;
+
+    WT_ASSERT(session, node < numa->nodes);
+
+    WT_SYSCALL(numa_run_on_node(numa->node_id[node]), ret);
+    if (ret != 0)
+        WT_RET_MSG(session, ret, "failed to bind a thread to NUMA node %d", numa->node_id[node]);
+    numa_set_localalloc();
+    return (0);
+#else
+    WT_UNUSED(numa);
+    WT_UNUSED(node);
+    WT_RET_MSG(session, ENOTSUP, "binding a thread to a NUMA node requires libnuma");
+#endif
+}
@@ -0,0 +1,197 @@
+/*-
+ * Copyright (c) 2014-present MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+#include "reconcile_private.h"
+#include "reconcile_inline.h"
+
+/*
+ * WTI_REC_ARENA_HDR --
+ *     The chunk header, rounded up so allocations following it are aligned.
+ */
+#define WTI_REC_ARENA_HDR WT_ALIGN(sizeof(WTI_REC_ARENA_CHUNK), WTI_REC_ARENA_ALIGN)
+
+/*
+ * __rec_arena_chunk_free --
+ *     Free an arena's chunks.
+ */
+static void
+__rec_arena_chunk_free(WT_SESSION_IMPL *session, WTI_REC_ARENA *arena)
+{
+    WTI_REC_ARENA_CHUNK *chunk;
+
+    while ((chunk = arena->chunk) != NULL) {
+        arena->chunk = chunk->next;
+        __wt_free(session, chunk);
+    }
+    arena->used = 0;
+}
+
+/*
+ * __rec_arena_chunk_new --
+ *     Add a chunk to an arena.
+ */
+static int
+__rec_arena_chunk_new(WT_SESSION_IMPL *session, WTI_REC_ARENA *arena, size_t size)
+{
+    WTI_REC_ARENA_CHUNK *chunk;
+
+    size = WT_MAX(size, WTI_REC_ARENA_CHUNK_MIN);
+    WT_RET(__wt_malloc(session, WTI_REC_ARENA_HDR + size, &chunk));
+    chunk->next = arena->chunk;
+    chunk->size = size;
+    arena->chunk = chunk;
+    arena->used = 0;
+    WT_STAT_CONN_INCR(session, rec_arena_chunk);
+    return (0);
+}
+
+/*
+ * __wti_rec_arena_init --
+ *     Start a reconciliation's use of the arena, taking the chunk the session kept from its last
+ *     reconciliation.
+ */
+void
+__wti_rec_arena_init(WT_SESSION_IMPL *session, WTI_REC_ARENA *arena)
+{
+    if (arena->chunk == NULL && session->reconcile_arena != NULL) {
+        arena->chunk = session->reconcile_arena;
+        session->reconcile_arena = NULL;
+    }
+    arena->used = 0;
+    arena->total = 0;
+    arena->last = NULL;
+}
+
+/*
+ * __wti_rec_arena_alloc --
+ *     Allocate cleared memory from the reconciliation arena.
+ */
+int
+__wti_rec_arena_alloc(WT_SESSION_IMPL *session, WTI_REC_ARENA *arena, size_t bytes, void *retp)
+{
+    WTI_REC_ARENA_CHUNK *chunk;
+    uint8_t *p;
+
+    *(void **)retp = NULL;
+
+    /* Chunks double in size, a reconciliation needing lots of memory quickly stops allocating. */
+    bytes = WT_ALIGN(bytes, WTI_REC_ARENA_ALIGN);
+    if ((chunk = arena->chunk) == NULL || chunk->size - arena->used < bytes) {
+        WT_RET(__rec_arena_chunk_new(
+          session, arena, WT_MAX(bytes, chunk == NULL ? 0 : chunk->size * 2)));
+        chunk = arena->chunk;
+    }
+
+    p = (uint8_t *)chunk + WTI_REC_ARENA_HDR + arena->used;
+    memset(p, 0, bytes);
+    arena->used += bytes;
+    arena->total += bytes;
+    arena->last = p;
+    WT_STAT_CONN_INCR(session, rec_arena_alloc);
+
+    *(void **)retp = p;
+    return (0);
+}
+
+/*
+ * __wti_rec_arena_realloc --
+ *     Grow an allocation from the reconciliation arena, clearing the new memory. The most recent
+ *     allocation grows in place if there's room in its chunk, otherwise the contents are copied to
+ *     a new allocation, the old allocation is released with the rest of the arena.
+ */
+int
+__wti_rec_arena_realloc(WT_SESSION_IMPL *session, WTI_REC_ARENA *arena,
+  size_t *bytes_allocated_ret, size_t bytes_to_allocate, void *retp)
+{
+    size_t bytes_allocated, grow;
+    void *p;
+
+    p = *(void **)retp;
+    bytes_allocated = *bytes_allocated_ret;
+    WT_ASSERT(session,
+      (p == NULL && bytes_allocated == 0) ||
+        (p != NULL && bytes_allocated == WT_ALIGN(bytes_allocated, WTI_REC_ARENA_ALIGN)));
+
+    if (bytes_to_allocate <= bytes_allocated)
+        return (0);
+    bytes_to_allocate = WT_ALIGN(bytes_to_allocate, WTI_REC_ARENA_ALIGN);
+
+    if (p != NULL && p == arena->last) {
+        grow = bytes_to_allocate - bytes_allocated;
+        if (arena->chunk->size - arena->used >= grow) {
+            memset((uint8_t *)p + bytes_allocated, 0, grow);
+            arena->used += grow;
+            arena->total += grow;
+            *bytes_allocated_ret = bytes_to_allocate;
+            return (0);
+        }
+    }
+
+    WT_RET(__wti_rec_arena_alloc(session, arena, bytes_to_allocate, retp));
+    if (p != NULL)
+        memcpy(*(void **)retp, p, bytes_allocated);
+    *bytes_allocated_ret = bytes_to_allocate;
+    return (0);
+}
+
+/*
+ * __wti_rec_arena_reset --
+ *     Release everything allocated from the reconciliation arena.
+ */
+void
+__wti_rec_arena_reset(WT_SESSION_IMPL *session, WTI_REC_ARENA *arena)
+{
+    WTI_REC_ARENA_CHUNK *chunk;
+
+    /*
+     * If the reconciliation needed more than one chunk, replace them with a single chunk big enough
+     * for everything it used. Don't hold on to an unusually large chunk, eviction threads can each
+     * have a chunk, and the chunk is only a hint of what later reconciliations will need.
+     */
+    if ((chunk = arena->chunk) != NULL &&
+      (chunk->next != NULL || chunk->size > WTI_REC_ARENA_RETAIN_MAX)) {
+        __rec_arena_chunk_free(session, arena);
+        WT_IGNORE_RET(
+          __rec_arena_chunk_new(session, arena, WT_MIN(arena->total, WTI_REC_ARENA_RETAIN_MAX)));
+    }
+
+    arena->used = 0;
+    arena->total = 0;
+    arena->last = NULL;
+}
+
+/*
+ * __wti_rec_arena_free --
+ *     Free the reconciliation arena, leaving its chunk with the session for the session's next
+ *     reconciliation.
+ */
+void
+__wti_rec_arena_free(WT_SESSION_IMPL *session, WTI_REC_ARENA *arena)
+{
+    WTI_REC_ARENA_CHUNK *chunk;
+
+    if ((chunk = arena->chunk) != NULL && chunk->next == NULL &&
+      chunk->size <= WTI_REC_ARENA_RETAIN_MAX && session->reconcile_arena == NULL) {
+        session->reconcile_arena = chunk;
+        arena->chunk = NULL;
+    }
+    __rec_arena_chunk_free(session, arena);
+    arena->total = 0;
+    arena->last = NULL;
+}
+
+/*
+ * __wti_rec_arena_discard --
+ *     Discard the session's cached reconciliation arena chunk.
+ */
+void
+__wti_rec_arena_discard(WT_SESSION_IMPL *session)
+{
+    __wt_free(session, session->reconcile_arena);
+}
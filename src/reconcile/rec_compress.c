@@ -0,0 +1,401 @@
+/*-
+ * Copyright (c) 2014-present MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+#include "reconcile_private.h"
+#include "reconcile_inline.h"
+
+/* Define a function that increments histogram statistics compression ratios for block writes. */
+WT_STAT_COMPR_RATIO_WRITE_HIST_INCR_FUNC(ratio)
+
+/*
+ * Reconciliation normally keeps two chunks in memory, writing the previous chunk when the current
+ * one crosses a split boundary. When compression threads are configured, a chunk is handed to a
+ * compression worker as soon as it becomes the previous chunk, so its image is compressed while
+ * reconciliation fills the next chunk. The reconciling thread picks up the result when the chunk is
+ * written, and compresses the chunk itself if no worker has started on it yet.
+ */
+
+/*
+ * __rec_compress_thread_chk --
+ *     Check to decide if the compression thread should continue running.
+ */
+static bool
+__rec_compress_thread_chk(WT_SESSION_IMPL *session)
+{
+    return (__wt_atomic_loadbool(&S2C(session)->rec_compress_run));
+}
+
+/*
+ * __rec_compress_chunk --
+ *     Compress a chunk's disk image, skipping the header bytes.
+ */
+static void
+__rec_compress_chunk(WT_SESSION_IMPL *session, WTI_REC_CHUNK *chunk)
+{
+    WT_COMPRESSOR *compressor;
+    size_t result_len;
+    int compression_failed; /* Extension API, so not a bool. */
+
+    compressor = chunk->compressor;
+    compression_failed = 0;
+    result_len = 0;
+
+    /* The compressed image's size is the space available for the compressed bytes. */
+    chunk->compress_ret = compressor->compress(compressor, &session->iface,
+      (uint8_t *)chunk->image.mem + WT_BLOCK_COMPRESS_SKIP,
+      chunk->compress_src_size - WT_BLOCK_COMPRESS_SKIP,
+      (uint8_t *)chunk->compressed_image.mem + WT_BLOCK_COMPRESS_SKIP,
+      chunk->compressed_image.size, &result_len, &compression_failed);
+    chunk->compress_failed = compression_failed != 0;
+    chunk->compressed_image.size = result_len + WT_BLOCK_COMPRESS_SKIP;
+}
+
+/*
+ * __rec_compress_thread_run --
+ *     Entry function for a compression thread. This is called repeatedly from the thread group code
+ *     so it does not need to loop itself.
+ */
+static int
+__rec_compress_thread_run(WT_SESSION_IMPL *session, WT_THREAD *thread)
+{
+    WT_CONNECTION_IMPL *conn;
+    WTI_REC_CHUNK *chunk;
+
+    WT_UNUSED(thread);
+    conn = S2C(session);
+
+    if (__wt_atomic_loadbool(&conn->rec_compress_run))
+        __wt_cond_wait(
+          session, conn->rec_compress_threads.wait_cond, WT_THOUSAND * WT_THOUSAND, NULL);
+
+    for (;;) {
+        __wt_spin_lock(session, &conn->rec_compress_lock);
+        if ((chunk = TAILQ_FIRST(&conn->rec_compress_qh)) == NULL) {
+            __wt_spin_unlock(session, &conn->rec_compress_lock);
+            break;
+        }
+        TAILQ_REMOVE(&conn->rec_compress_qh, chunk, compress_q);
+        chunk->compress_state = WTI_REC_COMPRESS_RUNNING;
+        __wt_spin_unlock(session, &conn->rec_compress_lock);
+
+        __rec_compress_chunk(session, chunk);
+
+        __wt_spin_lock(session, &conn->rec_compress_lock);
+        chunk->compress_state = WTI_REC_COMPRESS_DONE;
+        __wt_spin_unlock(session, &conn->rec_compress_lock);
+    }
+
+    return (0);
+}
+
+/*
+ * __wt_rec_compress_create --
+ *     Start the reconciliation compression threads.
+ */
+int
+__wt_rec_compress_create(WT_SESSION_IMPL *session, const char *cfg[])
+{
+    WT_CONFIG_ITEM cval;
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+
+    conn = S2C(session);
+
+    WT_RET(__wt_config_gets(session, cfg, "compression.threads", &cval));
+    conn->rec_compress_threads_count = (uint32_t)cval.val;
+
+    /* In-memory databases never write blocks, don't bother starting threads. */
+    if (conn->rec_compress_threads_count == 0 || F_ISSET_ATOMIC_32(conn, WT_CONN_IN_MEMORY))
+        return (0);
+
+    __wt_atomic_storebool(&conn->rec_compress_run, true);
+    WT_ERR(__wt_thread_group_create(session, &conn->rec_compress_threads, "rec-compress-server",
+      conn->rec_compress_threads_count, conn->rec_compress_threads_count,
+      WT_THREAD_CAN_WAIT | WT_THREAD_PANIC_FAIL, __rec_compress_thread_chk,
+      __rec_compress_thread_run, NULL));
+    return (0);
+
+err:
+    WT_TRET(__wt_rec_compress_destroy(session));
+    return (ret);
+}
+
+/*
+ * __wt_rec_compress_destroy --
+ *     Destroy the reconciliation compression threads.
+ */
+int
+__wt_rec_compress_destroy(WT_SESSION_IMPL *session)
+{
+    WT_CONNECTION_IMPL *conn;
+    WTI_REC_CHUNK *chunk;
+
+    conn = S2C(session);
+
+    if (!__wt_atomic_loadbool(&conn->rec_compress_run))
+        return (0);
+
+    /*
+     * Stop accepting work and hand anything still queued back to its reconciliation, which will
+     * compress the chunk itself.
+     */
+    __wt_spin_lock(session, &conn->rec_compress_lock);
+    __wt_atomic_storebool(&conn->rec_compress_run, false);
+    while ((chunk = TAILQ_FIRST(&conn->rec_compress_qh)) != NULL) {
+        TAILQ_REMOVE(&conn->rec_compress_qh, chunk, compress_q);
+        chunk->compress_state = WTI_REC_COMPRESS_NONE;
+    }
+    __wt_spin_unlock(session, &conn->rec_compress_lock);
+
+    /* Let any running threads finish up. */
+    __wt_cond_signal(session, conn->rec_compress_threads.wait_cond);
+
+    __wt_writelock(session, &conn->rec_compress_threads.lock);
+
+    return (__wt_thread_group_destroy(session, &conn->rec_compress_threads));
+}
+
+/*
+ * __rec_compress_sample --
+ *     Compress a sample of a chunk's image with each of the tree's compressors, and choose the one
+ *     with the best result, or no compression at all if none of them reduce the sample's size.
+ */
+static int
+__rec_compress_sample(WT_SESSION_IMPL *session, WTI_REC_CHUNK *chunk)
+{
+    WT_BTREE *btree;
+    WT_COMPRESSOR *compressor;
+    WT_DECL_ITEM(tmp);
+    WT_DECL_RET;
+    size_t best_len, len, result_len, src_len;
+    u_int i;
+    uint8_t *src;
+    int compression_failed; /* Extension API, so not a bool. */
+
+    btree = S2BT(session);
+
+    src = (uint8_t *)chunk->image.mem + WT_BLOCK_COMPRESS_SKIP;
+    src_len = WT_MIN(chunk->image.size - WT_BLOCK_COMPRESS_SKIP, WTI_REC_COMPRESS_SAMPLE_SIZE);
+    best_len = src_len;
+    chunk->compressor_id = WT_PAGE_COMPRESSOR_NONE;
+
+    WT_RET(__wt_scr_alloc(session, 0, &tmp));
+    for (i = WT_PAGE_COMPRESSOR_DEFAULT; i <= btree->compressor_adaptive_count; ++i) {
+        compressor = __wt_btree_compressor(btree, (uint8_t)i);
+        if (compressor->compress == NULL)
+            continue;
+
+        if (compressor->pre_size == NULL)
+            len = src_len;
+        else
+            WT_ERR(compressor->pre_size(compressor, &session->iface, src, src_len, &len));
+        WT_ERR(__wt_buf_init(session, tmp, len));
+
+        compression_failed = 0;
+        result_len = 0;
+        WT_ERR(compressor->compress(compressor, &session->iface, src, src_len, tmp->mem, len,
+          &result_len, &compression_failed));
+        if (compression_failed == 0 && result_len < best_len) {
+            best_len = result_len;
+            chunk->compressor_id = (uint8_t)i;
+        }
+    }
+
+    WT_STAT_DSRC_INCR(session, compress_adaptive_sample);
+    if (chunk->compressor_id == WT_PAGE_COMPRESSOR_NONE)
+        WT_STAT_DSRC_INCR(session, compress_adaptive_none);
+    else if (chunk->compressor_id != WT_PAGE_COMPRESSOR_DEFAULT)
+        WT_STAT_DSRC_INCR(session, compress_adaptive_alternate);
+
+err:
+    __wt_scr_free(session, &tmp);
+    return (ret);
+}
+
+/*
+ * __wti_rec_compress_select --
+ *     Choose the compressor for a chunk's page, for trees configured for adaptive compression.
+ */
+int
+__wti_rec_compress_select(WT_SESSION_IMPL *session, WTI_RECONCILE *r, WTI_REC_CHUNK *chunk)
+{
+    WT_BTREE *btree;
+
+    btree = S2BT(session);
+
+    if (chunk->compressor_selected)
+        return (0);
+    chunk->compressor_selected = true;
+    chunk->compressor_id = WT_PAGE_COMPRESSOR_DEFAULT;
+
+    /* In-memory reconciliation doesn't write, and the block write path skips tiny images. */
+    if (btree->compress_policy == WT_COMPRESS_POLICY_NONE || F_ISSET(r, WT_REC_IN_MEMORY) ||
+      chunk->image.size < 2 * WT_BLOCK_COMPRESS_SKIP)
+        return (0);
+
+    /*
+     * Pages written while they stay in cache, and pages being forcibly evicted because they grew
+     * too large, are hot: use the block compressor. Pages evicted because they weren't recently
+     * used are cold: use the compressor that does best on a sample of the page.
+     */
+    if (btree->compress_policy == WT_COMPRESS_POLICY_TEMPERATURE &&
+      (!F_ISSET(r, WT_REC_EVICT) || __wt_evict_page_is_soon(r->page)))
+        return (0);
+
+    return (__rec_compress_sample(session, chunk));
+}
+
+/*
+ * __wti_rec_compress_queue --
+ *     Queue a completed chunk for compression by a compression thread.
+ */
+int
+__wti_rec_compress_queue(WT_SESSION_IMPL *session, WTI_RECONCILE *r, WTI_REC_CHUNK *chunk)
+{
+    WT_BM *bm;
+    WT_BTREE *btree;
+    WT_COMPRESSOR *compressor;
+    WT_CONNECTION_IMPL *conn;
+    size_t len, size;
+    bool queued;
+
+    conn = S2C(session);
+    btree = S2BT(session);
+    bm = btree->bm;
+
+    WT_ASSERT(session, chunk->compress_state == WTI_REC_COMPRESS_NONE);
+
+    if (!__wt_atomic_loadbool(&conn->rec_compress_run))
+        return (0);
+
+    /*
+     * Fixed-length column-store chunks have their auxiliary header written into the image when the
+     * chunk is written, and in-memory reconciliation doesn't write, don't queue either. Don't
+     * bother with chunks that are too small to compress.
+     */
+    if (r->page->type == WT_PAGE_COL_FIX || F_ISSET(r, WT_REC_IN_MEMORY) ||
+      chunk->image.size < 2 * WT_BLOCK_COMPRESS_SKIP)
+        return (0);
+    WT_RET(__wti_rec_compress_select(session, r, chunk));
+    compressor = __wt_btree_compressor(btree, chunk->compressor_id);
+    if (compressor == NULL || compressor->compress == NULL)
+        return (0);
+
+    /* Size the destination buffer the same way the block write path does. */
+    if (compressor->pre_size == NULL)
+        len = chunk->image.size - WT_BLOCK_COMPRESS_SKIP;
+    else
+        WT_RET(compressor->pre_size(compressor, &session->iface,
+          (uint8_t *)chunk->image.mem + WT_BLOCK_COMPRESS_SKIP,
+          chunk->image.size - WT_BLOCK_COMPRESS_SKIP, &len));
+    size = len + WT_BLOCK_COMPRESS_SKIP;
+    WT_RET(bm->write_size(bm, session, &size));
+    WT_RET(__wt_buf_init(session, &chunk->compressed_image, size));
+    chunk->compressed_image.size = len;
+
+    chunk->compressor = compressor;
+    chunk->compress_src_size = chunk->image.size;
+    chunk->compress_ret = 0;
+    chunk->compress_failed = false;
+
+    __wt_spin_lock(session, &conn->rec_compress_lock);
+    if ((queued = __wt_atomic_loadbool(&conn->rec_compress_run))) {
+        chunk->compress_state = WTI_REC_COMPRESS_QUEUED;
+        TAILQ_INSERT_TAIL(&conn->rec_compress_qh, chunk, compress_q);
+    }
+    __wt_spin_unlock(session, &conn->rec_compress_lock);
+
+    if (queued)
+        __wt_cond_signal(session, conn->rec_compress_threads.wait_cond);
+    return (0);
+}
+
+/*
+ * __rec_compress_wait --
+ *     Wait for any compression of a chunk to complete, removing the chunk from the queue if no
+ *     thread has started on it. Return if the chunk was compressed.
+ */
+static bool
+__rec_compress_wait(WT_SESSION_IMPL *session, WTI_REC_CHUNK *chunk)
+{
+    WT_CONNECTION_IMPL *conn;
+    uint8_t state;
+
+    conn = S2C(session);
+
+    /* Only the reconciling thread moves a chunk out of the none state, no lock is needed. */
+    if (chunk->compress_state == WTI_REC_COMPRESS_NONE)
+        return (false);
+
+    for (;;) {
+        __wt_spin_lock(session, &conn->rec_compress_lock);
+        state = chunk->compress_state;
+        if (state == WTI_REC_COMPRESS_QUEUED)
+            TAILQ_REMOVE(&conn->rec_compress_qh, chunk, compress_q);
+        if (state != WTI_REC_COMPRESS_RUNNING)
+            chunk->compress_state = WTI_REC_COMPRESS_NONE;
+        __wt_spin_unlock(session, &conn->rec_compress_lock);
+
+        if (state != WTI_REC_COMPRESS_RUNNING)
+            break;
+        __wt_yield();
+    }
+
+    if (state == WTI_REC_COMPRESS_QUEUED)
+        WT_STAT_CONN_INCR(session, rec_compress_parallel_sync);
+    return (state == WTI_REC_COMPRESS_DONE);
+}
+
+/*
+ * __wti_rec_compress_image --
+ *     Return if a chunk's compressed image can be written in place of its disk image. The chunk's
+ *     page header must be complete.
+ */
+bool
+__wti_rec_compress_image(WT_SESSION_IMPL *session, WTI_REC_CHUNK *chunk)
+{
+    WT_PAGE_HEADER *dsk;
+
+    if (!__rec_compress_wait(session, chunk))
+        return (false);
+
+    /*
+     * The image may have been shortened or extended after it was queued, if the last two chunks
+     * were rebalanced. If that happened or compression failed, let the write path decide what to do
+     * with the original image.
+     */
+    if (chunk->compress_ret != 0 || chunk->compress_failed ||
+      chunk->compress_src_size != chunk->image.size) {
+        WT_STAT_CONN_INCR(session, rec_compress_parallel_discarded);
+        return (false);
+    }
+
+    /* Copy in the skipped header bytes and set the disk header flags. */
+    memcpy(chunk->compressed_image.mem, chunk->image.mem, WT_BLOCK_COMPRESS_SKIP);
+    dsk = chunk->compressed_image.mem;
+    F_SET(dsk, WT_PAGE_COMPRESSED);
+
+    WT_STAT_CONN_INCR(session, rec_compress_parallel);
+    WT_STAT_DSRC_INCR(session, compress_write);
+    __wt_stat_compr_ratio_write_hist_incr(session,
+      (chunk->image.size - WT_BLOCK_COMPRESS_SKIP) /
+        (chunk->compressed_image.size - WT_BLOCK_COMPRESS_SKIP));
+    return (true);
+}
+
+/*
+ * __wti_rec_compress_discard --
+ *     Discard any compression of a chunk, the chunk's image is about to be reused or freed.
+ */
+void
+__wti_rec_compress_discard(WT_SESSION_IMPL *session, WTI_REC_CHUNK *chunk)
+{
+    if (__rec_compress_wait(session, chunk))
+        WT_STAT_CONN_INCR(session, rec_compress_parallel_discarded);
+}
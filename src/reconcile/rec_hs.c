@@ -425,6 +425,12 @@ __rec_hs_insert_record(WT_SESSION_IMPL *session, WT_CURSOR *cursor, WT_BTREE *bt
      */
     F_SET(cursor, WT_CURSTD_HS_READ_ALL);
 
+    /* Skip searching for other versions of a key that has never been in the history store. */
+    if (!__wt_hs_filter_maybe_present(session, btree, key)) {
+        WT_STAT_CONN_DSRC_INCR(session, cache_hs_filter_skip);
+        goto insert;
+    }
+
     /*
      * Adjust counter if there exists an update in the history store with same btree id, key and
      * timestamp. Otherwise the newly inserting history store record may fall behind the existing
@@ -543,11 +549,13 @@ __rec_hs_insert_record(WT_SESSION_IMPL *session, WT_CURSOR *cursor, WT_BTREE *bt
     }
 #endif
 
+insert:
     /* Insert the new record now. */
     cursor->set_key(cursor, 4, btree->id, key, tw->start_ts, counter);
     cursor->set_value(
       cursor, tw, tw->durable_stop_ts, tw->durable_start_ts, (uint64_t)type, hs_value);
     WT_ERR(cursor->insert(cursor));
+    __wt_hs_filter_insert(session, btree, key);
 
 err:
     if (!hs_read_all_flag)
@@ -651,8 +659,6 @@ __wti_rec_hs_insert_updates(WT_SESSION_IMPL *session, WTI_RECONCILE *r, WT_MULTI
     WT_DECL_ITEM(prev_full_value);
     WT_DECL_ITEM(tmp);
     WT_DECL_RET;
-/* Limit the number of consecutive reverse modifies. */
-#define WT_MAX_CONSECUTIVE_REVERSE_MODIFY 10
 /* If the limit is exceeded, we will insert a full update to the history store */
 #define MAX_REVERSE_MODIFY_NUM 16
     WT_MODIFY entries[MAX_REVERSE_MODIFY_NUM];
@@ -661,7 +667,7 @@ __wti_rec_hs_insert_updates(WT_SESSION_IMPL *session, WTI_RECONCILE *r, WT_MULTI
     WT_UPDATE *newest_hs, *no_ts_upd, *oldest_upd, *prev_upd, *ref_upd, *tombstone, *upd;
     WT_TIME_WINDOW tw;
     wt_off_t hs_size;
-    uint64_t insert_cnt, max_hs_size, modify_cnt;
+    uint64_t insert_cnt, max_hs_size, max_modify_cnt, modify_cnt;
     uint64_t cache_hs_insert_full_update, cache_hs_insert_reverse_modify, cache_hs_write_squash;
     uint32_t i;
     int nentries;
@@ -677,6 +683,9 @@ __wti_rec_hs_insert_updates(WT_SESSION_IMPL *session, WTI_RECONCILE *r, WT_MULTI
       FLD_ISSET(S2C(session)->debug_flags, WT_CONN_DEBUG_EVICTION_CKPT_TS_ORDERING);
     cache_hs_insert_full_update = cache_hs_insert_reverse_modify = cache_hs_write_squash = 0;
 
+    /* Limit the number of consecutive reverse modifies, then insert a full update. */
+    max_modify_cnt = S2C(session)->cache->hs_delta_chain_max;
+
     WT_RET(__wt_curhs_open(session, NULL, &hs_cursor));
     F_SET(hs_cursor, WT_CURSTD_HS_READ_COMMITTED);
 
@@ -722,7 +731,7 @@ __wti_rec_hs_insert_updates(WT_SESSION_IMPL *session, WTI_RECONCILE *r, WT_MULTI
         /*
          * Reverse deltas are only supported on 'S' and 'u' value formats.
          */
-        enable_reverse_modify =
+        enable_reverse_modify = max_modify_cnt > 0 &&
           (WT_STREQ(btree->value_format, "S") || WT_STREQ(btree->value_format, "u"));
 
         /*
@@ -1022,7 +1031,7 @@ __wti_rec_hs_insert_updates(WT_SESSION_IMPL *session, WTI_RECONCILE *r, WT_MULTI
              */
             nentries = MAX_REVERSE_MODIFY_NUM;
             if (upd != newest_hs && enable_reverse_modify &&
-              modify_cnt < WT_MAX_CONSECUTIVE_REVERSE_MODIFY &&
+              modify_cnt < max_modify_cnt &&
               __wt_calc_modify(session, prev_full_value, full_value, prev_full_value->size / 10,
                 entries, &nentries) == 0) {
                 WT_ERR(__wt_modify_pack(hs_cursor, entries, nentries, &modify_value));
@@ -1112,6 +1121,13 @@ __wti_rec_hs_delete_key(WT_SESSION_IMPL *session, WT_CURSOR *hs_cursor, uint32_t
     non_ts_updates = false;
     hs_read_all_flag = F_ISSET(hs_cursor, WT_CURSTD_HS_READ_ALL);
 
+    /* There's nothing to delete if the key has never been in the history store. */
+    WT_ASSERT(session, S2BT(session)->id == btree_id);
+    if (!__wt_hs_filter_maybe_present(session, S2BT(session), key)) {
+        WT_STAT_CONN_DSRC_INCR(session, cache_hs_filter_skip);
+        return (0);
+    }
+
     hs_cursor->set_key(hs_cursor, 3, btree_id, key, WT_TS_NONE);
     /*
      * Setting the flag WT_CURSTD_HS_READ_ALL before searching the history store optimizes the
@@ -561,6 +561,16 @@ __rec_row_leaf_insert(WT_SESSION_IMPL *session, WTI_RECONCILE *r, WT_INSERT *ins
 
         WT_TIME_WINDOW_COPY(&tw, &upd_select.tw);
 
+        /*
+         * Discard values whose time-to-live has expired for all readers, unless part of the update
+         * chain is being saved, in which case the page's in-memory state must match what we write.
+         */
+        if (btree->ttl != 0 && upd->type != WT_UPDATE_TOMBSTONE && !upd_select.upd_saved &&
+          __wt_txn_tw_expired_all(session, &tw)) {
+            WT_STAT_CONN_DSRC_INCR(session, rec_ttl_expired);
+            continue;
+        }
+
         switch (upd->type) {
         case WT_UPDATE_MODIFY:
             /*
@@ -779,6 +789,16 @@ __wti_rec_row_leaf(
         if (upd == NULL && __wt_txn_tw_stop_visible_all(session, twp))
             upd = &upd_tombstone;
 
+        /*
+         * Similarly, discard values whose time-to-live has expired for all readers. Don't do this
+         * when part of the update chain is being saved, the restored page has to match the image.
+         */
+        if (btree->ttl != 0 && (upd == NULL || upd->type != WT_UPDATE_TOMBSTONE) &&
+          !upd_select.upd_saved && __wt_txn_tw_expired_all(session, twp)) {
+            WT_STAT_CONN_DSRC_INCR(session, rec_ttl_expired);
+            upd = &upd_tombstone;
+        }
+
         /* Build value cell. */
         if (upd == NULL) {
             /* Clear the on-disk cell time window if it is obsolete. */
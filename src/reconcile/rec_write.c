@@ -15,6 +15,7 @@ static int __rec_destroy(WT_SESSION_IMPL *, void *);
 static int __rec_destroy_session(WT_SESSION_IMPL *);
 static int __rec_init(WT_SESSION_IMPL *, WT_REF *, uint32_t, WT_SALVAGE_COOKIE *, void *);
 static int __rec_hs_wrapup(WT_SESSION_IMPL *, WTI_RECONCILE *);
+static int __rec_multi_copy(WT_SESSION_IMPL *, WTI_RECONCILE *, WT_MULTI **);
 static int __rec_root_write(WT_SESSION_IMPL *, WT_PAGE *, uint32_t);
 static int __rec_split_discard(WT_SESSION_IMPL *, WT_PAGE *);
 static int __rec_split_row_promote(WT_SESSION_IMPL *, WTI_RECONCILE *, WT_ITEM *, uint8_t);
@@ -205,7 +206,7 @@ __reconcile_post_wrapup(
             WT_RET(session->block_manager_cleanup(session));
         }
 
-        WT_RET(__rec_destroy_session(session));
+        WT_RET(__rec_destroy(session, &session->reconcile));
     }
 
     return (0);
@@ -671,6 +672,7 @@ __rec_init(WT_SESSION_IMPL *session, WT_REF *ref, uint32_t flags, WT_SALVAGE_COO
     r->delete_hs_upd_next = 0;
 
     /* The list of pages we've written. */
+    __wti_rec_arena_init(session, &r->arena);
     r->multi = NULL;
     r->multi_next = 0;
     r->multi_allocated = 0;
@@ -784,10 +786,12 @@ __rec_cleanup(WT_SESSION_IMPL *session, WTI_RECONCILE *r)
             __wt_free(session, multi->key.ikey);
     for (multi = r->multi, i = 0; i < r->multi_next; ++multi, ++i) {
         __wt_free(session, multi->disk_image);
-        __wt_free(session, multi->supd);
         __wt_free(session, multi->addr.addr);
     }
-    __wt_free(session, r->multi);
+
+    /* Release the list of pages we've written and their saved updates. */
+    r->multi = NULL;
+    __wti_rec_arena_reset(session, &r->arena);
 
     /* Reconciliation is not re-entrant, make sure that doesn't happen. */
     r->ref = NULL;
@@ -812,16 +816,24 @@ __rec_destroy(WT_SESSION_IMPL *session, void *reconcilep)
 
     *(WTI_RECONCILE **)reconcilep = NULL;
 
+    /* Compression threads may still reference the chunk images. */
+    __wti_rec_compress_discard(session, &r->chunk_A);
+    __wti_rec_compress_discard(session, &r->chunk_B);
+
     __wt_buf_free(session, &r->chunk_A.key);
     __wt_buf_free(session, &r->chunk_A.key_at_split_boundary);
     __wt_buf_free(session, &r->chunk_A.image);
+    __wt_buf_free(session, &r->chunk_A.compressed_image);
     __wt_buf_free(session, &r->chunk_B.key);
     __wt_buf_free(session, &r->chunk_B.key_at_split_boundary);
     __wt_buf_free(session, &r->chunk_B.image);
+    __wt_buf_free(session, &r->chunk_B.compressed_image);
 
     __wt_free(session, r->supd);
     __wt_free(session, r->delete_hs_upd);
 
+    __wti_rec_arena_free(session, &r->arena);
+
     __wti_rec_dictionary_free(session, r);
 
     __wt_buf_free(session, &r->k.buf);
@@ -839,12 +851,17 @@ __rec_destroy(WT_SESSION_IMPL *session, void *reconcilep)
 
 /*
  * __rec_destroy_session --
- *     Clean up the reconciliation structure, session version.
+ *     Clean up the reconciliation structure and the session's cached reconciliation memory, session
+ *     version.
  */
 static int
 __rec_destroy_session(WT_SESSION_IMPL *session)
 {
-    return (__rec_destroy(session, &session->reconcile));
+    WT_DECL_RET;
+
+    ret = __rec_destroy(session, &session->reconcile);
+    __wti_rec_arena_discard(session);
+    return (ret);
 }
 
 /*
@@ -856,6 +873,7 @@ __rec_write(WT_SESSION_IMPL *session, WT_ITEM *buf, uint8_t *addr, size_t *addr_
   size_t *compressed_sizep, bool checkpoint, bool checkpoint_io, bool compressed)
 {
     WT_BTREE *btree;
+    WT_COMPRESSOR *compressor;
     WT_DECL_ITEM(ctmp);
     WT_DECL_RET;
     WT_PAGE_HEADER *dsk;
@@ -881,12 +899,13 @@ __rec_write(WT_SESSION_IMPL *session, WT_ITEM *buf, uint8_t *addr, size_t *addr_
          */
         dsk = buf->mem;
         if (compressed) {
-            WT_ASSERT_ALWAYS(session, __wt_scr_alloc(session, dsk->mem_size, &ctmp),
+            WT_ASSERT_ALWAYS(session, __wt_scr_alloc(session, dsk->mem_size, &ctmp) == 0,
               "Failed to allocate scratch buffer");
 
             memcpy(ctmp->mem, buf->data, WT_BLOCK_COMPRESS_SKIP);
+            compressor = __wt_btree_compressor(btree, dsk->compressor);
             WT_ASSERT_ALWAYS(session,
-              btree->compressor->decompress(btree->compressor, &session->iface,
+              compressor->decompress(compressor, &session->iface,
                 (uint8_t *)buf->data + WT_BLOCK_COMPRESS_SKIP, buf->size - WT_BLOCK_COMPRESS_SKIP,
                 (uint8_t *)ctmp->data + WT_BLOCK_COMPRESS_SKIP,
                 ctmp->memsize - WT_BLOCK_COMPRESS_SKIP, &result_len) == 0,
@@ -1019,6 +1038,10 @@ __wt_split_page_size(int split_pct, uint32_t maxpagesize, uint32_t allocsize)
 static int
 __rec_split_chunk_init(WT_SESSION_IMPL *session, WTI_RECONCILE *r, WTI_REC_CHUNK *chunk)
 {
+    /* The disk image is about to be reused, discard any compression of a previous image. */
+    __wti_rec_compress_discard(session, chunk);
+    chunk->compressor_selected = false;
+
     chunk->recno = WT_RECNO_OOB;
     /* Don't touch the key item memory, that memory is reused. */
     chunk->key.size = 0;
@@ -1515,6 +1538,9 @@ __wti_rec_split(WT_SESSION_IMPL *session, WTI_RECONCILE *r, size_t next_len)
         tmp = r->prev_ptr;
         r->prev_ptr = r->cur_ptr;
         r->cur_ptr = tmp;
+
+        /* Compress the finished chunk while we fill the next one. */
+        WT_RET(__wti_rec_compress_queue(session, r, r->prev_ptr));
     }
 
     /* Initialize the next chunk, including the key. */
@@ -1788,13 +1814,14 @@ __wti_rec_split_finish(WT_SESSION_IMPL *session, WTI_RECONCILE *r)
  *     Move a saved WT_UPDATE list from the per-page cache to a specific block's list.
  */
 static int
-__rec_supd_move(WT_SESSION_IMPL *session, WT_MULTI *multi, WT_SAVE_UPD *supd, uint32_t n)
+__rec_supd_move(
+  WT_SESSION_IMPL *session, WTI_RECONCILE *r, WT_MULTI *multi, WT_SAVE_UPD *supd, uint32_t n)
 {
     uint32_t i;
 
     multi->supd_restore = false;
 
-    WT_RET(__wt_calloc_def(session, n, &multi->supd));
+    WT_RET(__wti_rec_arena_alloc(session, &r->arena, n * sizeof(WT_SAVE_UPD), &multi->supd));
 
     for (i = 0; i < n; ++i) {
         if (supd->restore)
@@ -1835,7 +1862,7 @@ __rec_split_write_supd(WT_SESSION_IMPL *session, WTI_RECONCILE *r, WTI_REC_CHUNK
      * The last block gets all remaining saved updates.
      */
     if (last_block) {
-        WT_RET(__rec_supd_move(session, multi, r->supd, r->supd_next));
+        WT_RET(__rec_supd_move(session, r, multi, r->supd, r->supd_next));
         r->supd_next = 0;
         r->supd_memsize = 0;
         return (ret);
@@ -1871,7 +1898,7 @@ __rec_split_write_supd(WT_SESSION_IMPL *session, WTI_RECONCILE *r, WTI_REC_CHUNK
             if (WT_INSERT_RECNO(supd->ins) >= next->recno)
                 break;
     if (i != 0) {
-        WT_ERR(__rec_supd_move(session, multi, r->supd, i));
+        WT_ERR(__rec_supd_move(session, r, multi, r->supd, i));
 
         /*
          * If there are updates that weren't moved to the block, shuffle them to the beginning of
@@ -1957,7 +1984,7 @@ __rec_split_write_header(WT_SESSION_IMPL *session, WTI_RECONCILE *r, WTI_REC_CHU
       __wt_process.fast_truncate_2022)
         F_SET(dsk, WT_PAGE_FT_UPDATE);
 
-    dsk->unused = 0;
+    dsk->compressor = chunk->compressor_id;
     dsk->version = WT_PAGE_VERSION_TS;
 
     /* Clear the memory owned by the block manager. */
@@ -2050,6 +2077,7 @@ __rec_split_write(WT_SESSION_IMPL *session, WTI_RECONCILE *r, WTI_REC_CHUNK *chu
     WT_PAGE *page;
     size_t addr_size, compressed_size;
     uint8_t addr[WT_ADDR_MAX_COOKIE];
+    bool compressed;
 #ifdef HAVE_DIAGNOSTIC
     bool verify_image;
 #endif
@@ -2071,7 +2099,8 @@ __rec_split_write(WT_SESSION_IMPL *session, WTI_RECONCILE *r, WTI_REC_CHUNK *chu
     }
 
     /* Make sure there's enough room for another write. */
-    WT_RET(__wt_realloc_def(session, &r->multi_allocated, r->multi_next + 1, &r->multi));
+    WT_RET(__wti_rec_arena_realloc_def(session, &r->arena, &r->multi_allocated, r->multi_next + 1,
+      &r->multi));
     multi = &r->multi[r->multi_next++];
 
     /* Initialize the address (set the addr type for the parent). */
@@ -2104,7 +2133,8 @@ __rec_split_write(WT_SESSION_IMPL *session, WTI_RECONCILE *r, WTI_REC_CHUNK *chu
     if (r->supd_next != 0)
         WT_RET(__rec_split_write_supd(session, r, chunk, multi, last_block));
 
-    /* Initialize the page header(s). */
+    /* Initialize the page header(s), choosing the page's compressor first. */
+    WT_RET(__wti_rec_compress_select(session, r, chunk));
     __rec_split_write_header(session, r, chunk, multi, chunk->image.mem);
     if (r->page->type == WT_PAGE_COL_FIX)
         __wti_rec_col_fix_write_auxheader(session, chunk->entries, chunk->aux_start_offset,
@@ -2150,9 +2180,12 @@ __rec_split_write(WT_SESSION_IMPL *session, WTI_RECONCILE *r, WTI_REC_CHUNK *chu
         WT_ASSERT_ALWAYS(session, chunk->entries > 0, "Trying to write an empty chunk");
     }
 
-    /* Write the disk image and get an address. */
-    WT_RET(__rec_write(session, &chunk->image, addr, &addr_size, &compressed_size, false,
-      F_ISSET(r, WT_REC_CHECKPOINT), false));
+    /* Write the disk image, or its copy compressed by a compression thread, and get an address. */
+    compressed = __wti_rec_compress_image(session, chunk);
+    WT_RET(__rec_write(session, compressed ? &chunk->compressed_image : &chunk->image, addr,
+      &addr_size, &compressed_size, false, F_ISSET(r, WT_REC_CHECKPOINT), compressed));
+    if (compressed)
+        compressed_size = chunk->compressed_image.size;
 #ifdef HAVE_DIAGNOSTIC
     verify_image = false;
 #endif
@@ -2399,6 +2432,39 @@ __rec_page_modify_ta_safe_free(WT_SESSION_IMPL *session, WT_TIME_AGGREGATE **ta)
     __wt_gen_next(session, WT_GEN_SPLIT, NULL);
 }
 
+/*
+ * __rec_multi_copy --
+ *     Copy the list of pages we've written, and their saved updates, out of the arena for the page
+ *     to keep.
+ */
+static int
+__rec_multi_copy(WT_SESSION_IMPL *session, WTI_RECONCILE *r, WT_MULTI **multip)
+{
+    WT_DECL_RET;
+    WT_MULTI *multi;
+    uint32_t i;
+
+    WT_RET(__wt_calloc_def(session, r->multi_next, &multi));
+    for (i = 0; i < r->multi_next; ++i) {
+        multi[i] = r->multi[i];
+        multi[i].supd = NULL;
+        if (r->multi[i].supd != NULL) {
+            WT_ERR(__wt_calloc_def(session, r->multi[i].supd_entries, &multi[i].supd));
+            memcpy(multi[i].supd, r->multi[i].supd,
+              r->multi[i].supd_entries * sizeof(WT_SAVE_UPD));
+        }
+    }
+
+    *multip = multi;
+    return (0);
+
+err:
+    for (i = 0; i < r->multi_next; ++i)
+        __wt_free(session, multi[i].supd);
+    __wt_free(session, multi);
+    return (ret);
+}
+
 /*
  * __rec_write_wrapup --
  *     Finish the reconciliation.
@@ -2575,7 +2641,7 @@ __rec_write_wrapup(WT_SESSION_IMPL *session, WTI_RECONCILE *r, WT_PAGE *page)
             WT_RET(__rec_split_dump_keys(session, r));
 
 split:
-        mod->mod_multi = r->multi;
+        WT_RET(__rec_multi_copy(session, r, &mod->mod_multi));
         mod->mod_multi_entries = r->multi_next;
         mod->rec_result = WT_PM_REC_MULTIBLOCK;
 
@@ -2690,7 +2756,7 @@ __rec_hs_wrapup(WT_SESSION_IMPL *session, WTI_RECONCILE *r)
         if (multi->supd != NULL) {
             WT_ERR(__wti_rec_hs_insert_updates(session, r, multi));
             if (!multi->supd_restore) {
-                __wt_free(session, multi->supd);
+                multi->supd = NULL;
                 multi->supd_entries = 0;
             }
         }
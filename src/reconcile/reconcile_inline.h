@@ -472,6 +472,13 @@ __wti_rec_time_window_clear_obsolete(WT_SESSION_IMPL *session, WTI_UPDATE_SELECT
     if (!WT_TIME_WINDOW_HAS_START(tw))
         return;
 
+    /*
+     * Trees with a time-to-live need the start timestamp to decide when the value expires, keep it
+     * until reconciliation discards the value.
+     */
+    if (S2BT(session)->ttl != 0 && tw->durable_start_ts != WT_TS_NONE)
+        return;
+
     /*
      * In memory database don't need to avoid writing values to the cell. If we remove this check we
      * create an extra update on the end of the chain later in reconciliation as we'll re-append the
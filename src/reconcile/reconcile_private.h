@@ -21,6 +21,22 @@
  */
 #define WTI_REC_SPLIT_MIN_ITEMS_USE_MEM 10
 
+/*
+ * WTI_REC_COMPRESS_SAMPLE_SIZE
+ *     The number of bytes of a page's image compressed by each compressor when choosing the page's
+ *     compressor for adaptive compression.
+ */
+#define WTI_REC_COMPRESS_SAMPLE_SIZE (8 * WT_KILOBYTE)
+
+/*
+ * WTI_REC_ARENA_ALIGN, WTI_REC_ARENA_CHUNK_MIN, WTI_REC_ARENA_RETAIN_MAX
+ *     The alignment of reconciliation arena allocations, the smallest chunk the arena allocates,
+ *     and the largest chunk a session keeps between reconciliations.
+ */
+#define WTI_REC_ARENA_ALIGN 16
+#define WTI_REC_ARENA_CHUNK_MIN (4 * WT_KILOBYTE)
+#define WTI_REC_ARENA_RETAIN_MAX (256 * WT_KILOBYTE)
+
 /*
  * WTI_REC_TW_START_VISIBLE_ALL
  *     Check if the provided time window's start is globally visible as per the saved state on the
@@ -99,6 +115,38 @@ struct __wti_rec_dictionary {
     WTI_REC_DICTIONARY *next[0];
 };
 
+/*
+ * WTI_REC_ARENA --
+ *	Memory that doesn't outlive a reconciliation is allocated by bumping an offset in a chunk
+ * and released in bulk when the reconciliation finishes. Sessions keep a chunk between
+ * reconciliations, so eviction threads reconciling many pages don't go to the heap.
+ */
+struct __wti_rec_arena_chunk {
+    WTI_REC_ARENA_CHUNK *next; /* Previously filled chunks */
+    size_t size;               /* Usable bytes */
+};
+
+struct __wti_rec_arena {
+    WTI_REC_ARENA_CHUNK *chunk; /* Current chunk */
+    size_t used;                /* Bytes used in the current chunk */
+    size_t total;               /* Bytes used by this reconciliation */
+    void *last;                 /* Most recent allocation */
+};
+
+/*
+ * __wti_rec_arena_realloc_def --
+ *     Allocate-and-grow a list in the reconciliation arena, growing it the same way as
+ *     __wt_realloc_def.
+ */
+#define __wti_rec_arena_realloc_def(session, arena, sizep, number, addr)        \
+    (((number) * sizeof(**(addr)) <= *(sizep)) ?                                \
+        0 :                                                                     \
+        __wti_rec_arena_realloc(session, arena, sizep,                          \
+          (FLD_ISSET(S2C(session)->debug_flags, WT_CONN_DEBUG_REALLOC_EXACT)) ? \
+            (number) * sizeof(**(addr)) :                                       \
+            WT_MAX(*(sizep)*2, WT_MAX(10, (number)) * sizeof(**(addr))),        \
+          addr))
+
 /*
  * WTI_REC_CHUNK --
  *	Reconciliation split chunk. If the total chunk size crosses the split size additional
@@ -141,6 +189,29 @@ struct __wti_rec_chunk {
     /* For fixed-length column store, track where the time windows start and how many we have. */
     uint32_t aux_start_offset;
     uint32_t auxentries;
+
+    /* For adaptive compression, the compressor chosen for the chunk's page header. */
+    uint8_t compressor_id;
+    bool compressor_selected;
+
+    /*
+     * Compression of the disk image by a compression worker thread: the worker compresses the
+     * image bytes after the page header into the compressed image, the reconciling thread adds the
+     * header when the chunk is written. The state fields are protected by the connection's
+     * compression lock.
+     */
+    TAILQ_ENTRY(__wti_rec_chunk) compress_q; /* Compression worker queue */
+    WT_COMPRESSOR *compressor;               /* Compressor to use */
+    WT_ITEM compressed_image;                /* Compressed disk-image */
+    size_t compress_src_size;                /* Image size when queued */
+    int compress_ret;                        /* Compressor return */
+    bool compress_failed;                    /* Compression didn't help */
+
+#define WTI_REC_COMPRESS_NONE 0    /* No compression queued */
+#define WTI_REC_COMPRESS_QUEUED 1  /* Queued for a worker */
+#define WTI_REC_COMPRESS_RUNNING 2 /* Being compressed by a worker */
+#define WTI_REC_COMPRESS_DONE 3    /* Compression complete */
+    uint8_t compress_state;
 };
 
 /*
@@ -320,7 +391,11 @@ struct __wti_reconcile {
     uint32_t delete_hs_upd_next;
     size_t delete_hs_upd_allocated;
 
-    /* List of pages we've written so far. */
+    /*
+     * List of pages we've written so far. The list and the blocks' saved update lists are allocated
+     * from the arena and copied if the page keeps them.
+     */
+    WTI_REC_ARENA arena;
     WT_MULTI *multi;
     uint32_t multi_next;
     size_t multi_allocated;
@@ -436,6 +511,8 @@ typedef struct {
 
 /* DO NOT EDIT: automatically built by prototypes.py: BEGIN */
 
+extern bool __wti_rec_compress_image(WT_SESSION_IMPL *session, WTI_REC_CHUNK *chunk)
+  WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
 extern int __wti_ovfl_reuse_add(WT_SESSION_IMPL *session, WT_PAGE *page, const uint8_t *addr,
   size_t addr_size, const void *value, size_t value_size)
   WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
@@ -446,6 +523,11 @@ extern int __wti_ovfl_track_wrapup(WT_SESSION_IMPL *session, WT_PAGE *page)
   WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
 extern int __wti_ovfl_track_wrapup_err(WT_SESSION_IMPL *session, WT_PAGE *page)
   WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
+extern int __wti_rec_arena_alloc(WT_SESSION_IMPL *session, WTI_REC_ARENA *arena, size_t bytes,
+  void *retp) WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
+extern int __wti_rec_arena_realloc(WT_SESSION_IMPL *session, WTI_REC_ARENA *arena,
+  size_t *bytes_allocated_ret, size_t bytes_to_allocate, void *retp)
+  WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
 extern int __wti_rec_cell_build_ovfl(WT_SESSION_IMPL *session, WTI_RECONCILE *r, WTI_REC_KV *kv,
   uint8_t type, WT_TIME_WINDOW *tw, uint64_t rle) WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
 extern int __wti_rec_child_modify(WT_SESSION_IMPL *session, WTI_RECONCILE *r, WT_REF *ref,
@@ -456,6 +538,10 @@ extern int __wti_rec_col_int(WT_SESSION_IMPL *session, WTI_RECONCILE *r, WT_REF
   WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
 extern int __wti_rec_col_var(WT_SESSION_IMPL *session, WTI_RECONCILE *r, WT_REF *pageref,
   WT_SALVAGE_COOKIE *salvage) WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
+extern int __wti_rec_compress_queue(WT_SESSION_IMPL *session, WTI_RECONCILE *r,
+  WTI_REC_CHUNK *chunk) WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
+extern int __wti_rec_compress_select(WT_SESSION_IMPL *session, WTI_RECONCILE *r,
+  WTI_REC_CHUNK *chunk) WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
 extern int __wti_rec_dictionary_init(WT_SESSION_IMPL *session, WTI_RECONCILE *r, u_int slots)
   WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
 extern int __wti_rec_dictionary_lookup(WT_SESSION_IMPL *session, WTI_RECONCILE *r, WTI_REC_KV *val,
@@ -487,8 +573,13 @@ extern int __wti_rec_split_init(WT_SESSION_IMPL *session, WTI_RECONCILE *r, WT_P
 extern int __wti_rec_upd_select(WT_SESSION_IMPL *session, WTI_RECONCILE *r, WT_INSERT *ins,
   WT_ROW *rip, WT_CELL_UNPACK_KV *vpack, WTI_UPDATE_SELECT *upd_select)
   WT_GCC_FUNC_DECL_ATTRIBUTE((warn_unused_result));
+extern void __wti_rec_arena_discard(WT_SESSION_IMPL *session);
+extern void __wti_rec_arena_free(WT_SESSION_IMPL *session, WTI_REC_ARENA *arena);
+extern void __wti_rec_arena_init(WT_SESSION_IMPL *session, WTI_REC_ARENA *arena);
+extern void __wti_rec_arena_reset(WT_SESSION_IMPL *session, WTI_REC_ARENA *arena);
 extern void __wti_rec_col_fix_write_auxheader(WT_SESSION_IMPL *session, uint32_t entries,
   uint32_t aux_start_offset, uint32_t auxentries, uint8_t *image, size_t size);
+extern void __wti_rec_compress_discard(WT_SESSION_IMPL *session, WTI_REC_CHUNK *chunk);
 extern void __wti_rec_dictionary_free(WT_SESSION_IMPL *session, WTI_RECONCILE *r);
 extern void __wti_rec_dictionary_reset(WTI_RECONCILE *r);
 static WT_INLINE bool __wti_rec_need_split(WTI_RECONCILE *r, size_t len)
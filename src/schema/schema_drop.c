@@ -22,6 +22,7 @@ __drop_file(
     WT_CONFIG_ITEM cval;
     WT_DECL_RET;
     const char *filename;
+    char hs_drop_cfg[32], hs_drop_uri[64];
     char *metadata_cfg = NULL;
     bool id_found, remove_files;
     uint32_t id = 0;
@@ -65,10 +66,21 @@ __drop_file(
      */
     WT_ERR(ret);
     if (id_found && !F_ISSET_ATOMIC_32(S2C(session), WT_CONN_IN_MEMORY) &&
-      F_ISSET_ATOMIC_32(S2C(session), WT_CONN_READY))
-        if (__wt_hs_btree_truncate(session, id) != 0)
+      F_ISSET_ATOMIC_32(S2C(session), WT_CONN_READY)) {
+        /*
+         * Optionally leave the truncate to the checkpoint cleanup thread. The file's ID is recorded
+         * in the metadata as part of the drop, so the ID isn't reused before the history store
+         * content is gone, even across a restart.
+         */
+        if (S2C(session)->cache->hs_drop_background) {
+            WT_ERR(__wt_snprintf(hs_drop_uri, sizeof(hs_drop_uri), "%s%" PRIu32,
+              WT_SYSTEM_HS_DROP_PREFIX, id));
+            WT_ERR(__wt_snprintf(hs_drop_cfg, sizeof(hs_drop_cfg), "id=%" PRIu32, id));
+            WT_ERR(__wt_metadata_insert(session, hs_drop_uri, hs_drop_cfg));
+        } else if (__wt_hs_btree_truncate(session, id) != 0)
             __wt_verbose_warning(
               session, WT_VERB_HS, "Failed to truncate history store for the file: %s", uri);
+    }
 err:
     __wt_free(session, metadata_cfg);
     return (ret);
@@ -380,6 +380,10 @@ __wt_session_close_internal(WT_SESSION_IMPL *session)
 
     WT_ASSERT(session, session->ncursors == 0);
 
+    /* Make any background commits durable, the session is notified before it closes. */
+    if (F_ISSET(&conn->log_mgr, WT_LOG_ENABLED))
+        WT_TRET(__wt_log_bg_commit_drain(session));
+
     /* Discard cached handles. */
     __wt_session_close_cache(session);
 
@@ -403,6 +407,10 @@ __wt_session_close_internal(WT_SESSION_IMPL *session)
         __wt_free(session, session->optrack_buf);
     }
 
+    /* Write out the session's eviction trace records. */
+    __wt_evict_trace_flush(session);
+    __wt_free(session, session->evict_trace_buf);
+
     /* Release common session resources. */
     WT_TRET(__wt_session_release_resources(session));
 
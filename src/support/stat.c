@@ -79,6 +79,7 @@ static const char *const __stats_dsrc_desc[] = {
   "cache: eviction walk target pages histogram - 64-128",
   "cache: eviction walk target pages reduced due to history store cache pressure",
   "cache: hazard pointer blocked page eviction",
+  "cache: history store key filters built",
   "cache: history store table insert calls",
   "cache: history store table insert calls that returned restart",
   "cache: history store table reads",
@@ -86,9 +87,11 @@ static const char *const __stats_dsrc_desc[] = {
   "cache: history store table reads requiring squashed modifies",
   "cache: history store table resolved updates without timestamps that lose their durable "
   "timestamp",
+  "cache: history store table searches skipped by the key filter",
   "cache: history store table truncation by rollback to stable to remove an unstable update",
   "cache: history store table truncation by rollback to stable to remove an update",
   "cache: history store table truncation to remove all the keys of a btree",
+  "cache: history store table truncation to remove all the keys of a dropped btree",
   "cache: history store table truncation to remove an update",
   "cache: history store table truncation to remove range of updates due to an update without a "
   "timestamp on data page",
@@ -181,6 +184,7 @@ static const char *const __stats_dsrc_desc[] = {
   "compression: pages read from disk with compression ratio smaller than 16",
   "compression: pages read from disk with compression ratio smaller than 32",
   "compression: pages read from disk with compression ratio smaller than 64",
+  "compression: pages sampled to choose an adaptive compressor",
   "compression: pages written to disk",
   "compression: pages written to disk with compression ratio greater than 64",
   "compression: pages written to disk with compression ratio smaller than  2",
@@ -189,6 +193,8 @@ static const char *const __stats_dsrc_desc[] = {
   "compression: pages written to disk with compression ratio smaller than 16",
   "compression: pages written to disk with compression ratio smaller than 32",
   "compression: pages written to disk with compression ratio smaller than 64",
+  "compression: pages written uncompressed after adaptive sampling found no gain",
+  "compression: pages written with an adaptive compressor other than the block compressor",
   "cursor: Total number of deleted pages skipped during tree walk",
   "cursor: Total number of entries skipped by cursor next calls",
   "cursor: Total number of entries skipped by cursor prev calls",
@@ -289,6 +295,7 @@ static const char *const __stats_dsrc_desc[] = {
   "reconciliation: pages written including at least one stop durable timestamp",
   "reconciliation: pages written including at least one stop timestamp",
   "reconciliation: pages written including at least one stop transaction ID",
+  "reconciliation: records discarded because their time-to-live expired",
   "reconciliation: records written including a prepare",
   "reconciliation: records written including a start durable timestamp",
   "reconciliation: records written including a start timestamp",
@@ -433,15 +440,18 @@ __wt_stat_dsrc_clear_single(WT_DSRC_STATS *stats)
     stats->cache_eviction_target_page_lt128 = 0;
     stats->cache_eviction_target_page_reduced = 0;
     stats->cache_eviction_blocked_hazard = 0;
+    stats->cache_hs_filter_build = 0;
     stats->cache_hs_insert = 0;
     stats->cache_hs_insert_restart = 0;
     stats->cache_hs_read = 0;
     stats->cache_hs_read_miss = 0;
     stats->cache_hs_read_squash = 0;
     stats->cache_hs_order_lose_durable_timestamp = 0;
+    stats->cache_hs_filter_skip = 0;
     stats->cache_hs_key_truncate_rts_unstable = 0;
     stats->cache_hs_key_truncate_rts = 0;
     stats->cache_hs_btree_truncate = 0;
+    stats->cache_hs_btree_truncate_dropped = 0;
     stats->cache_hs_key_truncate = 0;
     stats->cache_hs_order_remove = 0;
     stats->cache_hs_key_truncate_onpage_removal = 0;
@@ -527,6 +537,7 @@ __wt_stat_dsrc_clear_single(WT_DSRC_STATS *stats)
     stats->compress_read_ratio_hist_16 = 0;
     stats->compress_read_ratio_hist_32 = 0;
     stats->compress_read_ratio_hist_64 = 0;
+    stats->compress_adaptive_sample = 0;
     stats->compress_write = 0;
     stats->compress_write_ratio_hist_max = 0;
     stats->compress_write_ratio_hist_2 = 0;
@@ -535,6 +546,8 @@ __wt_stat_dsrc_clear_single(WT_DSRC_STATS *stats)
     stats->compress_write_ratio_hist_16 = 0;
     stats->compress_write_ratio_hist_32 = 0;
     stats->compress_write_ratio_hist_64 = 0;
+    stats->compress_adaptive_none = 0;
+    stats->compress_adaptive_alternate = 0;
     stats->cursor_tree_walk_del_page_skip = 0;
     stats->cursor_next_skip_total = 0;
     stats->cursor_prev_skip_total = 0;
@@ -633,6 +646,7 @@ __wt_stat_dsrc_clear_single(WT_DSRC_STATS *stats)
     stats->rec_time_window_pages_durable_stop_ts = 0;
     stats->rec_time_window_pages_stop_ts = 0;
     stats->rec_time_window_pages_stop_txn = 0;
+    stats->rec_ttl_expired = 0;
     stats->rec_time_window_prepared = 0;
     stats->rec_time_window_durable_start_ts = 0;
     stats->rec_time_window_start_ts = 0;
@@ -765,15 +779,18 @@ __wt_stat_dsrc_aggregate_single(WT_DSRC_STATS *from, WT_DSRC_STATS *to)
     to->cache_eviction_target_page_lt128 += from->cache_eviction_target_page_lt128;
     to->cache_eviction_target_page_reduced += from->cache_eviction_target_page_reduced;
     to->cache_eviction_blocked_hazard += from->cache_eviction_blocked_hazard;
+    to->cache_hs_filter_build += from->cache_hs_filter_build;
     to->cache_hs_insert += from->cache_hs_insert;
     to->cache_hs_insert_restart += from->cache_hs_insert_restart;
     to->cache_hs_read += from->cache_hs_read;
     to->cache_hs_read_miss += from->cache_hs_read_miss;
     to->cache_hs_read_squash += from->cache_hs_read_squash;
     to->cache_hs_order_lose_durable_timestamp += from->cache_hs_order_lose_durable_timestamp;
+    to->cache_hs_filter_skip += from->cache_hs_filter_skip;
     to->cache_hs_key_truncate_rts_unstable += from->cache_hs_key_truncate_rts_unstable;
     to->cache_hs_key_truncate_rts += from->cache_hs_key_truncate_rts;
     to->cache_hs_btree_truncate += from->cache_hs_btree_truncate;
+    to->cache_hs_btree_truncate_dropped += from->cache_hs_btree_truncate_dropped;
     to->cache_hs_key_truncate += from->cache_hs_key_truncate;
     to->cache_hs_order_remove += from->cache_hs_order_remove;
     to->cache_hs_key_truncate_onpage_removal += from->cache_hs_key_truncate_onpage_removal;
@@ -865,6 +882,7 @@ __wt_stat_dsrc_aggregate_single(WT_DSRC_STATS *from, WT_DSRC_STATS *to)
     to->compress_read_ratio_hist_16 += from->compress_read_ratio_hist_16;
     to->compress_read_ratio_hist_32 += from->compress_read_ratio_hist_32;
     to->compress_read_ratio_hist_64 += from->compress_read_ratio_hist_64;
+    to->compress_adaptive_sample += from->compress_adaptive_sample;
     to->compress_write += from->compress_write;
     to->compress_write_ratio_hist_max += from->compress_write_ratio_hist_max;
     to->compress_write_ratio_hist_2 += from->compress_write_ratio_hist_2;
@@ -873,6 +891,8 @@ __wt_stat_dsrc_aggregate_single(WT_DSRC_STATS *from, WT_DSRC_STATS *to)
     to->compress_write_ratio_hist_16 += from->compress_write_ratio_hist_16;
     to->compress_write_ratio_hist_32 += from->compress_write_ratio_hist_32;
     to->compress_write_ratio_hist_64 += from->compress_write_ratio_hist_64;
+    to->compress_adaptive_none += from->compress_adaptive_none;
+    to->compress_adaptive_alternate += from->compress_adaptive_alternate;
     to->cursor_tree_walk_del_page_skip += from->cursor_tree_walk_del_page_skip;
     to->cursor_next_skip_total += from->cursor_next_skip_total;
     to->cursor_prev_skip_total += from->cursor_prev_skip_total;
@@ -973,6 +993,7 @@ __wt_stat_dsrc_aggregate_single(WT_DSRC_STATS *from, WT_DSRC_STATS *to)
     to->rec_time_window_pages_durable_stop_ts += from->rec_time_window_pages_durable_stop_ts;
     to->rec_time_window_pages_stop_ts += from->rec_time_window_pages_stop_ts;
     to->rec_time_window_pages_stop_txn += from->rec_time_window_pages_stop_txn;
+    to->rec_ttl_expired += from->rec_ttl_expired;
     to->rec_time_window_prepared += from->rec_time_window_prepared;
     to->rec_time_window_durable_start_ts += from->rec_time_window_durable_start_ts;
     to->rec_time_window_start_ts += from->rec_time_window_start_ts;
@@ -1107,6 +1128,7 @@ __wt_stat_dsrc_aggregate(WT_DSRC_STATS **from, WT_DSRC_STATS *to)
     to->cache_eviction_target_page_reduced +=
       WT_STAT_DSRC_READ(from, cache_eviction_target_page_reduced);
     to->cache_eviction_blocked_hazard += WT_STAT_DSRC_READ(from, cache_eviction_blocked_hazard);
+    to->cache_hs_filter_build += WT_STAT_DSRC_READ(from, cache_hs_filter_build);
     to->cache_hs_insert += WT_STAT_DSRC_READ(from, cache_hs_insert);
     to->cache_hs_insert_restart += WT_STAT_DSRC_READ(from, cache_hs_insert_restart);
     to->cache_hs_read += WT_STAT_DSRC_READ(from, cache_hs_read);
@@ -1114,10 +1136,12 @@ __wt_stat_dsrc_aggregate(WT_DSRC_STATS **from, WT_DSRC_STATS *to)
     to->cache_hs_read_squash += WT_STAT_DSRC_READ(from, cache_hs_read_squash);
     to->cache_hs_order_lose_durable_timestamp +=
       WT_STAT_DSRC_READ(from, cache_hs_order_lose_durable_timestamp);
+    to->cache_hs_filter_skip += WT_STAT_DSRC_READ(from, cache_hs_filter_skip);
     to->cache_hs_key_truncate_rts_unstable +=
       WT_STAT_DSRC_READ(from, cache_hs_key_truncate_rts_unstable);
     to->cache_hs_key_truncate_rts += WT_STAT_DSRC_READ(from, cache_hs_key_truncate_rts);
     to->cache_hs_btree_truncate += WT_STAT_DSRC_READ(from, cache_hs_btree_truncate);
+    to->cache_hs_btree_truncate_dropped += WT_STAT_DSRC_READ(from, cache_hs_btree_truncate_dropped);
     to->cache_hs_key_truncate += WT_STAT_DSRC_READ(from, cache_hs_key_truncate);
     to->cache_hs_order_remove += WT_STAT_DSRC_READ(from, cache_hs_order_remove);
     to->cache_hs_key_truncate_onpage_removal +=
@@ -1224,6 +1248,7 @@ __wt_stat_dsrc_aggregate(WT_DSRC_STATS **from, WT_DSRC_STATS *to)
     to->compress_read_ratio_hist_16 += WT_STAT_DSRC_READ(from, compress_read_ratio_hist_16);
     to->compress_read_ratio_hist_32 += WT_STAT_DSRC_READ(from, compress_read_ratio_hist_32);
     to->compress_read_ratio_hist_64 += WT_STAT_DSRC_READ(from, compress_read_ratio_hist_64);
+    to->compress_adaptive_sample += WT_STAT_DSRC_READ(from, compress_adaptive_sample);
     to->compress_write += WT_STAT_DSRC_READ(from, compress_write);
     to->compress_write_ratio_hist_max += WT_STAT_DSRC_READ(from, compress_write_ratio_hist_max);
     to->compress_write_ratio_hist_2 += WT_STAT_DSRC_READ(from, compress_write_ratio_hist_2);
@@ -1232,6 +1257,8 @@ __wt_stat_dsrc_aggregate(WT_DSRC_STATS **from, WT_DSRC_STATS *to)
     to->compress_write_ratio_hist_16 += WT_STAT_DSRC_READ(from, compress_write_ratio_hist_16);
     to->compress_write_ratio_hist_32 += WT_STAT_DSRC_READ(from, compress_write_ratio_hist_32);
     to->compress_write_ratio_hist_64 += WT_STAT_DSRC_READ(from, compress_write_ratio_hist_64);
+    to->compress_adaptive_none += WT_STAT_DSRC_READ(from, compress_adaptive_none);
+    to->compress_adaptive_alternate += WT_STAT_DSRC_READ(from, compress_adaptive_alternate);
     to->cursor_tree_walk_del_page_skip += WT_STAT_DSRC_READ(from, cursor_tree_walk_del_page_skip);
     to->cursor_next_skip_total += WT_STAT_DSRC_READ(from, cursor_next_skip_total);
     to->cursor_prev_skip_total += WT_STAT_DSRC_READ(from, cursor_prev_skip_total);
@@ -1339,6 +1366,7 @@ __wt_stat_dsrc_aggregate(WT_DSRC_STATS **from, WT_DSRC_STATS *to)
       WT_STAT_DSRC_READ(from, rec_time_window_pages_durable_stop_ts);
     to->rec_time_window_pages_stop_ts += WT_STAT_DSRC_READ(from, rec_time_window_pages_stop_ts);
     to->rec_time_window_pages_stop_txn += WT_STAT_DSRC_READ(from, rec_time_window_pages_stop_txn);
+    to->rec_ttl_expired += WT_STAT_DSRC_READ(from, rec_ttl_expired);
     to->rec_time_window_prepared += WT_STAT_DSRC_READ(from, rec_time_window_prepared);
     to->rec_time_window_durable_start_ts +=
       WT_STAT_DSRC_READ(from, rec_time_window_durable_start_ts);
@@ -1414,9 +1442,11 @@ static const char *const __stats_connection_desc[] = {
   "block-cache: removed blocks",
   "block-cache: time sleeping to remove block (usecs)",
   "block-cache: total blocks",
+  "block-cache: total blocks inserted on eviction of clean pages",
   "block-cache: total blocks inserted on read path",
   "block-cache: total blocks inserted on write path",
   "block-cache: total bytes",
+  "block-cache: total bytes inserted on eviction of clean pages",
   "block-cache: total bytes inserted on read path",
   "block-cache: total bytes inserted on write path",
   "block-disagg: Bytes read from the shared history store in SLS",
@@ -1451,6 +1481,9 @@ static const char *const __stats_connection_desc[] = {
   "block-manager: number of times the region was remapped via write",
   "cache: application requested eviction interrupt",
   "cache: application thread time evicting (usecs)",
+  "cache: application thread waits for eviction threads",
+  "cache: application thread waits for eviction threads that reached the maximum wait",
+  "cache: application threads admitted by eviction threads",
   "cache: application threads eviction requested with cache fill ratio < 25%",
   "cache: application threads eviction requested with cache fill ratio >= 25% and < 50%",
   "cache: application threads eviction requested with cache fill ratio >= 50% and < 75%",
@@ -1478,6 +1511,8 @@ static const char *const __stats_connection_desc[] = {
   "cache: eviction calls to get a page found queue empty after locking",
   "cache: eviction currently operating in aggressive mode",
   "cache: eviction empty score",
+  "cache: eviction frequency policy page access counts aged",
+  "cache: eviction frequency policy pages ranked behind pages read once",
   "cache: eviction gave up due to detecting a disk value without a timestamp behind the last "
   "update on the chain",
   "cache: eviction gave up due to detecting a tombstone without a timestamp ahead of the selected "
@@ -1490,6 +1525,10 @@ static const char *const __stats_connection_desc[] = {
   "is running",
   "cache: eviction gave up due to no progress being made",
   "cache: eviction passes of a file",
+  "cache: eviction passes started by the predictive tuning forecast before reaching a target",
+  "cache: eviction predictive tuning forecast horizon extended after application threads evicted",
+  "cache: eviction predictive tuning forecast horizon in milliseconds",
+  "cache: eviction predictive tuning forecasts covering a checkpoint due within the horizon",
   "cache: eviction server candidate queue empty when topping up",
   "cache: eviction server candidate queue not empty when topping up",
   "cache: eviction server skips dirty pages during a running checkpoint",
@@ -1501,14 +1540,17 @@ static const char *const __stats_connection_desc[] = {
   "cache: eviction server skips pages that we do not want to evict",
   "cache: eviction server skips tree that we do not want to evict",
   "cache: eviction server skips trees because there are too many active walks",
+  "cache: eviction server skips trees below their minimum cache share",
   "cache: eviction server skips trees that are being checkpointed",
   "cache: eviction server skips trees that are configured to stick in cache",
   "cache: eviction server skips trees that disable eviction",
   "cache: eviction server skips trees that were not useful before",
+  "cache: eviction server skips trees while other trees are over their maximum cache share",
   "cache: eviction server slept, because we did not make progress with eviction",
   "cache: eviction server unable to reach eviction goal",
   "cache: eviction server waiting for a leaf page",
   "cache: eviction state",
+  "cache: eviction trace records written",
   "cache: eviction walk most recent sleeps for checkpoint handle gathering",
   "cache: eviction walk restored - had to walk this many pages",
   "cache: eviction walk restored position",
@@ -1533,6 +1575,7 @@ static const char *const __stats_connection_desc[] = {
   "cache: eviction walks started from saved location in tree",
   "cache: eviction worker thread active",
   "cache: eviction worker thread stable number",
+  "cache: eviction worker threads started by the predictive tuning forecast",
   "cache: files with active eviction walks",
   "cache: files with new eviction walks started",
   "cache: forced eviction - do not retry count to evict pages selected to evict during "
@@ -1553,6 +1596,7 @@ static const char *const __stats_connection_desc[] = {
   "cache: hazard pointer check calls",
   "cache: hazard pointer check entries walked",
   "cache: hazard pointer maximum array length",
+  "cache: history store key filters built",
   "cache: history store table insert calls",
   "cache: history store table insert calls that returned restart",
   "cache: history store table max on-disk size",
@@ -1562,9 +1606,11 @@ static const char *const __stats_connection_desc[] = {
   "cache: history store table reads requiring squashed modifies",
   "cache: history store table resolved updates without timestamps that lose their durable "
   "timestamp",
+  "cache: history store table searches skipped by the key filter",
   "cache: history store table truncation by rollback to stable to remove an unstable update",
   "cache: history store table truncation by rollback to stable to remove an update",
   "cache: history store table truncation to remove all the keys of a btree",
+  "cache: history store table truncation to remove all the keys of a dropped btree",
   "cache: history store table truncation to remove an update",
   "cache: history store table truncation to remove range of updates due to an update without a "
   "timestamp on data page",
@@ -1578,6 +1624,9 @@ static const char *const __stats_connection_desc[] = {
   "cache: history store table updates without timestamps fixed up by reinserting with the fixed "
   "timestamp",
   "cache: history store table writes requiring squashed modifies",
+  "cache: huge page arena allocations",
+  "cache: huge page arena allocations that fell back to the heap",
+  "cache: huge page arena bytes allocated",
   "cache: in-memory page passed criteria to be split",
   "cache: in-memory page splits",
   "cache: internal page split blocked its eviction",
@@ -1607,11 +1656,13 @@ static const char *const __stats_connection_desc[] = {
   "cache: page evict failures by application threads",
   "cache: page split during eviction deepened the tree",
   "cache: page written requiring history store records",
+  "cache: pages chosen by eviction workers from their own NUMA node ahead of queue order",
   "cache: pages considered for eviction that were brought in by pre-fetch",
   "cache: pages currently held in the cache",
   "cache: pages dirtied due to obsolete time window by eviction",
   "cache: pages evicted in parallel with checkpoint",
   "cache: pages queued for eviction",
+  "cache: pages queued for eviction from the dirty page index",
   "cache: pages queued for eviction post lru sorting",
   "cache: pages queued for urgent eviction",
   "cache: pages queued for urgent eviction during walk",
@@ -1625,12 +1676,14 @@ static const char *const __stats_connection_desc[] = {
   "cache: pages requested from the cache due to pre-fetch",
   "cache: pages seen by eviction walk",
   "cache: pages seen by eviction walk that are already queued",
+  "cache: pages seen in the dirty page index",
   "cache: pages selected for eviction unable to be evicted",
   "cache: pages selected for eviction unable to be evicted because of active children on an "
   "internal page",
   "cache: pages selected for eviction unable to be evicted because of failure in reconciliation",
   "cache: pages selected for eviction unable to be evicted because of race between checkpoint and "
   "updates without timestamps",
+  "cache: pages skipped by eviction walks because their NUMA node is within its share of the cache",
   "cache: pages walked for eviction",
   "cache: pages written from cache",
   "cache: pages written requiring in-memory restoration",
@@ -1668,6 +1721,7 @@ static const char *const __stats_connection_desc[] = {
   "capacity: time waiting during logging (usecs)",
   "capacity: time waiting during read (usecs)",
   "capacity: time waiting for chunk cache IO bandwidth (usecs)",
+  "checkpoint: checkpoint cleanup history store walks split between threads",
   "checkpoint: checkpoint cleanup successful calls",
   "checkpoint: checkpoint has acquired a snapshot for its transaction",
   "checkpoint: checkpoints skipped because database was clean",
@@ -1895,6 +1949,7 @@ static const char *const __stats_connection_desc[] = {
   "log: force log remove time sleeping (usecs)",
   "log: log bytes of payload data",
   "log: log bytes written",
+  "log: log cursor waits for new records",
   "log: log files manually zero-filled",
   "log: log flush operations",
   "log: log force write operations",
@@ -1908,6 +1963,7 @@ static const char *const __stats_connection_desc[] = {
   "log: log server thread advances write LSN",
   "log: log server thread write LSN walk skipped",
   "log: log sync operations",
+  "log: log sync operations covered by a concurrent sync",
   "log: log sync time duration (usecs)",
   "log: log sync_dir operations",
   "log: log sync_dir time duration (usecs)",
@@ -1922,6 +1978,8 @@ static const char *const __stats_connection_desc[] = {
   "log: slot close lost race",
   "log: slot close unbuffered waits",
   "log: slot closures",
+  "log: slot group commit wait time (usecs)",
+  "log: slot group commit waits",
   "log: slot join atomic update races",
   "log: slot join calls atomic updates raced",
   "log: slot join calls did not yield",
@@ -2015,6 +2073,12 @@ static const char *const __stats_connection_desc[] = {
   "reconciliation: VLCS pages explicitly reconciled as empty",
   "reconciliation: approximate byte size of timestamps in pages written",
   "reconciliation: approximate byte size of transaction IDs in pages written",
+  "reconciliation: arena allocations",
+  "reconciliation: arena chunks allocated",
+  "reconciliation: blocks compressed by a compression worker thread",
+  "reconciliation: blocks compressed by a compression worker thread but not used",
+  "reconciliation: blocks queued for a compression worker thread but compressed by the reconciling "
+  "thread",
   "reconciliation: fast-path pages deleted",
   "reconciliation: leaf-page overflow keys",
   "reconciliation: maximum milliseconds spent in a reconciliation call",
@@ -2043,6 +2107,7 @@ static const char *const __stats_connection_desc[] = {
   "reconciliation: pages written including at least one stop durable timestamp",
   "reconciliation: pages written including at least one stop timestamp",
   "reconciliation: pages written including at least one stop transaction ID",
+  "reconciliation: records discarded because their time-to-live expired",
   "reconciliation: records written including a prepare state",
   "reconciliation: records written including a start durable timestamp",
   "reconciliation: records written including a start timestamp",
@@ -2257,9 +2322,11 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->block_cache_blocks_removed = 0;
     stats->block_cache_blocks_removed_blocked = 0;
     stats->block_cache_blocks = 0;
+    stats->block_cache_blocks_insert_evict = 0;
     stats->block_cache_blocks_insert_read = 0;
     stats->block_cache_blocks_insert_write = 0;
     stats->block_cache_bytes = 0;
+    stats->block_cache_bytes_insert_evict = 0;
     stats->block_cache_bytes_insert_read = 0;
     stats->block_cache_bytes_insert_write = 0;
     stats->disagg_block_hs_byte_read = 0;
@@ -2293,6 +2360,9 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->block_remap_file_write = 0;
     stats->eviction_interupted_by_app = 0;
     stats->eviction_app_time = 0;
+    stats->eviction_app_handoff_wait = 0;
+    stats->eviction_app_handoff_timed_out = 0;
+    stats->eviction_app_handoff_admitted = 0;
     stats->cache_eviction_app_threads_fill_ratio_lt_25 = 0;
     stats->cache_eviction_app_threads_fill_ratio_25_50 = 0;
     stats->cache_eviction_app_threads_fill_ratio_50_75 = 0;
@@ -2320,6 +2390,8 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->eviction_get_ref_empty2 = 0;
     /* not clearing eviction_aggressive_set */
     /* not clearing eviction_empty_score */
+    stats->eviction_frequency_age = 0;
+    stats->eviction_frequency_ranked = 0;
     stats->cache_eviction_blocked_no_ts_checkpoint_race_1 = 0;
     stats->cache_eviction_blocked_no_ts_checkpoint_race_2 = 0;
     stats->cache_eviction_blocked_no_ts_checkpoint_race_3 = 0;
@@ -2327,6 +2399,10 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->cache_eviction_blocked_remove_hs_race_with_checkpoint = 0;
     stats->cache_eviction_blocked_no_progress = 0;
     stats->eviction_walk_passes = 0;
+    stats->eviction_predict_early_start = 0;
+    stats->eviction_predict_horizon_extended = 0;
+    /* not clearing eviction_predict_horizon */
+    stats->eviction_predict_checkpoint = 0;
     stats->eviction_queue_empty = 0;
     stats->eviction_queue_not_empty = 0;
     stats->eviction_server_skip_dirty_pages_during_checkpoint = 0;
@@ -2337,14 +2413,17 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->eviction_server_skip_unwanted_pages = 0;
     stats->eviction_server_skip_unwanted_tree = 0;
     stats->eviction_server_skip_trees_too_many_active_walks = 0;
+    stats->eviction_server_skip_trees_below_cache_quota = 0;
     stats->eviction_server_skip_checkpointing_trees = 0;
     stats->eviction_server_skip_trees_stick_in_cache = 0;
     stats->eviction_server_skip_trees_eviction_disabled = 0;
     stats->eviction_server_skip_trees_not_useful_before = 0;
+    stats->eviction_server_skip_trees_cache_quota_over = 0;
     stats->eviction_server_slept = 0;
     stats->eviction_slow = 0;
     stats->eviction_walk_leaf_notfound = 0;
     /* not clearing eviction_state */
+    stats->eviction_trace_records = 0;
     stats->eviction_walk_sleeps = 0;
     stats->npos_evict_walk_max = 0;
     stats->eviction_restored_pos = 0;
@@ -2369,6 +2448,7 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->eviction_walk_saved_pos = 0;
     /* not clearing eviction_active_workers */
     /* not clearing eviction_stable_state_workers */
+    stats->eviction_predict_worker_start = 0;
     /* not clearing eviction_walks_active */
     stats->eviction_walks_started = 0;
     stats->eviction_force_no_retry = 0;
@@ -2385,6 +2465,7 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->cache_hazard_checks = 0;
     stats->cache_hazard_walks = 0;
     stats->cache_hazard_max = 0;
+    stats->cache_hs_filter_build = 0;
     stats->cache_hs_insert = 0;
     stats->cache_hs_insert_restart = 0;
     /* not clearing cache_hs_ondisk_max */
@@ -2393,9 +2474,11 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->cache_hs_read_miss = 0;
     stats->cache_hs_read_squash = 0;
     stats->cache_hs_order_lose_durable_timestamp = 0;
+    stats->cache_hs_filter_skip = 0;
     stats->cache_hs_key_truncate_rts_unstable = 0;
     stats->cache_hs_key_truncate_rts = 0;
     stats->cache_hs_btree_truncate = 0;
+    stats->cache_hs_btree_truncate_dropped = 0;
     stats->cache_hs_key_truncate = 0;
     stats->cache_hs_order_remove = 0;
     stats->cache_hs_key_truncate_onpage_removal = 0;
@@ -2404,6 +2487,9 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->cache_hs_key_truncate_rts_dryrun = 0;
     stats->cache_hs_order_reinsert = 0;
     stats->cache_hs_write_squash = 0;
+    stats->cache_huge_arena_alloc = 0;
+    stats->cache_huge_arena_fallback = 0;
+    /* not clearing cache_huge_arena_bytes */
     stats->cache_inmem_splittable = 0;
     stats->cache_inmem_split = 0;
     stats->cache_eviction_blocked_internal_page_split = 0;
@@ -2433,11 +2519,13 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->eviction_app_fail = 0;
     stats->cache_eviction_deepen = 0;
     stats->cache_write_hs = 0;
+    stats->eviction_numa_worker_local = 0;
     /* not clearing eviction_consider_prefetch */
     /* not clearing cache_pages_inuse */
     stats->cache_eviction_dirty_obsolete_tw = 0;
     stats->eviction_pages_in_parallel_with_checkpoint = 0;
     stats->eviction_pages_ordinary_queued = 0;
+    stats->eviction_dirty_index_pages_queued = 0;
     stats->eviction_pages_queued_post_lru = 0;
     stats->eviction_pages_queued_urgent = 0;
     stats->eviction_pages_queued_oldest = 0;
@@ -2451,10 +2539,12 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->cache_pages_prefetch = 0;
     stats->cache_eviction_pages_seen = 0;
     stats->eviction_pages_already_queued = 0;
+    stats->eviction_dirty_index_pages_seen = 0;
     stats->eviction_fail = 0;
     stats->eviction_fail_active_children_on_an_internal_page = 0;
     stats->eviction_fail_in_reconciliation = 0;
     stats->eviction_fail_checkpoint_no_ts = 0;
+    stats->eviction_numa_walk_skip = 0;
     stats->eviction_walk = 0;
     stats->cache_write = 0;
     stats->cache_write_restore = 0;
@@ -2492,6 +2582,7 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->capacity_time_log = 0;
     stats->capacity_time_read = 0;
     stats->capacity_time_chunkcache = 0;
+    stats->checkpoint_cleanup_hs_parallel = 0;
     stats->checkpoint_cleanup_success = 0;
     stats->checkpoint_snapshot_acquired = 0;
     stats->checkpoint_skipped = 0;
@@ -2717,6 +2808,7 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->log_force_remove_sleep = 0;
     stats->log_bytes_payload = 0;
     stats->log_bytes_written = 0;
+    stats->log_cursor_tail_wait = 0;
     stats->log_zero_fills = 0;
     stats->log_flush = 0;
     stats->log_force_write = 0;
@@ -2730,6 +2822,7 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->log_write_lsn = 0;
     stats->log_write_lsn_skip = 0;
     stats->log_sync = 0;
+    stats->log_sync_covered = 0;
     /* not clearing log_sync_duration */
     stats->log_sync_dir = 0;
     /* not clearing log_sync_dir_duration */
@@ -2744,6 +2837,8 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->log_slot_close_race = 0;
     stats->log_slot_close_unbuf = 0;
     stats->log_slot_closes = 0;
+    /* not clearing log_slot_group_commit_wait_duration */
+    stats->log_slot_group_commit_wait = 0;
     stats->log_slot_races = 0;
     stats->log_slot_yield_race = 0;
     stats->log_slot_immediate = 0;
@@ -2837,6 +2932,11 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->rec_vlcs_emptied_pages = 0;
     stats->rec_time_window_bytes_ts = 0;
     stats->rec_time_window_bytes_txn = 0;
+    stats->rec_arena_alloc = 0;
+    stats->rec_arena_chunk = 0;
+    stats->rec_compress_parallel = 0;
+    stats->rec_compress_parallel_discarded = 0;
+    stats->rec_compress_parallel_sync = 0;
     stats->rec_page_delete_fast = 0;
     stats->rec_overflow_key_leaf = 0;
     /* not clearing rec_maximum_milliseconds */
@@ -2863,6 +2963,7 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->rec_time_window_pages_durable_stop_ts = 0;
     stats->rec_time_window_pages_stop_ts = 0;
     stats->rec_time_window_pages_stop_txn = 0;
+    stats->rec_ttl_expired = 0;
     stats->rec_time_window_prepared = 0;
     stats->rec_time_window_durable_start_ts = 0;
     stats->rec_time_window_start_ts = 0;
@@ -3053,9 +3154,11 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->block_cache_blocks_removed_blocked +=
       WT_STAT_CONN_READ(from, block_cache_blocks_removed_blocked);
     to->block_cache_blocks += WT_STAT_CONN_READ(from, block_cache_blocks);
+    to->block_cache_blocks_insert_evict += WT_STAT_CONN_READ(from, block_cache_blocks_insert_evict);
     to->block_cache_blocks_insert_read += WT_STAT_CONN_READ(from, block_cache_blocks_insert_read);
     to->block_cache_blocks_insert_write += WT_STAT_CONN_READ(from, block_cache_blocks_insert_write);
     to->block_cache_bytes += WT_STAT_CONN_READ(from, block_cache_bytes);
+    to->block_cache_bytes_insert_evict += WT_STAT_CONN_READ(from, block_cache_bytes_insert_evict);
     to->block_cache_bytes_insert_read += WT_STAT_CONN_READ(from, block_cache_bytes_insert_read);
     to->block_cache_bytes_insert_write += WT_STAT_CONN_READ(from, block_cache_bytes_insert_write);
     to->disagg_block_hs_byte_read += WT_STAT_CONN_READ(from, disagg_block_hs_byte_read);
@@ -3089,6 +3192,9 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->block_remap_file_write += WT_STAT_CONN_READ(from, block_remap_file_write);
     to->eviction_interupted_by_app += WT_STAT_CONN_READ(from, eviction_interupted_by_app);
     to->eviction_app_time += WT_STAT_CONN_READ(from, eviction_app_time);
+    to->eviction_app_handoff_wait += WT_STAT_CONN_READ(from, eviction_app_handoff_wait);
+    to->eviction_app_handoff_timed_out += WT_STAT_CONN_READ(from, eviction_app_handoff_timed_out);
+    to->eviction_app_handoff_admitted += WT_STAT_CONN_READ(from, eviction_app_handoff_admitted);
     to->cache_eviction_app_threads_fill_ratio_lt_25 +=
       WT_STAT_CONN_READ(from, cache_eviction_app_threads_fill_ratio_lt_25);
     to->cache_eviction_app_threads_fill_ratio_25_50 +=
@@ -3122,6 +3228,8 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->eviction_get_ref_empty2 += WT_STAT_CONN_READ(from, eviction_get_ref_empty2);
     to->eviction_aggressive_set += WT_STAT_CONN_READ(from, eviction_aggressive_set);
     to->eviction_empty_score += WT_STAT_CONN_READ(from, eviction_empty_score);
+    to->eviction_frequency_age += WT_STAT_CONN_READ(from, eviction_frequency_age);
+    to->eviction_frequency_ranked += WT_STAT_CONN_READ(from, eviction_frequency_ranked);
     to->cache_eviction_blocked_no_ts_checkpoint_race_1 +=
       WT_STAT_CONN_READ(from, cache_eviction_blocked_no_ts_checkpoint_race_1);
     to->cache_eviction_blocked_no_ts_checkpoint_race_2 +=
@@ -3135,6 +3243,11 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->cache_eviction_blocked_no_progress +=
       WT_STAT_CONN_READ(from, cache_eviction_blocked_no_progress);
     to->eviction_walk_passes += WT_STAT_CONN_READ(from, eviction_walk_passes);
+    to->eviction_predict_early_start += WT_STAT_CONN_READ(from, eviction_predict_early_start);
+    to->eviction_predict_horizon_extended +=
+      WT_STAT_CONN_READ(from, eviction_predict_horizon_extended);
+    to->eviction_predict_horizon += WT_STAT_CONN_READ(from, eviction_predict_horizon);
+    to->eviction_predict_checkpoint += WT_STAT_CONN_READ(from, eviction_predict_checkpoint);
     to->eviction_queue_empty += WT_STAT_CONN_READ(from, eviction_queue_empty);
     to->eviction_queue_not_empty += WT_STAT_CONN_READ(from, eviction_queue_not_empty);
     to->eviction_server_skip_dirty_pages_during_checkpoint +=
@@ -3153,6 +3266,8 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
       WT_STAT_CONN_READ(from, eviction_server_skip_unwanted_tree);
     to->eviction_server_skip_trees_too_many_active_walks +=
       WT_STAT_CONN_READ(from, eviction_server_skip_trees_too_many_active_walks);
+    to->eviction_server_skip_trees_below_cache_quota +=
+      WT_STAT_CONN_READ(from, eviction_server_skip_trees_below_cache_quota);
     to->eviction_server_skip_checkpointing_trees +=
       WT_STAT_CONN_READ(from, eviction_server_skip_checkpointing_trees);
     to->eviction_server_skip_trees_stick_in_cache +=
@@ -3161,10 +3276,13 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
       WT_STAT_CONN_READ(from, eviction_server_skip_trees_eviction_disabled);
     to->eviction_server_skip_trees_not_useful_before +=
       WT_STAT_CONN_READ(from, eviction_server_skip_trees_not_useful_before);
+    to->eviction_server_skip_trees_cache_quota_over +=
+      WT_STAT_CONN_READ(from, eviction_server_skip_trees_cache_quota_over);
     to->eviction_server_slept += WT_STAT_CONN_READ(from, eviction_server_slept);
     to->eviction_slow += WT_STAT_CONN_READ(from, eviction_slow);
     to->eviction_walk_leaf_notfound += WT_STAT_CONN_READ(from, eviction_walk_leaf_notfound);
     to->eviction_state += WT_STAT_CONN_READ(from, eviction_state);
+    to->eviction_trace_records += WT_STAT_CONN_READ(from, eviction_trace_records);
     to->eviction_walk_sleeps += WT_STAT_CONN_READ(from, eviction_walk_sleeps);
     if ((v = WT_STAT_CONN_READ(from, npos_evict_walk_max)) > to->npos_evict_walk_max)
         to->npos_evict_walk_max = v;
@@ -3196,6 +3314,7 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->eviction_walk_saved_pos += WT_STAT_CONN_READ(from, eviction_walk_saved_pos);
     to->eviction_active_workers += WT_STAT_CONN_READ(from, eviction_active_workers);
     to->eviction_stable_state_workers += WT_STAT_CONN_READ(from, eviction_stable_state_workers);
+    to->eviction_predict_worker_start += WT_STAT_CONN_READ(from, eviction_predict_worker_start);
     to->eviction_walks_active += WT_STAT_CONN_READ(from, eviction_walks_active);
     to->eviction_walks_started += WT_STAT_CONN_READ(from, eviction_walks_started);
     to->eviction_force_no_retry += WT_STAT_CONN_READ(from, eviction_force_no_retry);
@@ -3213,6 +3332,7 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->cache_hazard_walks += WT_STAT_CONN_READ(from, cache_hazard_walks);
     if ((v = WT_STAT_CONN_READ(from, cache_hazard_max)) > to->cache_hazard_max)
         to->cache_hazard_max = v;
+    to->cache_hs_filter_build += WT_STAT_CONN_READ(from, cache_hs_filter_build);
     to->cache_hs_insert += WT_STAT_CONN_READ(from, cache_hs_insert);
     to->cache_hs_insert_restart += WT_STAT_CONN_READ(from, cache_hs_insert_restart);
     to->cache_hs_ondisk_max += WT_STAT_CONN_READ(from, cache_hs_ondisk_max);
@@ -3222,10 +3342,12 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->cache_hs_read_squash += WT_STAT_CONN_READ(from, cache_hs_read_squash);
     to->cache_hs_order_lose_durable_timestamp +=
       WT_STAT_CONN_READ(from, cache_hs_order_lose_durable_timestamp);
+    to->cache_hs_filter_skip += WT_STAT_CONN_READ(from, cache_hs_filter_skip);
     to->cache_hs_key_truncate_rts_unstable +=
       WT_STAT_CONN_READ(from, cache_hs_key_truncate_rts_unstable);
     to->cache_hs_key_truncate_rts += WT_STAT_CONN_READ(from, cache_hs_key_truncate_rts);
     to->cache_hs_btree_truncate += WT_STAT_CONN_READ(from, cache_hs_btree_truncate);
+    to->cache_hs_btree_truncate_dropped += WT_STAT_CONN_READ(from, cache_hs_btree_truncate_dropped);
     to->cache_hs_key_truncate += WT_STAT_CONN_READ(from, cache_hs_key_truncate);
     to->cache_hs_order_remove += WT_STAT_CONN_READ(from, cache_hs_order_remove);
     to->cache_hs_key_truncate_onpage_removal +=
@@ -3237,6 +3359,9 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
       WT_STAT_CONN_READ(from, cache_hs_key_truncate_rts_dryrun);
     to->cache_hs_order_reinsert += WT_STAT_CONN_READ(from, cache_hs_order_reinsert);
     to->cache_hs_write_squash += WT_STAT_CONN_READ(from, cache_hs_write_squash);
+    to->cache_huge_arena_alloc += WT_STAT_CONN_READ(from, cache_huge_arena_alloc);
+    to->cache_huge_arena_fallback += WT_STAT_CONN_READ(from, cache_huge_arena_fallback);
+    to->cache_huge_arena_bytes += WT_STAT_CONN_READ(from, cache_huge_arena_bytes);
     to->cache_inmem_splittable += WT_STAT_CONN_READ(from, cache_inmem_splittable);
     to->cache_inmem_split += WT_STAT_CONN_READ(from, cache_inmem_split);
     to->cache_eviction_blocked_internal_page_split +=
@@ -3274,6 +3399,7 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->eviction_app_fail += WT_STAT_CONN_READ(from, eviction_app_fail);
     to->cache_eviction_deepen += WT_STAT_CONN_READ(from, cache_eviction_deepen);
     to->cache_write_hs += WT_STAT_CONN_READ(from, cache_write_hs);
+    to->eviction_numa_worker_local += WT_STAT_CONN_READ(from, eviction_numa_worker_local);
     to->eviction_consider_prefetch += WT_STAT_CONN_READ(from, eviction_consider_prefetch);
     to->cache_pages_inuse += WT_STAT_CONN_READ(from, cache_pages_inuse);
     to->cache_eviction_dirty_obsolete_tw +=
@@ -3281,6 +3407,8 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->eviction_pages_in_parallel_with_checkpoint +=
       WT_STAT_CONN_READ(from, eviction_pages_in_parallel_with_checkpoint);
     to->eviction_pages_ordinary_queued += WT_STAT_CONN_READ(from, eviction_pages_ordinary_queued);
+    to->eviction_dirty_index_pages_queued +=
+      WT_STAT_CONN_READ(from, eviction_dirty_index_pages_queued);
     to->eviction_pages_queued_post_lru += WT_STAT_CONN_READ(from, eviction_pages_queued_post_lru);
     to->eviction_pages_queued_urgent += WT_STAT_CONN_READ(from, eviction_pages_queued_urgent);
     to->eviction_pages_queued_oldest += WT_STAT_CONN_READ(from, eviction_pages_queued_oldest);
@@ -3295,11 +3423,13 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->cache_pages_prefetch += WT_STAT_CONN_READ(from, cache_pages_prefetch);
     to->cache_eviction_pages_seen += WT_STAT_CONN_READ(from, cache_eviction_pages_seen);
     to->eviction_pages_already_queued += WT_STAT_CONN_READ(from, eviction_pages_already_queued);
+    to->eviction_dirty_index_pages_seen += WT_STAT_CONN_READ(from, eviction_dirty_index_pages_seen);
     to->eviction_fail += WT_STAT_CONN_READ(from, eviction_fail);
     to->eviction_fail_active_children_on_an_internal_page +=
       WT_STAT_CONN_READ(from, eviction_fail_active_children_on_an_internal_page);
     to->eviction_fail_in_reconciliation += WT_STAT_CONN_READ(from, eviction_fail_in_reconciliation);
     to->eviction_fail_checkpoint_no_ts += WT_STAT_CONN_READ(from, eviction_fail_checkpoint_no_ts);
+    to->eviction_numa_walk_skip += WT_STAT_CONN_READ(from, eviction_numa_walk_skip);
     to->eviction_walk += WT_STAT_CONN_READ(from, eviction_walk);
     to->cache_write += WT_STAT_CONN_READ(from, cache_write);
     to->cache_write_restore += WT_STAT_CONN_READ(from, cache_write_restore);
@@ -3343,6 +3473,7 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->capacity_time_log += WT_STAT_CONN_READ(from, capacity_time_log);
     to->capacity_time_read += WT_STAT_CONN_READ(from, capacity_time_read);
     to->capacity_time_chunkcache += WT_STAT_CONN_READ(from, capacity_time_chunkcache);
+    to->checkpoint_cleanup_hs_parallel += WT_STAT_CONN_READ(from, checkpoint_cleanup_hs_parallel);
     to->checkpoint_cleanup_success += WT_STAT_CONN_READ(from, checkpoint_cleanup_success);
     to->checkpoint_snapshot_acquired += WT_STAT_CONN_READ(from, checkpoint_snapshot_acquired);
     to->checkpoint_skipped += WT_STAT_CONN_READ(from, checkpoint_skipped);
@@ -3601,6 +3732,7 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->log_force_remove_sleep += WT_STAT_CONN_READ(from, log_force_remove_sleep);
     to->log_bytes_payload += WT_STAT_CONN_READ(from, log_bytes_payload);
     to->log_bytes_written += WT_STAT_CONN_READ(from, log_bytes_written);
+    to->log_cursor_tail_wait += WT_STAT_CONN_READ(from, log_cursor_tail_wait);
     to->log_zero_fills += WT_STAT_CONN_READ(from, log_zero_fills);
     to->log_flush += WT_STAT_CONN_READ(from, log_flush);
     to->log_force_write += WT_STAT_CONN_READ(from, log_force_write);
@@ -3614,6 +3746,7 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->log_write_lsn += WT_STAT_CONN_READ(from, log_write_lsn);
     to->log_write_lsn_skip += WT_STAT_CONN_READ(from, log_write_lsn_skip);
     to->log_sync += WT_STAT_CONN_READ(from, log_sync);
+    to->log_sync_covered += WT_STAT_CONN_READ(from, log_sync_covered);
     to->log_sync_duration += WT_STAT_CONN_READ(from, log_sync_duration);
     to->log_sync_dir += WT_STAT_CONN_READ(from, log_sync_dir);
     to->log_sync_dir_duration += WT_STAT_CONN_READ(from, log_sync_dir_duration);
@@ -3628,6 +3761,9 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->log_slot_close_race += WT_STAT_CONN_READ(from, log_slot_close_race);
     to->log_slot_close_unbuf += WT_STAT_CONN_READ(from, log_slot_close_unbuf);
     to->log_slot_closes += WT_STAT_CONN_READ(from, log_slot_closes);
+    to->log_slot_group_commit_wait_duration +=
+      WT_STAT_CONN_READ(from, log_slot_group_commit_wait_duration);
+    to->log_slot_group_commit_wait += WT_STAT_CONN_READ(from, log_slot_group_commit_wait);
     to->log_slot_races += WT_STAT_CONN_READ(from, log_slot_races);
     to->log_slot_yield_race += WT_STAT_CONN_READ(from, log_slot_yield_race);
     to->log_slot_immediate += WT_STAT_CONN_READ(from, log_slot_immediate);
@@ -3753,6 +3889,11 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->rec_vlcs_emptied_pages += WT_STAT_CONN_READ(from, rec_vlcs_emptied_pages);
     to->rec_time_window_bytes_ts += WT_STAT_CONN_READ(from, rec_time_window_bytes_ts);
     to->rec_time_window_bytes_txn += WT_STAT_CONN_READ(from, rec_time_window_bytes_txn);
+    to->rec_arena_alloc += WT_STAT_CONN_READ(from, rec_arena_alloc);
+    to->rec_arena_chunk += WT_STAT_CONN_READ(from, rec_arena_chunk);
+    to->rec_compress_parallel += WT_STAT_CONN_READ(from, rec_compress_parallel);
+    to->rec_compress_parallel_discarded += WT_STAT_CONN_READ(from, rec_compress_parallel_discarded);
+    to->rec_compress_parallel_sync += WT_STAT_CONN_READ(from, rec_compress_parallel_sync);
     to->rec_page_delete_fast += WT_STAT_CONN_READ(from, rec_page_delete_fast);
     to->rec_overflow_key_leaf += WT_STAT_CONN_READ(from, rec_overflow_key_leaf);
     to->rec_maximum_milliseconds += WT_STAT_CONN_READ(from, rec_maximum_milliseconds);
@@ -3785,6 +3926,7 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
       WT_STAT_CONN_READ(from, rec_time_window_pages_durable_stop_ts);
     to->rec_time_window_pages_stop_ts += WT_STAT_CONN_READ(from, rec_time_window_pages_stop_ts);
     to->rec_time_window_pages_stop_txn += WT_STAT_CONN_READ(from, rec_time_window_pages_stop_txn);
+    to->rec_ttl_expired += WT_STAT_CONN_READ(from, rec_ttl_expired);
     to->rec_time_window_prepared += WT_STAT_CONN_READ(from, rec_time_window_prepared);
     to->rec_time_window_durable_start_ts +=
       WT_STAT_CONN_READ(from, rec_time_window_durable_start_ts);
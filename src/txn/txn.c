@@ -1634,6 +1634,7 @@ __wt_txn_commit(WT_SESSION_IMPL *session, const char *cfg[])
     WT_CONNECTION_IMPL *conn;
     WT_CURSOR *cursor;
     WT_DECL_RET;
+    WT_LSN commit_lsn;
     WT_REF_STATE previous_state;
     WT_TXN *txn;
     WT_TXN_GLOBAL *txn_global;
@@ -1644,7 +1645,7 @@ __wt_txn_commit(WT_SESSION_IMPL *session, const char *cfg[])
     uint32_t prepare_count;
 #endif
     u_int i;
-    bool cannot_fail, locked, prepare, readonly, update_durable_ts;
+    bool bg_commit, cannot_fail, locked, logged, prepare, readonly, update_durable_ts;
 
     conn = S2C(session);
     cache = conn->cache;
@@ -1656,7 +1657,8 @@ __wt_txn_commit(WT_SESSION_IMPL *session, const char *cfg[])
 #endif
     prepare = F_ISSET(txn, WT_TXN_PREPARE);
     readonly = txn->mod_count == 0;
-    cannot_fail = locked = false;
+    bg_commit = cannot_fail = locked = logged = false;
+    WT_INIT_LSN(&commit_lsn);
 
     /* Permit the commit if the transaction failed, but was read-only. */
     WT_ASSERT(session, F_ISSET(txn, WT_TXN_RUNNING));
@@ -1711,6 +1713,13 @@ __wt_txn_commit(WT_SESSION_IMPL *session, const char *cfg[])
     if (prepare)
         __wt_qsort(txn->mod, txn->mod_count, sizeof(WT_TXN_OP), __txn_mod_compare);
 
+    /*
+     * A background commit doesn't wait for its log records to be synced, its session is notified
+     * when they are.
+     */
+    WT_ERR(__wt_config_gets_def(session, cfg, "sync", 0, &cval));
+    bg_commit = WT_CONFIG_LIT_MATCH("background", cval);
+
     /* If we are logging, write a commit log record. */
     if (txn->logrec != NULL) {
         /* Assert environment and tree are logging compatible, the fast-check is short-hand. */
@@ -1719,11 +1728,8 @@ __wt_txn_commit(WT_SESSION_IMPL *session, const char *cfg[])
 
         /*
          * The default sync setting is inherited from the connection, but can be overridden by an
-         * explicit "sync" setting for this transaction.
-         */
-        WT_ERR(__wt_config_gets_def(session, cfg, "sync", 0, &cval));
-
-        /*
+         * explicit "sync" setting for this transaction, already read into the configuration item.
+         *
          * If the user chose the default setting, check whether sync is enabled for this transaction
          * (either inherited or via begin_transaction). If sync is disabled, clear the field to
          * avoid the log write being flushed.
@@ -1742,7 +1748,7 @@ __wt_txn_commit(WT_SESSION_IMPL *session, const char *cfg[])
              */
             if (F_ISSET(txn, WT_TXN_SYNC_SET))
                 WT_ERR_MSG(session, EINVAL, "sync already set during begin_transaction");
-            if (WT_CONFIG_LIT_MATCH("off", cval))
+            if (WT_CONFIG_LIT_MATCH("off", cval) || bg_commit)
                 txn->txn_logsync = 0;
             /*
              * We don't need to check for "on" here because that is the default to inherit from the
@@ -1757,7 +1763,8 @@ __wt_txn_commit(WT_SESSION_IMPL *session, const char *cfg[])
          */
         __wt_readlock(session, &txn_global->visibility_rwlock);
         locked = true;
-        WT_ERR(__wti_txn_log_commit(session));
+        WT_ERR(__wti_txn_log_commit(session, &commit_lsn));
+        logged = true;
     }
 
     /* Process updates. */
@@ -1977,6 +1984,10 @@ __wt_txn_commit(WT_SESSION_IMPL *session, const char *cfg[])
         if (save_errors)
             F_SET(session, WT_SESSION_SAVE_ERRORS);
     }
+
+    /* The transaction is visible, track it until it's durable. */
+    if (bg_commit)
+        __wt_log_bg_commit(session, logged ? &commit_lsn : NULL);
     return (0);
 
 err:
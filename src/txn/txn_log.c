@@ -205,13 +205,8 @@ __txn_logrec_init(WT_SESSION_IMPL *session)
     WT_DECL_ITEM(logrec);
     WT_DECL_RET;
     WT_TXN *txn;
-    size_t header_size;
-    uint32_t rectype;
-    const char *fmt;
 
     txn = session->txn;
-    rectype = WT_LOGREC_COMMIT;
-    fmt = WT_UNCHECKED_STRING(Iq);
 
     if (txn->logrec != NULL) {
         WT_ASSERT(session, F_ISSET(txn, WT_TXN_HAS_ID));
@@ -227,12 +222,9 @@ __txn_logrec_init(WT_SESSION_IMPL *session)
     else
         WT_ASSERT(session, txn->id != WT_TXN_NONE);
 
-    WT_RET(__wt_struct_size(session, &header_size, fmt, rectype, txn->id));
-    WT_RET(__wt_logrec_alloc(session, header_size, &logrec));
-
-    WT_ERR(__wt_struct_pack(
-      session, (uint8_t *)logrec->data + logrec->size, header_size, fmt, rectype, txn->id));
-    logrec->size += (uint32_t)header_size;
+    /* Packing the header extends the buffer as needed. */
+    WT_RET(__wt_logrec_alloc(session, 0, &logrec));
+    WT_ERR(__wt_logrec_commit_pack(session, logrec, txn->id));
     txn->logrec = logrec;
 
     if (0) {
@@ -305,7 +297,7 @@ __wt_txn_log_op(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt)
  *     Write the operations of a transaction to the log at commit time.
  */
 int
-__wti_txn_log_commit(WT_SESSION_IMPL *session)
+__wti_txn_log_commit(WT_SESSION_IMPL *session, WT_LSN *lsnp)
 {
     WT_TXN *txn;
 
@@ -317,7 +309,7 @@ __wti_txn_log_commit(WT_SESSION_IMPL *session)
         return (0);
 
     /* Write updates to the log. */
-    return (__wt_log_write(session, txn->logrec, NULL, txn->txn_logsync));
+    return (__wt_log_write(session, txn->logrec, lsnp, txn->txn_logsync));
 }
 
 /*
@@ -791,11 +791,14 @@ __recovery_close_cursors(WT_RECOVERY *r)
 /*
  * __recovery_file_scan_prefix --
  *     Scan the files matching the prefix referenced from the metadata and gather information about
- *     them for recovery.
+ *     them for recovery. If only tracking IDs, the entries aren't files, only include their IDs in
+ *     the largest file ID.
  */
 static int
-__recovery_file_scan_prefix(WT_RECOVERY *r, const char *prefix, const char *ignore_suffix)
+__recovery_file_scan_prefix(
+  WT_RECOVERY *r, const char *prefix, const char *ignore_suffix, bool id_only)
 {
+    WT_CONFIG_ITEM cval;
     WT_CURSOR *c;
     WT_DECL_RET;
     int cmp;
@@ -821,7 +824,11 @@ __recovery_file_scan_prefix(WT_RECOVERY *r, const char *prefix, const char *igno
         if (ignore_suffix != NULL && WT_SUFFIX_MATCH(uri, ignore_suffix))
             continue;
         WT_RET(c->get_value(c, &config));
-        WT_RET(__recovery_setup_file(r, uri, config));
+        if (id_only) {
+            WT_RET(__wt_config_getones(r->session, config, "id", &cval));
+            r->max_fileid = WT_MAX(r->max_fileid, (u_int)cval.val);
+        } else
+            WT_RET(__recovery_setup_file(r, uri, config));
     }
     WT_RET_NOTFOUND_OK(ret);
     return (0);
@@ -838,8 +845,11 @@ __recovery_file_scan(WT_RECOVERY *r)
       "scanning metadata to find the largest file ID");
 
     /* Scan through all files and tiered entries in the metadata. */
-    WT_RET(__recovery_file_scan_prefix(r, "file:", ".wtobj"));
-    WT_RET(__recovery_file_scan_prefix(r, "tiered:", NULL));
+    WT_RET(__recovery_file_scan_prefix(r, "file:", ".wtobj", false));
+    WT_RET(__recovery_file_scan_prefix(r, "tiered:", NULL, false));
+
+    /* Don't reuse the IDs of dropped files with history store content still to be truncated. */
+    WT_RET(__recovery_file_scan_prefix(r, WT_SYSTEM_HS_DROP_PREFIX, NULL, true));
 
     /*
      * Set the connection level file id tracker, as such upon creation of a new file we'll begin
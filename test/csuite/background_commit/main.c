@@ -0,0 +1,157 @@
+/*-
+ * Public Domain 2014-present MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "test_util.h"
+
+/*
+ * This test verifies commits with sync=background are notified once they are durable, in order,
+ * and that closing a session waits for its outstanding notifications.
+ */
+#define NTHREADS 8
+#define NCOMMITS 2000
+
+static WT_CONNECTION *conn;
+static WT_SESSION *sessions[NTHREADS];
+static uint64_t durable[NTHREADS];
+
+/*
+ * handle_general --
+ *     General event handler.
+ */
+static int
+handle_general(WT_EVENT_HANDLER *handler, WT_CONNECTION *wt_conn, WT_SESSION *session,
+  WT_EVENT_TYPE type, void *arg)
+{
+    uint64_t count;
+    int i;
+
+    (void)handler;
+    (void)wt_conn;
+
+    if (type != WT_EVENT_COMMIT_DURABLE)
+        return (0);
+
+    count = *(uint64_t *)arg;
+    for (i = 0; i < NTHREADS; ++i)
+        if (sessions[i] == session) {
+            /* Notifications for a session arrive in commit order. */
+            testutil_assert(count > durable[i] && count <= NCOMMITS);
+            WT_RELEASE_WRITE(durable[i], count);
+            return (0);
+        }
+    testutil_die(EINVAL, "durable notification for an unknown session");
+    return (0);
+}
+
+static WT_EVENT_HANDLER event_handler = {
+  NULL, NULL,    /* Message handlers */
+  NULL,          /* Progress handler */
+  NULL,          /* Close handler */
+  handle_general /* General handler */
+};
+
+/*
+ * thread_commit --
+ *     Commit transactions without waiting for them to be durable.
+ */
+static WT_THREAD_RET
+thread_commit(void *arg)
+{
+    WT_CURSOR *cursor;
+    WT_SESSION *session;
+    uintptr_t id;
+    int i;
+
+    id = (uintptr_t)arg;
+    session = sessions[id];
+    testutil_check(session->open_cursor(session, "table:test", NULL, NULL, &cursor));
+    for (i = 0; i < NCOMMITS; ++i) {
+        testutil_check(session->begin_transaction(session, NULL));
+        cursor->set_key(cursor, (uint64_t)(id * NCOMMITS + (uintptr_t)i + 1));
+        cursor->set_value(cursor, "value");
+        testutil_check(cursor->insert(cursor));
+        testutil_check(session->commit_transaction(session, "sync=background"));
+    }
+    testutil_check(cursor->close(cursor));
+
+    /* Half the threads wait for their notifications, the others rely on session close. */
+    if (id % 2 == 0)
+        while (__wt_atomic_load64(&durable[id]) != NCOMMITS)
+            __wt_sleep(0, 1000);
+    testutil_check(session->close(session, NULL));
+    testutil_assert(__wt_atomic_load64(&durable[id]) == NCOMMITS);
+    return (WT_THREAD_RET_VALUE);
+}
+
+/*
+ * run --
+ *     Run the commit threads against a connection with the given configuration.
+ */
+static void
+run(const char *home, const char *config)
+{
+    WT_SESSION *session;
+    pthread_t id[NTHREADS];
+    uintptr_t i;
+
+    testutil_recreate_dir(home);
+    testutil_check(wiredtiger_open(home, &event_handler, config, &conn));
+    testutil_check(conn->open_session(conn, NULL, NULL, &session));
+    testutil_check(session->create(session, "table:test", "key_format=Q,value_format=S"));
+
+    memset(durable, 0, sizeof(durable));
+    for (i = 0; i < NTHREADS; ++i)
+        testutil_check(conn->open_session(conn, NULL, NULL, &sessions[i]));
+    for (i = 0; i < NTHREADS; ++i)
+        testutil_check(pthread_create(&id[i], NULL, thread_commit, (void *)i));
+    for (i = 0; i < NTHREADS; ++i)
+        testutil_check(pthread_join(id[i], NULL));
+
+    testutil_check(session->close(session, NULL));
+    testutil_check(conn->close(conn, NULL));
+}
+
+/*
+ * main --
+ *     The main method.
+ */
+int
+main(int argc, char *argv[])
+{
+    TEST_OPTS *opts, _opts;
+
+    opts = &_opts;
+    memset(opts, 0, sizeof(*opts));
+    testutil_check(testutil_parse_opts(argc, argv, opts));
+
+    run(opts->home, "create,log=(enabled)");
+    /* Without logging, commits are durable at once. */
+    run(opts->home, "create");
+
+    testutil_cleanup(opts);
+    return (EXIT_SUCCESS);
+}
@@ -0,0 +1,267 @@
+/*-
+ * Public Domain 2014-present MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Replay an eviction trace recorded with the eviction=(trace=true) connection configuration against
+ * other replacement policies and cache sizes, and report how often each would have found the pages
+ * the workload accessed in the cache.
+ */
+
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "cache_policy.h"
+#include "trace_reader.h"
+
+/* A page access in the replayed stream. */
+struct reference {
+    page_id id;
+    uint64_t size;
+    uint64_t next_access; /* Position of the page's next access */
+};
+
+static void
+usage(const char *progname)
+{
+    std::cerr << "usage: " << progname << " [-c size[,size...]] [-p policy[,policy...]] trace"
+              << std::endl
+              << "\t-c cache sizes to replay, in bytes with an optional K, M, G or T suffix, or"
+              << std::endl
+              << "\t   as a percentage of the traced cache size (default 100%)" << std::endl
+              << "\t-p policies to replay: lru, clock, lfu, 2q, belady (default all)" << std::endl;
+}
+
+static std::vector<std::string>
+split(const std::string &list)
+{
+    std::vector<std::string> items;
+    std::istringstream stream(list);
+    std::string item;
+
+    while (std::getline(stream, item, ','))
+        if (!item.empty())
+            items.push_back(item);
+    return (items);
+}
+
+/* Convert a cache size to bytes, return 0 if it isn't valid. */
+static uint64_t
+parse_size(const std::string &size, uint64_t traced_size)
+{
+    uint64_t multiplier, value;
+    size_t end;
+
+    try {
+        value = std::stoull(size, &end);
+    } catch (...) {
+        return (0);
+    }
+
+    if (end == size.size())
+        return (value);
+    if (end + 1 != size.size())
+        return (0);
+    switch (size[end]) {
+    case '%':
+        return (traced_size * value / 100);
+    case 'K':
+    case 'k':
+        multiplier = 1ULL << 10;
+        break;
+    case 'M':
+    case 'm':
+        multiplier = 1ULL << 20;
+        break;
+    case 'G':
+    case 'g':
+        multiplier = 1ULL << 30;
+        break;
+    case 'T':
+    case 't':
+        multiplier = 1ULL << 40;
+        break;
+    default:
+        return (0);
+    }
+    return (value * multiplier);
+}
+
+static double
+percent(uint64_t part, uint64_t total)
+{
+    return (total == 0 ? 0 : 100.0 * static_cast<double>(part) / static_cast<double>(total));
+}
+
+static double
+megabytes(uint64_t bytes)
+{
+    return (static_cast<double>(bytes) / (1ULL << 20));
+}
+
+/*
+ * Summarize what the engine did while the trace was recorded, and build the stream of page
+ * accesses to replay. Pages read by pre-fetch weren't requested by the workload, they aren't
+ * replayed.
+ */
+static std::vector<reference>
+summarize(const trace_reader &trace)
+{
+    std::vector<reference> references;
+    std::unordered_map<page_id, uint64_t, page_id_hash> next;
+    uint64_t accesses, app_evicts, evict_fails, evicts, forced, prefetch, queued, reads;
+
+    accesses = app_evicts = evict_fails = evicts = forced = prefetch = queued = reads = 0;
+    for (const auto &record : trace.get_records()) {
+        switch (record.type) {
+        case EVICT_TRACE_ACCESS:
+            ++accesses;
+            break;
+        case EVICT_TRACE_READ:
+            if (record.flags & EVICT_TRACE_PREFETCH) {
+                ++prefetch;
+                continue;
+            }
+            ++reads;
+            break;
+        case EVICT_TRACE_QUEUE:
+            ++queued;
+            continue;
+        case EVICT_TRACE_EVICT:
+            ++evicts;
+            if (record.flags & EVICT_TRACE_APP)
+                ++app_evicts;
+            if (record.flags & EVICT_TRACE_FORCED)
+                ++forced;
+            continue;
+        case EVICT_TRACE_EVICT_FAIL:
+            ++evict_fails;
+            continue;
+        default:
+            continue;
+        }
+        references.push_back(
+          {{record.btree_id, record.ref}, record.size, std::numeric_limits<uint64_t>::max()});
+    }
+
+    /* Find each page's next access, walking the stream backwards. */
+    for (uint64_t i = references.size(); i-- > 0;) {
+        auto it = next.find(references[i].id);
+        if (it != next.end()) {
+            references[i].next_access = it->second;
+            it->second = i;
+        } else
+            next.emplace(references[i].id, i);
+    }
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "traced cache size: " << megabytes(trace.get_header().cache_size) << "MB"
+              << std::endl;
+    std::cout << "records: " << trace.get_records().size() << std::endl;
+    std::cout << "distinct pages accessed: " << next.size() << std::endl;
+    std::cout << "page accesses in cache: " << accesses << ", reads: " << reads
+              << ", pre-fetch reads: " << prefetch << " (hit ratio "
+              << percent(accesses, accesses + reads) << "%)" << std::endl;
+    std::cout << "pages queued for eviction: " << queued << std::endl;
+    std::cout << "pages evicted: " << evicts << " (by application threads: " << app_evicts
+              << ", forced: " << forced << "), eviction failures: " << evict_fails << std::endl;
+
+    return (references);
+}
+
+int
+main(int argc, char *argv[])
+{
+    trace_reader trace;
+    std::vector<std::string> policies, sizes;
+    std::string trace_file;
+    int i;
+
+    policies = cache_policy::policy_names();
+    sizes = {"100%"};
+    for (i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if ((arg == "-c" || arg == "-p") && i + 1 < argc) {
+            (arg == "-c" ? sizes : policies) = split(argv[++i]);
+            continue;
+        }
+        if (arg[0] == '-' || !trace_file.empty()) {
+            usage(argv[0]);
+            return (EXIT_FAILURE);
+        }
+        trace_file = arg;
+    }
+    if (trace_file.empty()) {
+        usage(argv[0]);
+        return (EXIT_FAILURE);
+    }
+
+    for (const auto &name : policies)
+        if (cache_policy::create(name, 0) == nullptr) {
+            std::cerr << "unknown policy: " << name << std::endl;
+            return (EXIT_FAILURE);
+        }
+
+    if (trace.load(trace_file) != 0)
+        return (EXIT_FAILURE);
+
+    std::vector<reference> references = summarize(trace);
+
+    std::cout << std::endl
+              << std::left << std::setw(8) << "policy" << std::right << std::setw(14)
+              << "cache MB" << std::setw(12) << "hit ratio" << std::setw(12) << "misses"
+              << std::setw(12) << "miss MB" << std::setw(12) << "evictions" << std::endl;
+    for (const auto &size : sizes) {
+        uint64_t cache_size = parse_size(size, trace.get_header().cache_size);
+        if (cache_size == 0) {
+            std::cerr << "invalid cache size: " << size << std::endl;
+            return (EXIT_FAILURE);
+        }
+        for (const auto &name : policies) {
+            std::unique_ptr<cache_policy> policy = cache_policy::create(name, cache_size);
+            for (const auto &ref : references)
+                policy->access(ref.id, ref.size, ref.next_access);
+
+            std::cout << std::left << std::setw(8) << policy->get_name() << std::right
+                      << std::setw(14) << megabytes(cache_size) << std::setw(11)
+                      << percent(policy->get_hits(), policy->get_hits() + policy->get_misses())
+                      << "%" << std::setw(12) << policy->get_misses() << std::setw(12)
+                      << megabytes(policy->get_miss_bytes()) << std::setw(12)
+                      << policy->get_evictions() << std::endl;
+        }
+    }
+
+    return (EXIT_SUCCESS);
+}
@@ -0,0 +1,357 @@
+/*-
+ * Public Domain 2014-present MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "cache_policy.h"
+
+#include <iterator>
+
+cache_policy::cache_policy(uint64_t cache_size) : _cache_size(cache_size) {}
+
+/*
+ * Replay an access to a page of a given size, along with the position in the trace of the page's
+ * next access. Pages are read into the cache when they're missing, then pages are evicted until
+ * the cache's content fits its size again. Pages larger than the cache are never cached.
+ */
+void
+cache_policy::access(const page_id &id, uint64_t size, uint64_t next_access)
+{
+    _next_access = next_access;
+
+    auto it = _resident.find(id);
+    if (it != _resident.end()) {
+        ++_hits;
+        _bytes_inuse = _bytes_inuse - it->second + size;
+        it->second = size;
+        hit(id, size);
+    } else {
+        ++_misses;
+        _miss_bytes += size;
+        if (size > _cache_size)
+            return;
+        _resident.emplace(id, size);
+        _bytes_inuse += size;
+        insert(id, size);
+    }
+
+    while (_bytes_inuse > _cache_size && !_resident.empty()) {
+        auto victim = _resident.find(evict());
+        _bytes_inuse -= victim->second;
+        _resident.erase(victim);
+        ++_evictions;
+    }
+}
+
+uint64_t
+cache_policy::get_cache_size() const
+{
+    return (_cache_size);
+}
+
+uint64_t
+cache_policy::get_hits() const
+{
+    return (_hits);
+}
+
+uint64_t
+cache_policy::get_misses() const
+{
+    return (_misses);
+}
+
+uint64_t
+cache_policy::get_miss_bytes() const
+{
+    return (_miss_bytes);
+}
+
+uint64_t
+cache_policy::get_evictions() const
+{
+    return (_evictions);
+}
+
+uint64_t
+cache_policy::get_cache_bytes_inuse() const
+{
+    return (_bytes_inuse);
+}
+
+uint64_t
+cache_policy::get_next_access() const
+{
+    return (_next_access);
+}
+
+/* The names of the policies, in the order they're reported. */
+const std::vector<std::string> &
+cache_policy::policy_names()
+{
+    static const std::vector<std::string> names = {"lru", "clock", "lfu", "2q", "belady"};
+    return (names);
+}
+
+/* Create a policy by name, return nullptr if the name isn't known. */
+std::unique_ptr<cache_policy>
+cache_policy::create(const std::string &name, uint64_t cache_size)
+{
+    if (name == "lru")
+        return (std::make_unique<lru_policy>(cache_size));
+    if (name == "clock")
+        return (std::make_unique<clock_policy>(cache_size));
+    if (name == "lfu")
+        return (std::make_unique<lfu_policy>(cache_size));
+    if (name == "2q")
+        return (std::make_unique<two_queue_policy>(cache_size));
+    if (name == "belady")
+        return (std::make_unique<belady_policy>(cache_size));
+    return (nullptr);
+}
+
+std::string
+lru_policy::get_name() const
+{
+    return ("lru");
+}
+
+void
+lru_policy::hit(const page_id &id, uint64_t)
+{
+    _list.splice(_list.begin(), _list, _pos[id]);
+}
+
+void
+lru_policy::insert(const page_id &id, uint64_t)
+{
+    _list.push_front(id);
+    _pos[id] = _list.begin();
+}
+
+page_id
+lru_policy::evict()
+{
+    page_id id = _list.back();
+
+    _list.pop_back();
+    _pos.erase(id);
+    return (id);
+}
+
+std::string
+clock_policy::get_name() const
+{
+    return ("clock");
+}
+
+void
+clock_policy::hit(const page_id &id, uint64_t)
+{
+    _referenced[id] = true;
+}
+
+void
+clock_policy::insert(const page_id &id, uint64_t)
+{
+    /* New pages are placed behind the hand, they're the last the hand reaches. */
+    _ring.insert(_hand, id);
+    _referenced[id] = false;
+}
+
+page_id
+clock_policy::evict()
+{
+    for (;;) {
+        if (_hand == _ring.end())
+            _hand = _ring.begin();
+        auto referenced = _referenced.find(*_hand);
+        if (!referenced->second)
+            break;
+        referenced->second = false;
+        ++_hand;
+    }
+
+    page_id id = *_hand;
+    _hand = _ring.erase(_hand);
+    _referenced.erase(id);
+    return (id);
+}
+
+std::string
+lfu_policy::get_name() const
+{
+    return ("lfu");
+}
+
+void
+lfu_policy::age()
+{
+    if (++_accesses < 10 * _rank.size())
+        return;
+
+    _accesses = 0;
+    _ranks.clear();
+    for (auto &r : _rank) {
+        std::get<0>(r.second) /= 2;
+        _ranks.insert(r.second);
+    }
+}
+
+void
+lfu_policy::hit(const page_id &id, uint64_t)
+{
+    auto &r = _rank[id];
+
+    _ranks.erase(r);
+    r = rank(std::get<0>(r) + 1, ++_clock, id);
+    _ranks.insert(r);
+    age();
+}
+
+void
+lfu_policy::insert(const page_id &id, uint64_t)
+{
+    rank r(1, ++_clock, id);
+
+    _rank[id] = r;
+    _ranks.insert(r);
+    age();
+}
+
+page_id
+lfu_policy::evict()
+{
+    page_id id = std::get<2>(*_ranks.begin());
+
+    _ranks.erase(_ranks.begin());
+    _rank.erase(id);
+    return (id);
+}
+
+std::string
+two_queue_policy::get_name() const
+{
+    return ("2q");
+}
+
+void
+two_queue_policy::hit(const page_id &id, uint64_t size)
+{
+    /* Pages in the FIFO queue stay where they are, a page read twice in a scan isn't hot. */
+    auto in = _in_pos.find(id);
+    if (in != _in_pos.end()) {
+        _in_bytes = _in_bytes - in->second.second + size;
+        in->second.second = size;
+        return;
+    }
+    _main.splice(_main.begin(), _main, _main_pos[id]);
+}
+
+void
+two_queue_policy::insert(const page_id &id, uint64_t size)
+{
+    /* Pages remembered from the FIFO queue have been read again, they're hot. */
+    auto ghost = _ghost_pos.find(id);
+    if (ghost != _ghost_pos.end()) {
+        _ghost.erase(ghost->second);
+        _ghost_pos.erase(ghost);
+        _main.push_front(id);
+        _main_pos[id] = _main.begin();
+        return;
+    }
+
+    _in.push_front(id);
+    _in_pos[id] = std::make_pair(_in.begin(), size);
+    _in_bytes += size;
+}
+
+page_id
+two_queue_policy::evict()
+{
+    page_id id;
+
+    if (!_in.empty() && (_main.empty() || _in_bytes > get_cache_size() / 4)) {
+        id = _in.back();
+        _in.pop_back();
+        _in_bytes -= _in_pos[id].second;
+        _in_pos.erase(id);
+
+        /* Remember as many evicted pages as there are pages in the cache. */
+        _ghost.push_front(id);
+        _ghost_pos[id] = _ghost.begin();
+        while (_ghost.size() > _in.size() + _main.size() + 1) {
+            _ghost_pos.erase(_ghost.back());
+            _ghost.pop_back();
+        }
+        return (id);
+    }
+
+    id = _main.back();
+    _main.pop_back();
+    _main_pos.erase(id);
+    return (id);
+}
+
+std::string
+belady_policy::get_name() const
+{
+    return ("belady");
+}
+
+void
+belady_policy::rank(const page_id &id)
+{
+    auto next = _next.find(id);
+
+    if (next != _next.end())
+        _ranks.erase(std::make_pair(next->second, id));
+    _next[id] = get_next_access();
+    _ranks.emplace(get_next_access(), id);
+}
+
+void
+belady_policy::hit(const page_id &id, uint64_t)
+{
+    rank(id);
+}
+
+void
+belady_policy::insert(const page_id &id, uint64_t)
+{
+    rank(id);
+}
+
+page_id
+belady_policy::evict()
+{
+    auto last = std::prev(_ranks.end());
+    page_id id = last->second;
+
+    _ranks.erase(last);
+    _next.erase(id);
+    return (id);
+}
@@ -0,0 +1,211 @@
+/*-
+ * Public Domain 2014-present MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <set>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+/* A page is identified by its tree and the address of its WT_REF. */
+struct page_id {
+    uint32_t btree_id;
+    uint64_t ref;
+
+    bool
+    operator==(const page_id &other) const
+    {
+        return (btree_id == other.btree_id && ref == other.ref);
+    }
+
+    bool
+    operator<(const page_id &other) const
+    {
+        return (std::tie(btree_id, ref) < std::tie(other.btree_id, other.ref));
+    }
+};
+
+struct page_id_hash {
+    size_t
+    operator()(const page_id &id) const
+    {
+        return (std::hash<uint64_t>()(id.ref ^ (static_cast<uint64_t>(id.btree_id) << 48)));
+    }
+};
+
+/*
+ * A cache policy replays page accesses against a cache holding a fixed number of bytes. The base
+ * class tracks the resident pages, their sizes and the results; policies choose the pages to evict.
+ */
+class cache_policy {
+    /* Methods */
+public:
+    explicit cache_policy(uint64_t);
+    virtual ~cache_policy() = default;
+    virtual std::string get_name() const = 0;
+    void access(const page_id &, uint64_t, uint64_t);
+    uint64_t get_cache_size() const;
+    uint64_t get_hits() const;
+    uint64_t get_misses() const;
+    uint64_t get_miss_bytes() const;
+    uint64_t get_evictions() const;
+
+    static std::unique_ptr<cache_policy> create(const std::string &, uint64_t);
+    static const std::vector<std::string> &policy_names();
+
+protected:
+    uint64_t get_cache_bytes_inuse() const;
+    uint64_t get_next_access() const;
+    /* A page in the cache was accessed. */
+    virtual void hit(const page_id &, uint64_t) = 0;
+    /* A page was added to the cache. */
+    virtual void insert(const page_id &, uint64_t) = 0;
+    /* Remove a page from the policy's structures and return it. */
+    virtual page_id evict() = 0;
+
+    /* Member variables */
+private:
+    uint64_t _cache_size;
+    uint64_t _bytes_inuse = 0;
+    uint64_t _next_access = 0;
+    std::unordered_map<page_id, uint64_t, page_id_hash> _resident;
+    uint64_t _hits = 0;
+    uint64_t _misses = 0;
+    uint64_t _miss_bytes = 0;
+    uint64_t _evictions = 0;
+};
+
+/* Least recently used. */
+class lru_policy : public cache_policy {
+public:
+    using cache_policy::cache_policy;
+    std::string get_name() const override;
+
+protected:
+    void hit(const page_id &, uint64_t) override;
+    void insert(const page_id &, uint64_t) override;
+    page_id evict() override;
+
+private:
+    std::list<page_id> _list;
+    std::unordered_map<page_id, std::list<page_id>::iterator, page_id_hash> _pos;
+};
+
+/* Second chance: pages accessed since the clock hand passed them are skipped once. */
+class clock_policy : public cache_policy {
+public:
+    using cache_policy::cache_policy;
+    std::string get_name() const override;
+
+protected:
+    void hit(const page_id &, uint64_t) override;
+    void insert(const page_id &, uint64_t) override;
+    page_id evict() override;
+
+private:
+    std::list<page_id> _ring;
+    std::list<page_id>::iterator _hand = _ring.end();
+    std::unordered_map<page_id, bool, page_id_hash> _referenced;
+};
+
+/*
+ * Least frequently used while resident, least recently used among pages with equal counts. The
+ * counts are halved once there have been ten accesses for each page in the cache, so pages that
+ * are no longer accessed lose their rank.
+ */
+class lfu_policy : public cache_policy {
+public:
+    using cache_policy::cache_policy;
+    std::string get_name() const override;
+
+protected:
+    void hit(const page_id &, uint64_t) override;
+    void insert(const page_id &, uint64_t) override;
+    page_id evict() override;
+
+private:
+    void age();
+
+    using rank = std::tuple<uint64_t, uint64_t, page_id>; /* Count, last access, page */
+    std::set<rank> _ranks;
+    std::unordered_map<page_id, rank, page_id_hash> _rank;
+    uint64_t _clock = 0;
+    uint64_t _accesses = 0; /* Accesses since the counts were halved */
+};
+
+/*
+ * Two queues: pages read once enter a FIFO queue holding a quarter of the cache, pages read again
+ * after leaving it, while still remembered, enter an LRU list. Scans only displace the FIFO queue.
+ */
+class two_queue_policy : public cache_policy {
+public:
+    using cache_policy::cache_policy;
+    std::string get_name() const override;
+
+protected:
+    void hit(const page_id &, uint64_t) override;
+    void insert(const page_id &, uint64_t) override;
+    page_id evict() override;
+
+private:
+    using position = std::list<page_id>::iterator;
+
+    std::list<page_id> _in; /* FIFO queue */
+    std::unordered_map<page_id, std::pair<position, uint64_t>, page_id_hash> _in_pos;
+    uint64_t _in_bytes = 0;
+    std::list<page_id> _main; /* LRU list */
+    std::unordered_map<page_id, position, page_id_hash> _main_pos;
+    std::list<page_id> _ghost; /* Pages evicted from the FIFO queue */
+    std::unordered_map<page_id, position, page_id_hash> _ghost_pos;
+};
+
+/*
+ * Evict the page whose next access is furthest away. With pages of different sizes this isn't
+ * optimal, but it bounds what a policy without knowledge of the future can achieve.
+ */
+class belady_policy : public cache_policy {
+public:
+    using cache_policy::cache_policy;
+    std::string get_name() const override;
+
+protected:
+    void hit(const page_id &, uint64_t) override;
+    void insert(const page_id &, uint64_t) override;
+    page_id evict() override;
+
+private:
+    void rank(const page_id &);
+
+    std::set<std::pair<uint64_t, page_id>> _ranks; /* Next access, page */
+    std::unordered_map<page_id, uint64_t, page_id_hash> _next;
+};
@@ -0,0 +1,75 @@
+/*-
+ * Public Domain 2014-present MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+/*
+ * The eviction trace file format. These are copies of WT_EVICT_TRACE_HEADER and
+ * WT_EVICT_TRACE_RECORD in src/evict/evict.h, keep them in sync.
+ */
+#define EVICT_TRACE_MAGIC 0x57544554 /* "WTET" */
+#define EVICT_TRACE_VERSION 1
+
+struct evict_trace_header {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t record_size;
+    uint32_t tsc_nsec_ratio;
+    uint64_t seconds_epoch;
+    uint64_t cache_size;
+};
+
+/* Record types. */
+#define EVICT_TRACE_ACCESS 1
+#define EVICT_TRACE_READ 2
+#define EVICT_TRACE_QUEUE 3
+#define EVICT_TRACE_EVICT 4
+#define EVICT_TRACE_EVICT_FAIL 5
+
+/* Record flags. */
+#define EVICT_TRACE_APP 0x01u
+#define EVICT_TRACE_DIRTY 0x02u
+#define EVICT_TRACE_FORCED 0x04u
+#define EVICT_TRACE_INTERNAL 0x08u
+#define EVICT_TRACE_PREFETCH 0x10u
+
+struct evict_trace_record {
+    uint64_t timestamp;
+    uint64_t ref;
+    uint64_t read_gen;
+    uint32_t btree_id;
+    uint32_t size;
+    uint8_t type;
+    uint8_t flags;
+    uint8_t padding[6];
+};
+
+static_assert(sizeof(evict_trace_header) == 32, "eviction trace header size changed");
+static_assert(sizeof(evict_trace_record) == 40, "eviction trace record size changed");
@@ -0,0 +1,81 @@
+/*-
+ * Public Domain 2014-present MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "trace_reader.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <fstream>
+#include <iostream>
+
+int
+trace_reader::load(const std::string &file_name)
+{
+    std::ifstream file(file_name, std::ios::binary);
+    evict_trace_record record;
+
+    if (!file) {
+        std::cerr << file_name << ": cannot open the trace" << std::endl;
+        return (ENOENT);
+    }
+
+    if (!file.read(reinterpret_cast<char *>(&_header), sizeof(_header)) ||
+      _header.magic != EVICT_TRACE_MAGIC) {
+        std::cerr << file_name << ": not an eviction trace" << std::endl;
+        return (EINVAL);
+    }
+    if (_header.version != EVICT_TRACE_VERSION || _header.record_size != sizeof(record)) {
+        std::cerr << file_name << ": unsupported trace version " << _header.version << std::endl;
+        return (EINVAL);
+    }
+
+    /* A trace cut short by a crash can end with part of a record, ignore it. */
+    _records.clear();
+    while (file.read(reinterpret_cast<char *>(&record), sizeof(record)))
+        _records.push_back(record);
+
+    /* Records are only ordered within a session's batch, order them by time. */
+    std::stable_sort(_records.begin(), _records.end(),
+      [](const evict_trace_record &a, const evict_trace_record &b) {
+          return (a.timestamp < b.timestamp);
+      });
+
+    return (0);
+}
+
+const evict_trace_header &
+trace_reader::get_header() const
+{
+    return (_header);
+}
+
+const std::vector<evict_trace_record> &
+trace_reader::get_records() const
+{
+    return (_records);
+}
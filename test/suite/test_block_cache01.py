@@ -0,0 +1,86 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+import wiredtiger, wttest
+from wtscenario import make_scenarios
+
+# test_block_cache01.py
+#   Check a block cache populated on eviction: clean pages evicted from the cache are kept in the
+#   block cache as compressed images, and reads of those pages are satisfied from the block cache.
+class test_block_cache01(wttest.WiredTigerTestCase):
+    uri = 'table:test_block_cache01'
+    nrecords = 20000
+
+    compress = [
+        ('none', dict(compress='none')),
+        ('zlib', dict(compress='zlib')),
+    ]
+    scenarios = make_scenarios(compress)
+
+    conn_config = 'cache_size=5MB,statistics=(all),block_cache=(enabled=true,type=dram,' + \
+        'size=100MB,cache_on_evict=true,cache_on_checkpoint=false,cache_on_writes=false)'
+
+    # Load the compression extension, skip the test if missing
+    def conn_extensions(self, extlist):
+        extlist.skip_if_missing = True
+        if self.compress != 'none':
+            extlist.extension('compressors', self.compress)
+
+    def value(self, i):
+        return chr(ord('a') + i % 26) * 500 + str(i)
+
+    def get_stat(self, stat):
+        stat_cursor = self.session.open_cursor('statistics:')
+        val = stat_cursor[stat][2]
+        stat_cursor.close()
+        return val
+
+    def check(self):
+        cursor = self.session.open_cursor(self.uri)
+        for i in range(self.nrecords):
+            self.assertEqual(cursor['key{:010d}'.format(i)], self.value(i))
+        cursor.close()
+
+    def test_block_cache_evict(self):
+        self.session.create(self.uri,
+            'key_format=S,value_format=S,block_compressor={}'.format(self.compress))
+        cursor = self.session.open_cursor(self.uri)
+        for i in range(self.nrecords):
+            cursor['key{:010d}'.format(i)] = self.value(i)
+        cursor.close()
+        self.session.checkpoint()
+
+        # The table is larger than the cache: reading it twice evicts clean pages into the block
+        # cache, and reads them back from it.
+        self.check()
+        self.check()
+        self.assertGreater(self.get_stat(wiredtiger.stat.conn.block_cache_blocks_insert_evict), 0)
+        self.assertGreater(self.get_stat(wiredtiger.stat.conn.block_cache_hits), 0)
+        self.assertEqual(self.get_stat(wiredtiger.stat.conn.block_cache_blocks_insert_read), 0)
+        self.assertEqual(self.get_stat(wiredtiger.stat.conn.block_cache_blocks_insert_write), 0)
@@ -0,0 +1,81 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+from test_cc01 import test_cc_base
+from wiredtiger import stat
+from wtscenario import make_scenarios
+
+# test_cc11.py
+# Test that checkpoint cleanup can split the history store walk between several threads.
+class test_cc11(test_cc_base):
+    threads = [
+        ('single', dict(hs_threads=1)),
+        ('parallel', dict(hs_threads=4)),
+    ]
+    scenarios = make_scenarios(threads)
+
+    def conn_config(self):
+        return f'cache_size=50MB,checkpoint_cleanup=(history_store_threads={self.hs_threads})'
+
+    def test_cc11(self):
+        create_params = 'key_format=i,value_format=S'
+        nrows = 10000
+        uri = "table:cc11"
+
+        # Create and populate a table.
+        self.session.create(uri, create_params)
+
+        old_value = "a" * 500
+        old_ts = 1
+        self.populate(uri, 0, nrows, old_value, old_ts)
+
+        # Pin oldest and stable to timestamp 1.
+        self.conn.set_timestamp(f'oldest_timestamp={self.timestamp_str(old_ts)},stable_timestamp={self.timestamp_str(old_ts)}')
+
+        # Update each record with a newer timestamp, the older values are written to a history
+        # store large enough to have several subtrees below its root.
+        new_value = "b" * 500
+        new_ts = 10
+        self.populate(uri, 0, nrows, new_value, new_ts)
+        self.conn.set_timestamp(f'stable_timestamp={self.timestamp_str(new_ts)}')
+        self.session.checkpoint()
+
+        # Make the history store content obsolete, then trigger checkpoint cleanup and check it
+        # removed pages.
+        self.conn.set_timestamp(f'oldest_timestamp={self.timestamp_str(new_ts)}')
+        self.check_cc_stats()
+
+        # Only the parallel configuration splits the history store walk.
+        parallel = self.get_stat(stat.conn.checkpoint_cleanup_hs_parallel)
+        if self.hs_threads > 1:
+            self.assertGreater(parallel, 0)
+        else:
+            self.assertEqual(parallel, 0)
+
+        # The latest values are unaffected.
+        self.check(new_value, uri, nrows, new_ts)
@@ -0,0 +1,91 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wiredtiger, wttest
+from wtscenario import make_scenarios
+
+# test_compress03.py
+#   Check that blocks compressed by reconciliation compression threads can be read back and that
+#   the compression threads are used when configured.
+class test_compress03(wttest.WiredTigerTestCase):
+    uri = 'table:test_compress03'
+    nrecords = 50000
+
+    threads = [
+        ('none', dict(threads=0)),
+        ('one', dict(threads=1)),
+        ('many', dict(threads=4)),
+    ]
+    compress = [
+        ('snappy', dict(compress='snappy')),
+        ('zlib', dict(compress='zlib')),
+    ]
+    scenarios = make_scenarios(threads, compress)
+
+    def conn_config(self):
+        return 'statistics=(all),compression=(threads={})'.format(self.threads)
+
+    # Load the compression extension, skip the test if missing
+    def conn_extensions(self, extlist):
+        extlist.skip_if_missing = True
+        extlist.extension('compressors', self.compress)
+
+    def value(self, i):
+        return chr(ord('a') + i % 26) * 200
+
+    def get_stat(self, stat):
+        stat_cursor = self.session.open_cursor('statistics:')
+        val = stat_cursor[stat][2]
+        stat_cursor.close()
+        return val
+
+    def test_compress_threads(self):
+        # Use large in-memory pages and small leaf pages so reconciliation writes many blocks.
+        self.session.create(self.uri, 'key_format=S,value_format=S,leaf_page_max=32KB,' +
+            'memory_page_max=10MB,block_compressor={}'.format(self.compress))
+        cursor = self.session.open_cursor(self.uri)
+        for i in range(self.nrecords):
+            cursor['key{:010d}'.format(i)] = self.value(i)
+        cursor.close()
+        self.session.checkpoint()
+
+        parallel = self.get_stat(wiredtiger.stat.conn.rec_compress_parallel)
+        sync = self.get_stat(wiredtiger.stat.conn.rec_compress_parallel_sync)
+        if self.threads == 0:
+            self.assertEqual(parallel, 0)
+            self.assertEqual(sync, 0)
+        else:
+            self.assertGreater(parallel + sync, 0)
+
+        # Read the compressed blocks back from disk.
+        self.reopen_conn()
+        cursor = self.session.open_cursor(self.uri)
+        for i in range(self.nrecords):
+            self.assertEqual(cursor['key{:010d}'.format(i)], self.value(i))
+        cursor.close()
+        self.session.verify(self.uri)
@@ -0,0 +1,101 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import random
+import wiredtiger, wttest
+from wtscenario import make_scenarios
+
+# test_compress04.py
+#   Check adaptive block compression, where reconciliation chooses the compressor for each page and
+#   records the choice in the page header.
+class test_compress04(wttest.WiredTigerTestCase):
+    uri = 'table:test_compress04'
+    nrecords = 20000
+
+    policy = [
+        ('none', dict(policy='none')),
+        ('ratio', dict(policy='ratio')),
+        ('temperature', dict(policy='temperature')),
+    ]
+    scenarios = make_scenarios(policy)
+
+    conn_config = 'statistics=(all)'
+
+    # Load the compression extensions, skip the test if missing
+    def conn_extensions(self, extlist):
+        extlist.skip_if_missing = True
+        extlist.extension('compressors', 'snappy')
+        extlist.extension('compressors', 'zlib')
+
+    # Alternate between ranges of highly compressible and random values.
+    def value(self, i):
+        if (i // 2000) % 2 == 0:
+            return chr(ord('a') + i % 26) * 200
+        r = random.Random(i)
+        return ''.join(chr(r.randint(33, 122)) for _ in range(200))
+
+    def get_stat(self, stat):
+        stat_cursor = self.session.open_cursor('statistics:' + self.uri)
+        val = stat_cursor[stat][2]
+        stat_cursor.close()
+        return val
+
+    def test_compress_adaptive(self):
+        self.session.create(self.uri, 'key_format=S,value_format=S,leaf_page_max=16KB,' +
+            'block_compressor=snappy,' +
+            'block_compressor_adaptive=(compressors=[zlib],policy={})'.format(self.policy))
+        cursor = self.session.open_cursor(self.uri)
+        for i in range(self.nrecords):
+            cursor['key{:010d}'.format(i)] = self.value(i)
+        cursor.close()
+
+        self.session.checkpoint()
+        sampled = self.get_stat(wiredtiger.stat.dsrc.compress_adaptive_sample)
+        if self.policy == 'ratio':
+            self.assertGreater(sampled, 0)
+        else:
+            # Pages written by checkpoint are hot, and only sampled by the ratio policy.
+            self.assertEqual(sampled, 0)
+
+        # Read the pages back, each decompressed with the compressor in its page header.
+        self.reopen_conn()
+        cursor = self.session.open_cursor(self.uri)
+        for i in range(self.nrecords):
+            self.assertEqual(cursor['key{:010d}'.format(i)], self.value(i))
+        cursor.close()
+        self.session.verify(self.uri)
+
+    def test_compress_adaptive_config(self):
+        msg = '/adaptive compression requires a block_compressor/'
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.create(self.uri, 'key_format=S,value_format=S,' +
+                'block_compressor_adaptive=(compressors=[zlib],policy=ratio)'), msg)
+        msg = '/unknown compressor/'
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.create(self.uri, 'key_format=S,value_format=S,' +
+                'block_compressor=zlib,block_compressor_adaptive=(compressors=[xxx])'), msg)
@@ -0,0 +1,105 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+import os, shutil, subprocess
+import wiredtiger, wttest
+
+# test_compress05.py
+#   Check zstd block compression with a per-table trained dictionary, passed to the compressor with
+#   the block_compressor_config setting and stored in the table's metadata.
+class test_compress05(wttest.WiredTigerTestCase):
+    uri = 'table:test_compress05'
+    nrecords = 10000
+
+    # Load the compression extensions, skip the test if missing
+    def conn_extensions(self, extlist):
+        extlist.skip_if_missing = True
+        extlist.extension('compressors', 'nop')
+        extlist.extension('compressors', 'zstd')
+
+    # Small, similar records: the case where a trained dictionary helps.
+    def value(self, i):
+        return '{{"id": {}, "name": "user{}", "status": "{}", "score": {}}}'.format(
+            i, i % 97, ('active', 'inactive', 'pending')[i % 3], (i * 7919) % 1000)
+
+    # Train a dictionary on sample records with the zstd command-line tool.
+    def train_dictionary(self):
+        if shutil.which('zstd') is None:
+            self.skipTest('zstd command-line tool is not available')
+        os.mkdir('samples')
+        for i in range(2000):
+            with open(os.path.join('samples', str(i)), 'w') as f:
+                f.write(self.value(i * 13))
+        subprocess.run(['zstd', '--train', '-r', 'samples', '--maxdict=4096', '-o', 'dict', '-q'],
+            check=True)
+        with open('dict', 'rb') as f:
+            return f.read().hex()
+
+    @wttest.zstdtest('Skip zstd on pcc and zseries machines')
+    def test_compress_dictionary(self):
+        dictionary = self.train_dictionary()
+        self.session.create(self.uri, 'key_format=S,value_format=S,leaf_page_max=4KB,' +
+            'block_compressor=zstd,block_compressor_config="dictionary={}"'.format(dictionary))
+        cursor = self.session.open_cursor(self.uri)
+        for i in range(self.nrecords):
+            cursor['key{:010d}'.format(i)] = self.value(i)
+        cursor.close()
+        self.session.checkpoint()
+
+        # The dictionary is stored in the metadata, and loaded again when the table is reopened.
+        self.reopen_conn()
+        cursor = self.session.open_cursor('metadata:')
+        self.assertIn(dictionary, cursor['file:test_compress05.wt'])
+        cursor.close()
+        cursor = self.session.open_cursor(self.uri)
+        for i in range(self.nrecords):
+            self.assertEqual(cursor['key{:010d}'.format(i)], self.value(i))
+        cursor.close()
+        self.session.verify(self.uri)
+
+    @wttest.zstdtest('Skip zstd on pcc and zseries machines')
+    def test_compress_dictionary_config(self):
+        msg = '/requires block_compressor to be set/'
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.create(self.uri, 'key_format=S,value_format=S,' +
+                'block_compressor_config="dictionary=00"'), msg)
+        msg = '/does not support block_compressor_config/'
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.create(self.uri, 'key_format=S,value_format=S,' +
+                'block_compressor=nop,block_compressor_config="dictionary=00"'), msg)
+        msg = '/not a hexadecimal string/'
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.create(self.uri, 'key_format=S,value_format=S,' +
+                'block_compressor=zstd,block_compressor_config="dictionary=xyz"'), msg)
+        # A raw content dictionary has no dictionary ID and is rejected.
+        msg = '/not a trained zstd dictionary/'
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.create(self.uri, 'key_format=S,value_format=S,' +
+                'block_compressor=zstd,block_compressor_config="dictionary={}"'.format(
+                self.value(0).encode().hex())), msg)
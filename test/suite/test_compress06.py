@@ -0,0 +1,117 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+import os, shutil, subprocess
+import wiredtiger, wttest
+from wiredtiger import stat
+
+# test_compress06.py
+#   Check zstd log compression with a trained dictionary, passed to the compressor with the
+#   log.compressor_config setting.
+class test_compress06(wttest.WiredTigerTestCase):
+    uri = 'table:test_compress06'
+    nrecords = 5000
+
+    # Load the compression extensions, skip the test if missing
+    def conn_extensions(self, extlist):
+        extlist.skip_if_missing = True
+        extlist.extension('compressors', 'nop')
+        extlist.extension('compressors', 'zstd')
+
+    # Small, similar documents, each committed on its own: the case where a dictionary helps.
+    def value(self, i):
+        return ('{{"id": {}, "name": "user{}", "status": "{}", "score": {}, ' +
+            '"address": {{"street": "{} Main Street", "city": "Springfield", ' +
+            '"country": "US"}}, "tags": ["customer", "newsletter"]}}').format(
+            i, i % 97, ('active', 'inactive', 'pending')[i % 3], (i * 7919) % 1000, i % 500)
+
+    # Train a dictionary on sample records with the zstd command-line tool.
+    def train_dictionary(self):
+        if shutil.which('zstd') is None:
+            self.skipTest('zstd command-line tool is not available')
+        os.mkdir('samples')
+        for i in range(2000):
+            with open(os.path.join('samples', str(i)), 'w') as f:
+                f.write(self.value(i * 13))
+        subprocess.run(['zstd', '--train', '-r', 'samples', '--maxdict=4096', '-o', 'dict', '-q'],
+            check=True)
+        with open('dict', 'rb') as f:
+            return f.read().hex()
+
+    def get_stat(self, stat_key):
+        c = self.session.open_cursor('statistics:', None, None)
+        val = c[stat_key][2]
+        c.close()
+        return val
+
+    # Write the records in their own home, returning the size of the compressed log records.
+    def populate(self, home, config):
+        os.mkdir(home)
+        self.reopen_conn(home, config)
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+        cursor = self.session.open_cursor(self.uri)
+        for i in range(self.nrecords):
+            cursor[i] = self.value(i)
+        cursor.close()
+        return self.get_stat(stat.conn.log_compress_len)
+
+    @wttest.zstdtest('Skip zstd on pcc and zseries machines')
+    def test_compress_log_dictionary(self):
+        dictionary = self.train_dictionary()
+        config = 'log=(enabled,compressor=zstd,compressor_config="dictionary={}")'.format(
+            dictionary)
+
+        plain_len = self.populate('plain', 'log=(enabled,compressor=zstd)')
+        dict_len = self.populate('dict', config)
+        self.assertLess(dict_len, plain_len)
+
+        # Recovery and log cursors read the records back with the same configuration.
+        self.close_conn()
+        self.open_conn('dict', config)
+        cursor = self.session.open_cursor(self.uri)
+        for i in range(self.nrecords):
+            self.assertEqual(cursor[i], self.value(i))
+        cursor.close()
+        count = 0
+        cursor = self.session.open_cursor('log:')
+        while cursor.next() == 0:
+            if self.value(count).encode() in cursor.get_value()[5]:
+                count += 1
+        cursor.close()
+        self.assertEqual(count, self.nrecords)
+
+    @wttest.zstdtest('Skip zstd on pcc and zseries machines')
+    def test_compress_log_dictionary_config(self):
+        os.mkdir('new')
+        msg = '/requires log.compressor to be set/'
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.reopen_conn('new', 'log=(enabled,compressor_config="dictionary=00")'),
+            msg)
+        msg = '/does not support log.compressor_config/'
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.reopen_conn('new',
+                'log=(enabled,compressor=nop,compressor_config="dictionary=00")'), msg)
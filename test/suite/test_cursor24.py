@@ -0,0 +1,103 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_cursor24.py
+#   Log cursors following the log as it is written.
+#
+
+import threading, time
+import wiredtiger, wttest
+from wiredtiger import stat
+
+class test_cursor24(wttest.WiredTigerTestCase):
+    uri = 'table:test_cursor24'
+    value = 'tail-value'
+
+    def conn_config(self):
+        return 'log=(enabled,file_max=100K,remove=false),statistics=(all)'
+
+    def get_stat(self, stat_key):
+        c = self.session.open_cursor('statistics:', None, None)
+        val = c[stat_key][2]
+        c.close()
+        return val
+
+    def insert(self, session, start, count):
+        c = session.open_cursor(self.uri)
+        for k in range(start, start + count):
+            session.begin_transaction()
+            c[k] = self.value + str(k)
+            session.commit_transaction()
+        c.close()
+
+    # Drain the log cursor, returning the keys of operations in the test table.
+    def drain(self, logc):
+        keys = []
+        while logc.next() == 0:
+            values = logc.get_value()
+            if values[4] != b'' and self.value.encode() in values[5]:
+                keys.append(values[5])
+        return keys
+
+    def test_log_cursor_tail(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+        self.insert(self.session, 0, 10)
+
+        # Without waiting, the cursor reaches the end and returns not-found.
+        logc = self.session.open_cursor('log:', None, 'log_tail_wait=200')
+        self.assertEqual(len(self.drain(logc)), 10)
+        self.assertGreater(self.get_stat(stat.conn.log_cursor_tail_wait), 0)
+
+        # The cursor keeps its position and returns records written since.
+        self.insert(self.session, 10, 5)
+        self.assertEqual(len(self.drain(logc)), 5)
+
+        # A record written while the cursor is waiting is returned by the same call.
+        def writer():
+            session = self.conn.open_session()
+            time.sleep(0.5)
+            self.insert(session, 15, 1)
+            session.close()
+        logc.close()
+        logc = self.session.open_cursor('log:', None, 'log_tail_wait=30000')
+        t = threading.Thread(target=writer)
+        t.start()
+        start = time.time()
+        found = False
+        while not found:
+            self.assertEqual(logc.next(), 0)
+            values = logc.get_value()
+            found = (self.value + '15').encode() in values[5]
+        t.join()
+        self.assertLess(time.time() - start, 30)
+        logc.close()
+
+    def test_log_cursor_tail_config(self):
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.open_cursor('log:', None, 'log_tail_wait=-1'),
+            '/Value too small/')
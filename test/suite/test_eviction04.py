@@ -0,0 +1,89 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+from eviction_util import eviction_util
+from wiredtiger import stat
+from wtscenario import make_scenarios
+
+# test_eviction04.py
+# Test the frequency eviction policy ranks pages read repeatedly behind pages read once.
+class test_eviction04(eviction_util):
+    policies = [
+        ('lru', dict(policy='lru')),
+        ('frequency', dict(policy='frequency')),
+    ]
+    scenarios = make_scenarios(policies)
+
+    def conn_config(self):
+        return f'cache_size=20MB,statistics=(all),eviction=(policy={self.policy})'
+
+    def read_all(self, uri, nrows, value):
+        cursor = self.session.open_cursor(uri)
+        for i in range(nrows):
+            self.assertEqual(cursor[i], value)
+        cursor.close()
+
+    def test_eviction04(self):
+        create_params = 'key_format=i,value_format=S'
+        hot_uri = 'table:eviction04_hot'
+        hot_rows = 1000
+        hot_value = 'h' * 1000
+        scan_uri = 'table:eviction04_scan'
+        scan_rows = 40000
+        scan_value = 's' * 1000
+
+        # Create a small, hot table and a table larger than the cache, and write them to disk.
+        self.session.create(hot_uri, create_params)
+        self.session.create(scan_uri, create_params)
+        for uri, nrows, value in [(hot_uri, hot_rows, hot_value), (scan_uri, scan_rows, scan_value)]:
+            cursor = self.session.open_cursor(uri)
+            for i in range(nrows):
+                cursor[i] = value
+            cursor.close()
+        self.session.checkpoint()
+
+        # Alternate reading the hot table and scanning the large table: each scan fills the cache
+        # and forces eviction to choose between the two.
+        for _ in range(3):
+            for _ in range(5):
+                self.read_all(hot_uri, hot_rows, hot_value)
+            self.read_all(scan_uri, scan_rows, scan_value)
+        self.read_all(hot_uri, hot_rows, hot_value)
+
+        # Only the frequency policy ranks pages by how often they're read.
+        ranked = self.get_stat(stat.conn.eviction_frequency_ranked)
+        if self.policy == 'frequency':
+            self.assertGreater(ranked, 0)
+        else:
+            self.assertEqual(ranked, 0)
+
+        # The policy can be reconfigured.
+        other = 'lru' if self.policy == 'frequency' else 'frequency'
+        self.conn.reconfigure(f'eviction=(policy={other})')
+        self.read_all(scan_uri, scan_rows, scan_value)
+        self.read_all(hot_uri, hot_rows, hot_value)
@@ -0,0 +1,96 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import time
+from eviction_util import eviction_util
+from wiredtiger import stat
+from wtscenario import make_scenarios
+
+# test_eviction05.py
+# Test eviction takes dirty pages from the dirty page index when it only needs to evict dirty
+# content.
+class test_eviction05(eviction_util):
+    dirty_index = [
+        ('index', dict(dirty_page_index=True)),
+        ('no_index', dict(dirty_page_index=False)),
+    ]
+    scenarios = make_scenarios(dirty_index)
+
+    def conn_config(self):
+        return 'cache_size=50MB,statistics=(all),eviction_dirty_target=1,' \
+            'eviction_dirty_trigger=20,eviction_updates_trigger=50,' \
+            f'eviction=(dirty_page_index={str(self.dirty_page_index).lower()})'
+
+    def test_eviction05(self):
+        create_params = 'key_format=i,value_format=S'
+        clean_uri = 'table:eviction05_clean'
+        clean_rows = 10000
+        dirty_uri = 'table:eviction05_dirty'
+        dirty_rows = 5000
+        value = 'v' * 1000
+
+        # Fill part of the cache with clean pages.
+        self.session.create(clean_uri, create_params)
+        self.session.create(dirty_uri, create_params)
+        cursor = self.session.open_cursor(clean_uri)
+        for i in range(clean_rows):
+            cursor[i] = value
+        cursor.close()
+        self.session.checkpoint()
+        cursor = self.session.open_cursor(clean_uri)
+        for i in range(clean_rows):
+            self.assertEqual(cursor[i], value)
+        cursor.close()
+
+        # Dirty the cache beyond the dirty target, but not the total target.
+        cursor = self.session.open_cursor(dirty_uri)
+        for i in range(dirty_rows):
+            cursor[i] = value
+        cursor.close()
+
+        # Wait for eviction to reduce the dirty content.
+        if self.dirty_page_index:
+            for _ in range(60):
+                if self.get_stat(stat.conn.eviction_dirty_index_pages_queued) > 0:
+                    break
+                time.sleep(0.5)
+            self.assertGreater(self.get_stat(stat.conn.eviction_dirty_index_pages_queued), 0)
+            self.assertGreater(self.get_stat(stat.conn.eviction_dirty_index_pages_seen), 0)
+        else:
+            time.sleep(1)
+            self.assertEqual(self.get_stat(stat.conn.eviction_dirty_index_pages_seen), 0)
+
+        # The dirty page index can be reconfigured, and the content is unchanged.
+        self.conn.reconfigure(
+            f'eviction=(dirty_page_index={str(not self.dirty_page_index).lower()})')
+        cursor = self.session.open_cursor(dirty_uri)
+        for i in range(dirty_rows):
+            self.assertEqual(cursor[i], value)
+            cursor[i] = value + 'x'
+        cursor.close()
+        self.session.checkpoint()
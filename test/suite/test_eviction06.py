@@ -0,0 +1,76 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+from eviction_util import eviction_util
+from wiredtiger import stat
+from wtscenario import make_scenarios
+
+# test_eviction06.py
+# Test application threads wait for the eviction threads rather than evicting pages when eviction
+# is handed off.
+class test_eviction06(eviction_util):
+    handoff = [
+        ('assist', dict(app_handoff=False)),
+        ('handoff', dict(app_handoff=True)),
+    ]
+    scenarios = make_scenarios(handoff)
+
+    def conn_config(self):
+        return 'cache_size=10MB,statistics=(all),' \
+            f'eviction=(threads_min=1,threads_max=4,app_handoff={str(self.app_handoff).lower()})'
+
+    def test_eviction06(self):
+        uri = 'table:eviction06'
+        nrows = 50000
+        value = 'v' * 1000
+
+        # Insert more content than fits in the cache, so the cache crosses the eviction trigger.
+        self.session.create(uri, 'key_format=i,value_format=S')
+        cursor = self.session.open_cursor(uri)
+        for i in range(nrows):
+            self.session.begin_transaction()
+            cursor[i] = value
+            self.session.commit_transaction()
+        cursor.close()
+
+        waits = self.get_stat(stat.conn.eviction_app_handoff_wait)
+        if self.app_handoff:
+            # Application threads waited instead of evicting pages.
+            self.assertGreater(waits, 0)
+            self.assertEqual(self.get_stat(stat.conn.eviction_app_attempt), 0)
+            self.assertEqual(waits, self.get_stat(stat.conn.application_cache_ops))
+        else:
+            self.assertEqual(waits, 0)
+
+        # Handoff can be reconfigured, and the content is unchanged.
+        self.conn.reconfigure(f'eviction=(app_handoff={str(not self.app_handoff).lower()},' \
+            'app_handoff_wait_max_ms=10)')
+        cursor = self.session.open_cursor(uri)
+        for i in range(nrows):
+            self.assertEqual(cursor[i], value)
+        cursor.close()
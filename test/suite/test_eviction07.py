@@ -0,0 +1,76 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+from eviction_util import eviction_util
+from wiredtiger import stat
+
+# test_eviction07.py
+# Test eviction honours the tables' cache shares: a table's working set below its minimum share
+# isn't evicted by a bulk load into a table over its maximum share.
+class test_eviction07(eviction_util):
+    conn_config = 'cache_size=30MB,statistics=(all)'
+
+    def test_eviction07(self):
+        uri_a = 'table:eviction07_a'
+        uri_b = 'table:eviction07_b'
+        value = 'v' * 1000
+
+        self.session.create(uri_a, 'key_format=i,value_format=S,cache_quota=(min=30)')
+        self.session.create(uri_b, 'key_format=i,value_format=S,cache_quota=(max=1)')
+
+        # Load and checkpoint the first table's working set, then read it back into the cache.
+        cursor = self.session.open_cursor(uri_a)
+        for i in range(8000):
+            cursor[i] = value
+        cursor.close()
+        self.session.checkpoint()
+        cursor = self.session.open_cursor(uri_a)
+        for i in range(8000):
+            self.assertEqual(cursor[i], value)
+        cursor.close()
+        inuse = self.get_stat(stat.dsrc.cache_bytes_inuse, uri_a)
+
+        # Load more content than fits in the cache into the second table.
+        cursor = self.session.open_cursor(uri_b)
+        for i in range(100000):
+            cursor[i] = value
+        cursor.close()
+
+        # The first table's working set stayed in the cache.
+        self.assertGreater(self.get_stat(stat.conn.eviction_server_skip_trees_below_cache_quota), 0)
+        self.assertGreater(
+            self.get_stat(stat.conn.eviction_server_skip_trees_cache_quota_over), 0)
+        self.assertGreaterEqual(self.get_stat(stat.dsrc.cache_bytes_inuse, uri_a), inuse * 0.9)
+
+        # Cache shares can be altered.
+        self.session.alter(uri_a, 'cache_quota=(min=0)')
+        self.session.alter(uri_b, 'cache_quota=(max=100)')
+        cursor = self.session.open_cursor('metadata:')
+        self.assertIn('cache_quota=(max=100,min=0)', cursor['file:eviction07_b.wt'])
+        cursor.close()
@@ -0,0 +1,68 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+import os, wiredtiger, wttest
+from wiredtiger import stat
+
+# test_eviction08.py
+# Test a cache partitioned across NUMA nodes. Builds without NUMA support refuse the configuration,
+# machines with a single node have nothing to partition.
+class test_eviction08(wttest.WiredTigerTestCase):
+    uri = 'table:eviction08'
+
+    def get_stat(self, session, stat):
+        stat_cursor = session.open_cursor('statistics:')
+        val = stat_cursor[stat][2]
+        stat_cursor.close()
+        return val
+
+    def test_eviction08(self):
+        os.mkdir('numa')
+        config = 'create,cache_size=10MB,statistics=(all),cache_numa=true'
+        try:
+            conn = self.wiredtiger_open('numa', config)
+        except wiredtiger.WiredTigerError:
+            self.ignoreStderrPatternIfExists('requires a build with NUMA support')
+            self.skipTest('NUMA support is not configured')
+
+        # Insert more content than fits in the cache, and read it back.
+        nrows = 30000
+        value = 'v' * 1000
+        session = conn.open_session()
+        session.create(self.uri, 'key_format=i,value_format=S')
+        cursor = session.open_cursor(self.uri)
+        for i in range(nrows):
+            cursor[i] = value
+        for i in range(nrows):
+            self.assertEqual(cursor[i], value)
+        cursor.close()
+
+        # Eviction ran, whatever the number of nodes.
+        self.assertGreater(self.get_stat(session, stat.conn.eviction_walk), 0)
+        conn.close()
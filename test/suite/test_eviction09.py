@@ -0,0 +1,58 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import time
+from eviction_util import eviction_util
+from wiredtiger import stat
+
+# test_eviction09.py
+# Test predictive eviction tuning: bursts of inserts with pauses between them let the eviction
+# server measure the cache's growth and start eviction before the cache reaches its target.
+class test_eviction09(eviction_util):
+    conn_config = 'cache_size=20MB,statistics=(all),' \
+        'eviction=(threads_max=4,tuning=predictive,tuning_horizon_ms=500)'
+
+    def test_eviction09(self):
+        uri = 'table:eviction09'
+        value = 'v' * 1000
+        self.session.create(uri, 'key_format=i,value_format=S')
+
+        cursor = self.session.open_cursor(uri)
+        for burst in range(10):
+            for i in range(3000):
+                cursor[burst * 3000 + i] = value
+            time.sleep(0.3)
+        cursor.close()
+
+        self.assertGreater(self.get_stat(stat.conn.eviction_predict_early_start), 0)
+        self.assertGreaterEqual(self.get_stat(stat.conn.eviction_predict_horizon), 500)
+        self.assertLessEqual(self.get_stat(stat.conn.eviction_predict_horizon), 4000)
+
+        # Predictive tuning can be turned off and on again.
+        self.conn.reconfigure('eviction=(tuning=reactive)')
+        self.conn.reconfigure('eviction=(tuning=predictive,tuning_horizon_ms=2000)')
@@ -0,0 +1,80 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+import glob, struct
+from eviction_util import eviction_util
+from wiredtiger import stat
+
+# test_eviction10.py
+# Test the eviction trace: a workload larger than the cache is traced, and the trace file holds a
+# header and records of page reads, accesses and evictions.
+class test_eviction10(eviction_util):
+    conn_config = 'cache_size=10MB,statistics=(all),eviction=(trace=true)'
+
+    header_format = '<IIIIQQ'
+    record_format = '<QQQIIBB6x'
+
+    def records(self, name):
+        with open(name, 'rb') as f:
+            data = f.read()
+        magic, version, record_size, _, _, cache_size = \
+            struct.unpack_from(self.header_format, data)
+        self.assertEqual(magic, 0x57544554)
+        self.assertEqual(version, 1)
+        self.assertEqual(record_size, struct.calcsize(self.record_format))
+        self.assertEqual(cache_size, 10 * 1024 * 1024)
+        offset = struct.calcsize(self.header_format)
+        return [struct.unpack_from(self.record_format, data, offset + i * record_size)
+            for i in range((len(data) - offset) // record_size)]
+
+    def test_eviction10(self):
+        uri = 'table:eviction10'
+        value = 'v' * 1000
+        self.session.create(uri, 'key_format=i,value_format=S')
+
+        cursor = self.session.open_cursor(uri)
+        for i in range(30000):
+            cursor[i] = value
+        cursor.close()
+        self.session.checkpoint()
+
+        # Closing the connection writes out the buffered records, the reopened connection starts
+        # a new trace file.
+        self.reopen_conn()
+        self.conn.reconfigure('eviction=(trace=false)')
+
+        traces = glob.glob('WiredTigerEvictTrace.*')
+        self.assertEqual(len(traces), 2)
+        records = self.records(sorted(traces)[0])
+        types = set(r[5] for r in records)
+        self.assertIn(1, types)
+        self.assertIn(4, types)
+
+        # Tracing can be started again, into a new file.
+        self.conn.reconfigure('eviction=(trace=true)')
+        self.assertEqual(len(glob.glob('WiredTigerEvictTrace.*')), 3)
+        self.conn.reconfigure('eviction=(trace=false)')
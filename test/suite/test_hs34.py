@@ -0,0 +1,103 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import time, wiredtiger, wttest
+from wiredtiger import stat
+from wtdataset import SimpleDataSet
+
+# test_hs34.py
+# Test that with history_store=(drop_truncate=background), dropping a table records its history
+# store content for removal, and checkpoint cleanup truncates it later.
+class test_hs34(wttest.WiredTigerTestCase):
+    conn_config = 'history_store=(drop_truncate=background),statistics=(all)'
+    uri = 'table:test_hs34'
+    nrows = 1000
+
+    def get_stat(self, stat):
+        stat_cursor = self.session.open_cursor('statistics:')
+        val = stat_cursor[stat][2]
+        stat_cursor.close()
+        return val
+
+    def pending_drops(self):
+        count = 0
+        c = self.session.open_cursor('metadata:')
+        c.set_key('system:hs_drop.')
+        if c.search_near() != wiredtiger.WT_NOTFOUND:
+            if c.get_key() < 'system:hs_drop.':
+                c.next()
+            while c.get_key().startswith('system:hs_drop.'):
+                count += 1
+                if c.next() != 0:
+                    break
+        c.close()
+        return count
+
+    def test_hs_drop_background(self):
+        self.conn.set_timestamp('oldest_timestamp=' + self.timestamp_str(1))
+        ds = SimpleDataSet(self, self.uri, 0, key_format='i', value_format='S')
+        ds.populate()
+
+        # Write several versions of each key, so older versions go to the history store.
+        cursor = self.session.open_cursor(self.uri)
+        for ts, value in [(2, 'a'), (3, 'b'), (4, 'c')]:
+            self.session.begin_transaction()
+            for i in range(1, self.nrows):
+                cursor[i] = value * 100
+            self.session.commit_transaction('commit_timestamp=' + self.timestamp_str(ts))
+        cursor.close()
+        self.conn.set_timestamp('stable_timestamp=' + self.timestamp_str(4))
+        self.session.checkpoint()
+
+        # Dropping the table leaves its history store content for checkpoint cleanup.
+        self.dropUntilSuccess(self.session, self.uri)
+        self.assertEqual(self.pending_drops(), 1)
+
+        # The history store still verifies while the dropped table's content remains.
+        self.session.verify('file:WiredTigerHS.wt')
+
+        # Trigger checkpoint cleanup and wait for it to truncate the dropped table's content.
+        self.session.checkpoint('debug=(checkpoint_cleanup=true)')
+        while self.get_stat(stat.conn.cache_hs_btree_truncate_dropped) == 0:
+            time.sleep(0.1)
+        self.assertEqual(self.pending_drops(), 0)
+
+    def test_hs_drop_background_reopen(self):
+        ds = SimpleDataSet(self, self.uri, 100)
+        ds.populate()
+        self.session.checkpoint()
+        self.dropUntilSuccess(self.session, self.uri)
+        self.assertEqual(self.pending_drops(), 1)
+
+        # The pending truncation survives a restart, and the file ID isn't reused.
+        self.reopen_conn()
+        self.assertEqual(self.pending_drops(), 1)
+        self.session.checkpoint('debug=(checkpoint_cleanup=true)')
+        while self.get_stat(stat.conn.cache_hs_btree_truncate_dropped) == 0:
+            time.sleep(0.1)
+        self.assertEqual(self.pending_drops(), 0)
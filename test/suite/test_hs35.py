@@ -0,0 +1,97 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wiredtiger, wttest
+from wtscenario import make_scenarios
+
+# test_hs35.py
+# Test that history_store=(delta_chain_max) limits the number of consecutive reverse deltas the
+# history store stores for a key, and that old versions read back correctly.
+class test_hs35(wttest.WiredTigerTestCase):
+    nversions = 25
+
+    delta_values = [
+        ('full_only', dict(delta_chain_max=0)),
+        ('default', dict(delta_chain_max=10)),
+        ('long', dict(delta_chain_max=100)),
+    ]
+    scenarios = make_scenarios(delta_values)
+
+    def conn_config(self):
+        return 'history_store=(delta_chain_max={}),statistics=(all)'.format(self.delta_chain_max)
+
+    def get_stat(self, stat):
+        stat_cursor = self.session.open_cursor('statistics:')
+        val = stat_cursor[stat][2]
+        stat_cursor.close()
+        return val
+
+    def test_delta_chain_max(self):
+        uri = 'table:test_hs35'
+        self.session.create(uri, 'key_format=i,value_format=S')
+        self.conn.set_timestamp('oldest_timestamp=' + self.timestamp_str(1))
+
+        # Update one byte of a large value in each version.
+        base = 'abcdefghij' * 1000
+        values = {}
+        cursor = self.session.open_cursor(uri)
+        for ts in range(2, self.nversions + 2):
+            value = base[:ts] + 'X' + base[ts + 1:]
+            self.session.begin_transaction()
+            cursor[1] = value
+            self.session.commit_transaction('commit_timestamp=' + self.timestamp_str(ts))
+            values[ts] = value
+        cursor.close()
+
+        # Move the older versions to the history store in one reconciliation.
+        self.session.checkpoint()
+
+        full = self.get_stat(wiredtiger.stat.conn.cache_hs_insert_full_update)
+        delta = self.get_stat(wiredtiger.stat.conn.cache_hs_insert_reverse_modify)
+        self.assertEqual(full + delta, self.nversions - 1)
+        if self.delta_chain_max == 0:
+            self.assertEqual(delta, 0)
+        else:
+            # The newest version in the history store is always a full value.
+            expected = (self.nversions - 2) // (self.delta_chain_max + 1)
+            self.assertEqual(full, 1 + expected)
+
+        # Read every version back from the history store.
+        self.reopen_conn()
+        cursor = self.session.open_cursor(uri)
+        for ts, value in values.items():
+            self.session.begin_transaction('read_timestamp=' + self.timestamp_str(ts))
+            self.assertEqual(cursor[1], value)
+            self.session.rollback_transaction()
+        cursor.close()
+
+    def test_delta_chain_max_reconfigure(self):
+        self.conn.reconfigure('history_store=(delta_chain_max=5)')
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.conn.reconfigure('history_store=(delta_chain_max=101)'),
+            '/Value too large/')
@@ -0,0 +1,99 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wiredtiger, wttest
+from wiredtiger import stat
+from wtscenario import make_scenarios
+
+# test_hs36.py
+# Test the history store key filter: searches for keys without history skip the history store,
+# and keys with history still find their older versions.
+class test_hs36(wttest.WiredTigerTestCase):
+    nrows = 100
+
+    filter_values = [
+        ('disabled', dict(key_filter_size=0)),
+        ('enabled', dict(key_filter_size=1048576)),
+    ]
+    key_format_values = [
+        ('column', dict(key_format='r')),
+        ('row_integer', dict(key_format='i')),
+    ]
+    scenarios = make_scenarios(filter_values, key_format_values)
+
+    def conn_config(self):
+        return 'history_store=(key_filter_size={}),statistics=(all)'.format(self.key_filter_size)
+
+    def get_stat(self, stat):
+        stat_cursor = self.session.open_cursor('statistics:')
+        val = stat_cursor[stat][2]
+        stat_cursor.close()
+        return val
+
+    def test_key_filter(self):
+        uri = 'table:test_hs36'
+        self.session.create(uri, 'key_format={},value_format=S'.format(self.key_format))
+        self.conn.set_timestamp('oldest_timestamp=' + self.timestamp_str(1))
+
+        # The first half of the keys have an older version, the second half don't.
+        cursor = self.session.open_cursor(uri)
+        self.session.begin_transaction()
+        for i in range(1, self.nrows + 1):
+            cursor[i] = 'old' + str(i)
+        self.session.commit_transaction('commit_timestamp=' + self.timestamp_str(2))
+        self.session.begin_transaction()
+        for i in range(1, 2 * self.nrows + 1):
+            cursor[i] = 'new' + str(i)
+        self.session.commit_transaction('commit_timestamp=' + self.timestamp_str(10))
+        cursor.close()
+        self.conn.set_timestamp('stable_timestamp=' + self.timestamp_str(10))
+        self.session.checkpoint()
+
+        # Reopen so the history store content is written before the table is opened again.
+        self.reopen_conn()
+
+        # Reading before the second half of the keys existed searches the history store.
+        cursor = self.session.open_cursor(uri)
+        self.session.begin_transaction('read_timestamp=' + self.timestamp_str(5))
+        for i in range(1, 2 * self.nrows + 1):
+            if i <= self.nrows:
+                self.assertEqual(cursor[i], 'old' + str(i))
+            else:
+                cursor.set_key(i)
+                self.assertEqual(cursor.search(), wiredtiger.WT_NOTFOUND)
+        self.session.rollback_transaction()
+        cursor.close()
+
+        skipped = self.get_stat(stat.conn.cache_hs_filter_skip)
+        if self.key_filter_size == 0:
+            self.assertEqual(skipped, 0)
+            self.assertEqual(self.get_stat(stat.conn.cache_hs_filter_build), 0)
+        else:
+            self.assertGreater(skipped, 0)
+            self.assertLessEqual(skipped, self.nrows)
+            self.assertEqual(self.get_stat(stat.conn.cache_hs_filter_build), 1)
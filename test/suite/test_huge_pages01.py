@@ -0,0 +1,81 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import sys
+import wiredtiger, wttest
+from wiredtiger import stat
+
+# test_huge_pages01.py
+# Test allocating cache memory from the huge page arena. Systems without huge pages reserved fall
+# back to transparent huge pages, so the arena can be tested anywhere on Linux.
+class test_huge_pages01(wttest.WiredTigerTestCase):
+    uri = 'table:test_huge_pages01'
+    conn_config = 'cache_size=50MB,statistics=(all),cache_huge_pages=(enabled=true,size=20MB)'
+    nrows = 20000
+
+    def get_stat(self, stat):
+        stat_cursor = self.session.open_cursor('statistics:')
+        val = stat_cursor[stat][2]
+        stat_cursor.close()
+        return val
+
+    def test_huge_pages(self):
+        if not sys.platform.startswith('linux'):
+            self.skipTest('huge page cache allocations are only supported on Linux')
+
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+        cursor = self.session.open_cursor(self.uri)
+        for i in range(1, self.nrows):
+            cursor[i] = str(i) * 100
+        cursor.close()
+
+        self.session.checkpoint()
+        cursor = self.session.open_cursor(self.uri)
+        for i in range(1, self.nrows):
+            self.assertEqual(cursor[i], str(i) * 100)
+        cursor.close()
+
+        self.assertGreater(self.get_stat(stat.conn.cache_huge_arena_alloc), 0)
+        self.assertGreater(self.get_stat(stat.conn.cache_huge_arena_bytes), 0)
+
+        # Reopening the connection releases the arena and maps a new one.
+        self.reopen_conn()
+        cursor = self.session.open_cursor(self.uri)
+        self.assertEqual(cursor[self.nrows - 1], str(self.nrows - 1) * 100)
+        cursor.close()
+
+    def test_huge_pages_shared_cache(self):
+        if not sys.platform.startswith('linux'):
+            self.skipTest('huge page cache allocations are only supported on Linux')
+
+        # The arena can't be sized from a shared cache.
+        self.close_conn()
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.wiredtiger_open(self.home,
+            'create,shared_cache=(name=pool,size=50MB),cache_huge_pages=(enabled=true)'),
+            '/cache_huge_pages.size must be configured with a shared cache/')
@@ -0,0 +1,88 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+import threading, wiredtiger, wttest
+from wiredtiger import stat
+
+# test_log05.py
+#    Test log.group_commit_wait_max, holding log slots open for syncing commits.
+class test_log05(wttest.WiredTigerTestCase):
+    uri = 'table:test_log05'
+    nthreads = 8
+    nentries = 200
+    conn_config = 'log=(enabled,group_commit_wait_max=2000),statistics=(all),' + \
+        'transaction_sync=(enabled,method=fsync)'
+
+    def get_stat(self, stat_key):
+        cursor = self.session.open_cursor('statistics:', None, None)
+        result = cursor[stat_key][2]
+        cursor.close()
+        return result
+
+    def commit_thread(self, id):
+        session = self.conn.open_session()
+        cursor = session.open_cursor(self.uri)
+        for i in range(self.nentries):
+            session.begin_transaction()
+            cursor['%d-%d' % (id, i)] = 'value'
+            session.commit_transaction()
+        session.close()
+
+    def run_threads(self):
+        threads = [threading.Thread(target=self.commit_thread, args=(i,))
+            for i in range(self.nthreads)]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+
+    def count(self):
+        cursor = self.session.open_cursor(self.uri)
+        n = sum(1 for _ in cursor)
+        cursor.close()
+        return n
+
+    def test_log_group_commit(self):
+        self.session.create(self.uri, 'key_format=S,value_format=S')
+        self.run_threads()
+        self.assertGreater(self.get_stat(stat.conn.log_sync), 0)
+
+        # Turning group commit off and on again is allowed while running.
+        self.conn.reconfigure('log=(group_commit_wait_max=0)')
+        self.run_threads()
+        self.conn.reconfigure('log=(group_commit_wait_max=500)')
+
+        # Every commit is recovered.
+        self.reopen_conn()
+        self.assertEqual(self.count(), self.nthreads * self.nentries)
+
+    def test_log_group_commit_config(self):
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.conn.reconfigure('log=(group_commit_wait_max=200000)'),
+            '/Value too large/')
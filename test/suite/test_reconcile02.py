@@ -0,0 +1,101 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+import wttest
+from wiredtiger import stat
+
+# test_reconcile02.py
+# Test reconciliation allocating the list of blocks it writes, and the updates saved for each block,
+# from its arena: evict a page that splits into several blocks, with and without updates that have
+# to be restored to the new pages, and check the results are copied out of the arena intact.
+class test_reconcile02(wttest.WiredTigerTestCase):
+    uri = 'table:test_reconcile02'
+    conn_config = 'cache_size=50MB,statistics=(all)'
+    nrows = 5000
+
+    def get_stat(self, stat, uri=''):
+        stat_cursor = self.session.open_cursor('statistics:' + uri)
+        val = stat_cursor[stat][2]
+        stat_cursor.close()
+        return val
+
+    def evict(self, key, value):
+        evict_cursor = self.session.open_cursor(self.uri, None, 'debug=(release_evict)')
+        self.session.begin_transaction()
+        self.assertEqual(evict_cursor[key], value)
+        self.assertEqual(evict_cursor.reset(), 0)
+        self.session.rollback_transaction()
+        evict_cursor.close()
+
+    def check(self, value):
+        cursor = self.session.open_cursor(self.uri)
+        for i in range(1, self.nrows):
+            self.assertEqual(cursor[i], value + str(i))
+        cursor.close()
+
+    def test_reconcile_arena(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S,leaf_page_max=4KB')
+
+        # Build one large in-memory page, then evict it into several blocks.
+        cursor = self.session.open_cursor(self.uri)
+        self.session.begin_transaction()
+        for i in range(1, self.nrows):
+            cursor[i] = 'a' * 50 + str(i)
+        self.session.commit_transaction()
+        cursor.close()
+        self.evict(1, 'a' * 50 + '1')
+
+        self.assertGreater(self.get_stat(stat.dsrc.rec_multiblock_leaf, self.uri), 0)
+        self.assertGreater(self.get_stat(stat.conn.rec_arena_alloc), 0)
+        self.assertGreater(self.get_stat(stat.conn.rec_arena_chunk), 0)
+        self.check('a' * 50)
+
+        # Hold a snapshot so the next eviction saves the updates it can't write and restores them
+        # to the pages it creates.
+        session2 = self.conn.open_session()
+        session2.begin_transaction()
+        cursor2 = session2.open_cursor(self.uri)
+        self.assertEqual(cursor2[1], 'a' * 50 + '1')
+
+        cursor = self.session.open_cursor(self.uri)
+        self.session.begin_transaction()
+        for i in range(1, self.nrows):
+            cursor[i] = 'b' * 50 + str(i)
+        self.session.commit_transaction()
+        cursor.close()
+        self.evict(1, 'b' * 50 + '1')
+
+        self.check('b' * 50)
+        for i in range(1, self.nrows, 100):
+            self.assertEqual(cursor2[i], 'a' * 50 + str(i))
+        session2.rollback_transaction()
+        session2.close()
+
+if __name__ == '__main__':
+    wttest.run()
@@ -190,3 +190,25 @@ class test_shared_cache02(wttest.WiredTigerTestCase):
             "eviction_target=50")
 
         self.closeConnections()
+
+    # Test configuring and reconfiguring participant priorities
+    def test_shared_cache_priority(self):
+        nops = 1000
+        self.openConnections(['WT_TEST1'],
+            pool_opts = ',shared_cache=(name=pool,size=100M,reserve=20M,priority=90),')
+        self.openConnections(['WT_TEST2'],
+            pool_opts = ',shared_cache=(name=pool,size=100M,reserve=20M,priority=10),', add=1)
+
+        for sess in self.sessions:
+            sess.create(self.uri, "key_format=S,value_format=S")
+            self.add_records(sess, 0, nops)
+
+        self.conns[0].reconfigure("shared_cache=(name=pool,priority=20)")
+        self.conns[1].reconfigure("shared_cache=(name=pool,reserve=30M)")
+
+        # Priorities outside the range are rejected.
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.conns[0].reconfigure("shared_cache=(name=pool,priority=200)"),
+            '/Value too large for key/')
+
+        self.closeConnections()
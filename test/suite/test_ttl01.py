@@ -0,0 +1,103 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+import wiredtiger, wttest
+from wtscenario import make_scenarios
+
+# test_ttl01.py
+#    Check records expire once the configured time-to-live has passed, and that expired records
+#    are discarded by reconciliation.
+class test_ttl01(wttest.WiredTigerTestCase):
+    conn_config = 'statistics=(all)'
+    uri = 'table:ttl01'
+    nrows = 100
+
+    format_values = [
+        ('integer-row', dict(key_format='i')),
+        ('string-row', dict(key_format='S')),
+    ]
+    scenarios = make_scenarios(format_values)
+
+    def get_stat(self, stat):
+        stat_cursor = self.session.open_cursor('statistics:' + self.uri)
+        val = stat_cursor[stat][2]
+        stat_cursor.close()
+        return val
+
+    def check(self, ts, expected):
+        cursor = self.session.open_cursor(self.uri)
+        self.session.begin_transaction('read_timestamp=' + self.timestamp_str(ts))
+        count = 0
+        for k, v in cursor:
+            count += 1
+        self.session.rollback_transaction()
+        cursor.close()
+        self.assertEqual(count, expected)
+
+    def test_ttl_column_store(self):
+        msg = '/only supported for row-store/'
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.create(self.uri, 'key_format=r,value_format=S,ttl=10'), msg)
+
+    def test_ttl(self):
+        self.session.create(self.uri,
+            'key_format={},value_format=S,ttl=10'.format(self.key_format))
+        self.conn.set_timestamp('oldest_timestamp=' + self.timestamp_str(1))
+
+        # Half the records are committed at timestamp 10, the rest without a timestamp.
+        cursor = self.session.open_cursor(self.uri)
+        self.session.begin_transaction()
+        for i in range(1, self.nrows // 2 + 1):
+            cursor[self.make_key(i)] = 'value' + str(i)
+        self.session.commit_transaction('commit_timestamp=' + self.timestamp_str(10))
+        for i in range(self.nrows // 2 + 1, self.nrows + 1):
+            cursor[self.make_key(i)] = 'value' + str(i)
+        cursor.close()
+
+        # Timestamped records are visible until their time-to-live has passed.
+        self.check(15, self.nrows)
+        self.check(19, self.nrows)
+        self.check(20, self.nrows // 2)
+
+        # Move the oldest timestamp past the expiration time and checkpoint, the expired records
+        # are discarded from the page.
+        self.conn.set_timestamp('oldest_timestamp=' + self.timestamp_str(30) +
+            ',stable_timestamp=' + self.timestamp_str(30))
+        self.session.checkpoint()
+        self.assertEqual(self.get_stat(wiredtiger.stat.dsrc.rec_ttl_expired), self.nrows // 2)
+
+        # The records stay discarded after a restart.
+        self.reopen_conn()
+        self.check(30, self.nrows // 2)
+
+    def make_key(self, i):
+        return i if self.key_format == 'i' else str(i)
+
+if __name__ == '__main__':
+    wttest.run()
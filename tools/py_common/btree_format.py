@@ -104,7 +104,7 @@ class PageHeader(object):
     entries: int # Or: overflow data length
     type: PageType
     flags: int
-    unused: int
+    compressor: int
     version: int
 
     # Flags
@@ -125,7 +125,7 @@ class PageHeader(object):
         self.entries = 0
         self.type = PageType.WT_PAGE_INVALID
         self.flags = 0
-        self.unused = 0
+        self.compressor = 0
         self.version = 0
 
     @staticmethod
@@ -141,7 +141,7 @@ class PageHeader(object):
         h.entries = b.read_uint32()
         h.type = PageType(b.read_uint8())
         h.flags = b.read_uint8()
-        h.unused = b.read_uint8()
+        h.compressor = b.read_uint8()
         h.version = b.read_uint8()
         return h
 
@@ -373,9 +373,6 @@ def block_decode(p, b, nbytes, opts):
         # WT_BLOCK_HEADER in block.h (12 bytes or 44 bytes)
         blockhead = btree_format.BlockHeader.parse(b_page, disagg=opts.disagg)
 
-        if pagehead.unused != 0:
-            p.rint('? garbage in unused bytes')
-            return
         if pagehead.type == btree_format.PageType.WT_PAGE_INVALID:
             p.rint('? invalid page')
             return
@@ -387,6 +384,7 @@ def block_decode(p, b, nbytes, opts):
         p.rint('  ncells (oflow len): ' + str(pagehead.entries))
         p.rint('  page type: ' + str(pagehead.type.value) + ' (' + pagehead.type.name + ')')
         p.rint('  page flags: ' + hex(pagehead.flags))
+        p.rint('  compressor: ' + str(pagehead.compressor))
         p.rint('  version: ' + str(pagehead.version))
 
     if blockhead.unused != 0: